@@ -765,6 +765,54 @@ void KeyboardViewBase::createBitmapCache ()
 	}
 }
 
+//------------------------------------------------------------------------
+// collects consecutive keys drawn with the same bitmap or color to draw them with one call
+class KeyboardViewBase::DrawBatch
+{
+public:
+	explicit DrawBatch (CDrawContext* context) : context (context) {}
+
+	void addBitmap (CBitmap* bitmap, const CRect& dest)
+	{
+		if (!rects.empty () || (!sprites.empty () && bitmap != spriteBitmap))
+			flush ();
+		spriteBitmap = bitmap;
+		sprites.push_back ({dest, CPoint ()});
+	}
+
+	void addRect (const CRect& rect, const CColor& color, CDrawStyle style)
+	{
+		if (!sprites.empty () || (!rects.empty () && (color != rectColor || style != rectStyle)))
+			flush ();
+		rectColor = color;
+		rectStyle = style;
+		rects.push_back (rect);
+	}
+
+	void flush ()
+	{
+		if (!sprites.empty ())
+		{
+			context->drawBitmapSprites (spriteBitmap, sprites);
+			sprites.clear ();
+		}
+		if (!rects.empty ())
+		{
+			context->setFillColor (rectColor);
+			context->drawRects (rects, rectStyle);
+			rects.clear ();
+		}
+	}
+
+private:
+	CDrawContext* context;
+	CBitmap* spriteBitmap {nullptr};
+	CDrawContext::BitmapSpriteList sprites;
+	CDrawContext::RectList rects;
+	CColor rectColor;
+	CDrawStyle rectStyle {kDrawFilled};
+};
+
 //------------------------------------------------------------------------
 void KeyboardViewBase::drawRect (CDrawContext* context, const CRect& dirtyRect)
 {
@@ -780,6 +828,7 @@ void KeyboardViewBase::drawRect (CDrawContext* context, const CRect& dirtyRect)
 	context->setFont (noteNameFont);
 	context->setDrawMode (kAntiAliasing | kNonIntegralMode);
 
+	DrawBatch batch (context);
 	for (NoteIndex i = startNote; i <= startNote + numKeys; i++)
 	{
 		if (isWhiteKey (i) == false)
@@ -787,9 +836,10 @@ void KeyboardViewBase::drawRect (CDrawContext* context, const CRect& dirtyRect)
 		CRect r = getNoteRect (i);
 		if (dirtyRect.rectOverlap (r) == false)
 			continue;
-		drawNote (context, r, i, true);
+		drawNote (context, r, i, true, batch);
 		if (drawNoteText && i % 12 == 0)
 		{
+			batch.flush ();
 			char text[5];
 			snprintf (text, 4, "C%d", (i / 12) - 2);
 			r.top = r.bottom - context->getFont ()->getSize () - 10;
@@ -803,13 +853,14 @@ void KeyboardViewBase::drawRect (CDrawContext* context, const CRect& dirtyRect)
 		CRect r = getNoteRect (i);
 		if (dirtyRect.rectOverlap (r) == false)
 			continue;
-		drawNote (context, r, i, false);
+		drawNote (context, r, i, false, batch);
 	}
+	batch.flush ();
 }
 
 //------------------------------------------------------------------------
 void KeyboardViewBase::drawNote (CDrawContext* context, CRect& rect, NoteIndex note,
-                                 bool isWhite) const
+                                 bool isWhite, DrawBatch& batch) const
 {
 	CBitmap* keyBitmap = nullptr;
 	CRect bitmapRect (rect);
@@ -852,18 +903,26 @@ void KeyboardViewBase::drawNote (CDrawContext* context, CRect& rect, NoteIndex n
 
 	if (keyBitmap)
 	{
-		keyBitmap->draw (context, bitmapRect);
+		if (keyBitmap == whiteKeyBitmapCache || keyBitmap == blackKeyBitmapCache)
+			batch.addBitmap (keyBitmap, bitmapRect);
+		else
+		{
+			batch.flush ();
+			keyBitmap->draw (context, bitmapRect);
+		}
 	}
 	else
 	{
+		CColor color;
 		if (keyPressed[note])
-			context->setFillColor (isWhite ? whiteKeyPressedColor : blackKeyPressedColor);
+			color = isWhite ? whiteKeyPressedColor : blackKeyPressedColor;
 		else
-			context->setFillColor (isWhite ? whiteKeyColor : blackKeyColor);
-		context->drawRect (rect, isWhite ? kDrawFilledAndStroked : kDrawFilled);
+			color = isWhite ? whiteKeyColor : blackKeyColor;
+		batch.addRect (rect, color, isWhite ? kDrawFilledAndStroked : kDrawFilled);
 	}
 	if (keyPressed[note] && isWhite)
 	{
+		batch.flush ();
 		NoteIndex otherNote;
 		if (note > startNote)
 		{
@@ -95,7 +95,10 @@ protected:
 	const NoteRectCache& getNoteRectCache () const { return noteRectCache; }
 
 private:
-	void drawNote (CDrawContext* context, CRect& rect, NoteIndex note, bool isWhite) const;
+	class DrawBatch;
+
+	void drawNote (CDrawContext* context, CRect& rect, NoteIndex note, bool isWhite,
+	               DrawBatch& batch) const;
 	CRect calcNoteRect (NoteIndex note) const;
 	void updateNoteRectCache () const;
 	void createBitmapCache ();
@@ -28,6 +28,29 @@ It's recommended to start new projects with version 4 while old projects should
 - standalone library support for Windows 7
 - new ImageStitcher tool
 - the GDI+ draw backend was removed, the Direct2D backend is the replacement
+- new Control: VSTGUI::CLevelMeter
+- headless frame rendering on Linux, open the frame with VSTGUI::kHeadless (see VSTGUI::X11::HeadlessFrameConfig)
+- optional per view draw profiler (VSTGUI_DRAW_PROFILER, VSTGUI::DrawProfiler)
+- opaque views (VSTGUI::CView::setOpaque) let view containers skip drawing views covered by them
+- scrolling by blitting on Linux and the new VSTGUI::CScrollView::kScrollByTransform style
+- VSTGUI::CDataBrowser only draws the visible rows and stores its selection as row ranges (VSTGUI::CDataBrowser::selectRows, VSTGUI::CDataBrowser::isRowSelected)
+- the generic option menu (Linux) filters its items while typing and opens huge menus faster
+- views can cache their drawing in a display list (VSTGUI::CDisplayList, VSTGUI::CView::setDisplayListCacheEnabled)
+- batched draw primitives: VSTGUI::CDrawContext::drawRects, VSTGUI::CDrawContext::drawBitmapSprites and VSTGUI::CDrawContext::drawPolylines
+- graphics path hit testing works on Linux and paths cache their flattened geometry
+- radial gradients are supported on Linux and gradient patterns are shared between all draws of a gradient
+- bitmaps can be regions of a shared atlas bitmap (VSTGUI::CAtlasBitmap), the ImageStitcher tool can export atlases
+- decoded bitmaps can be evicted to stay within a memory budget and are decoded again on demand (VSTGUI::CBitmapCache)
+- bitmaps generate downsampled platform bitmaps for scale factors they have no own platform bitmap for (VSTGUI::CBitmapCache::setScaledBitmapBudget)
+- on Linux resources are memory mapped and the XML parser parses content which is in memory in one go without copying it
+- CMemoryStream grows geometrically, BufferedOutputStream copies whole blocks and OutputStream::writeRawChunks writes multiple buffers at once
+- the UI editor transfers views inside the editor in a compact binary format (VSTGUI::UIDescription::kBinaryViewsFormat), XML is only used for the clipboard
+- the UI editor undo manager merges changes of the same views which follow each other quickly (VSTGUI::UIUndoManager::setMergeTimeWindow) and limits the number and memory usage of its actions (VSTGUI::UIUndoManager::setMaxMemoryUsage)
+- UIViewSwitchContainer can cache its views (VSTGUI::UIViewSwitchContainer::setCachePolicy) and create the hidden views ahead of time (VSTGUI::UIViewSwitchContainer::setPreInstantiateViews)
+- UIDescription creates a hidden placeholder for views with the lazy-creation attribute and creates the views the first time the placeholder is shown, see VSTGUI::UIViewPlaceholder
+- CRowColumnView and other auto layout containers layout their children once in a layout pass of the frame instead of on every change (VSTGUI::CAutoLayoutContainerView::setNeedsLayout, VSTGUI::CFrame::getLayoutStatistics)
+- CViewContainer::setViewSize resizes the whole subview tree before the views are notified and invalidates the container once, see VSTGUI::CView::ResizeTransaction
+- IDependency and DispatchList do not allocate memory when notifying and allow to add and remove dependents and listeners while notifying
 
 @subsection version4_6 Version 4.6
 
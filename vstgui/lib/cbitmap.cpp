@@ -3,13 +3,114 @@
 // distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
 
 #include "cbitmap.h"
+#include "cbitmapcache.h"
 #include "cdrawcontext.h"
 #include "ccolor.h"
 #include "platform/iplatformbitmap.h"
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cmath>
 
 namespace VSTGUI {
 
+//-----------------------------------------------------------------------------
+namespace {
+
+//-----------------------------------------------------------------------------
+struct AreaWeights
+{
+	uint32_t first;
+	std::vector<float> weights;
+};
+
+//-----------------------------------------------------------------------------
+/** the weights of the source pixels which are covered by every destination pixel */
+std::vector<AreaWeights> calcAreaWeights (uint32_t srcSize, uint32_t dstSize)
+{
+	std::vector<AreaWeights> result (dstSize);
+	auto ratio = static_cast<double> (srcSize) / dstSize;
+	for (auto i = 0u; i < dstSize; ++i)
+	{
+		auto start = i * ratio;
+		auto end = std::min ((i + 1) * ratio, static_cast<double> (srcSize));
+		auto& area = result[i];
+		area.first = static_cast<uint32_t> (start);
+		for (auto pos = area.first; pos < end; ++pos)
+		{
+			auto coverage = std::min<double> (pos + 1, end) - std::max<double> (pos, start);
+			area.weights.emplace_back (static_cast<float> (coverage / (end - start)));
+		}
+	}
+	return result;
+}
+
+//-----------------------------------------------------------------------------
+/** downsample the pixels with an area average filter
+ *
+ *	The premultiplied pixels are averaged component wise, so the pixel format does not matter as
+ *	long as both bitmaps use the same.
+ */
+bool scalePlatformBitmap (IPlatformBitmap& src, IPlatformBitmap& dst)
+{
+	auto srcAccess = src.lockPixels (true);
+	auto dstAccess = dst.lockPixels (true);
+	if (!srcAccess || !dstAccess || srcAccess->getPixelFormat () != dstAccess->getPixelFormat ())
+		return false;
+	auto srcWidth = static_cast<uint32_t> (src.getSize ().x);
+	auto srcHeight = static_cast<uint32_t> (src.getSize ().y);
+	auto dstWidth = static_cast<uint32_t> (dst.getSize ().x);
+	auto dstHeight = static_cast<uint32_t> (dst.getSize ().y);
+	if (srcWidth == 0 || srcHeight == 0 || dstWidth == 0 || dstHeight == 0)
+		return false;
+
+	// horizontal pass into a temporary buffer
+	auto columns = calcAreaWeights (srcWidth, dstWidth);
+	std::vector<float> buffer (dstWidth * srcHeight * 4);
+	for (auto y = 0u; y < srcHeight; ++y)
+	{
+		auto srcRow = srcAccess->getAddress () + y * srcAccess->getBytesPerRow ();
+		auto bufferRow = buffer.data () + y * dstWidth * 4;
+		for (auto x = 0u; x < dstWidth; ++x)
+		{
+			const auto& column = columns[x];
+			auto pixel = srcRow + column.first * 4;
+			auto out = bufferRow + x * 4;
+			for (auto weight : column.weights)
+			{
+				for (auto c = 0u; c < 4; ++c)
+					out[c] += pixel[c] * weight;
+				pixel += 4;
+			}
+		}
+	}
+	// vertical pass into the destination
+	auto rows = calcAreaWeights (srcHeight, dstHeight);
+	for (auto y = 0u; y < dstHeight; ++y)
+	{
+		const auto& row = rows[y];
+		auto dstRow = dstAccess->getAddress () + y * dstAccess->getBytesPerRow ();
+		for (auto x = 0u; x < dstWidth; ++x)
+		{
+			float sum[4] = {};
+			auto in = buffer.data () + (row.first * dstWidth + x) * 4;
+			for (auto weight : row.weights)
+			{
+				for (auto c = 0u; c < 4; ++c)
+					sum[c] += in[c] * weight;
+				in += dstWidth * 4;
+			}
+			for (auto c = 0u; c < 4; ++c)
+				dstRow[x * 4 + c] =
+					static_cast<uint8_t> (std::min (255.f, std::round (sum[c])));
+		}
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+} // anonymous
+
 //-----------------------------------------------------------------------------
 // CBitmap Implementation
 //-----------------------------------------------------------------------------
@@ -77,6 +178,16 @@ CBitmap::CBitmap (const PlatformBitmapPtr& platformBitmap)
 	bitmaps.emplace_back (platformBitmap);
 }
 
+//-----------------------------------------------------------------------------
+CBitmap::~CBitmap () noexcept
+{
+	if (CBitmapCache::isDestroyed ())
+		return;
+	if (reloadFunction)
+		CBitmapCache::getInstance ().remove (this);
+	removeScaledBitmaps ();
+}
+
 //-----------------------------------------------------------------------------
 void CBitmap::draw (CDrawContext* context, const CRect& rect, const CPoint& offset, float alpha)
 {
@@ -90,22 +201,20 @@ void CBitmap::draw (CDrawContext* context, const CRect& rect, const CPoint& offs
 //-----------------------------------------------------------------------------
 CCoord CBitmap::getWidth () const
 {
-	if (auto pb = getPlatformBitmap ())
-		return pb->getSize ().x / pb->getScaleFactor ();
-	return 0;
+	return getSize ().x;
 }
 
 //-----------------------------------------------------------------------------
 CCoord CBitmap::getHeight () const
 {
-	if (auto pb = getPlatformBitmap ())
-		return pb->getSize ().y / pb->getScaleFactor ();
-	return 0;
+	return getSize ().y;
 }
 
 //------------------------------------------------------------------------
 CPoint CBitmap::getSize () const
 {
+	if (evicted)
+		return evictedSize;
 	CPoint p;
 	if (auto pb = getPlatformBitmap ())
 	{
@@ -120,21 +229,27 @@ CPoint CBitmap::getSize () const
 //-----------------------------------------------------------------------------
 auto CBitmap::getPlatformBitmap () const -> PlatformBitmapPtr
 {
+	use ();
 	return bitmaps.empty () ? nullptr : bitmaps[0];
 }
 
 //-----------------------------------------------------------------------------
 void CBitmap::setPlatformBitmap (const PlatformBitmapPtr& bitmap)
 {
+	use ();
+	removeScaledBitmaps ();
 	if (bitmaps.empty ())
 		bitmaps.emplace_back (bitmap);
 	else
 		bitmaps[0] = bitmap;
+	if (reloadFunction)
+		CBitmapCache::getInstance ().update (this);
 }
 
 //-----------------------------------------------------------------------------
 bool CBitmap::addBitmap (const PlatformBitmapPtr& platformBitmap)
 {
+	use ();
 	double scaleFactor = platformBitmap->getScaleFactor ();
 	CPoint size = getSize ();
 	CPoint bitmapSize = platformBitmap->getSize ();
@@ -153,13 +268,17 @@ bool CBitmap::addBitmap (const PlatformBitmapPtr& platformBitmap)
 			return false;
 		}
 	}
+	removeScaledBitmaps ();
 	bitmaps.emplace_back (platformBitmap);
+	if (reloadFunction)
+		CBitmapCache::getInstance ().update (this);
 	return true;
 }
 
 //-----------------------------------------------------------------------------
 auto CBitmap::getBestPlatformBitmapForScaleFactor (double scaleFactor) const -> PlatformBitmapPtr
 {
+	use ();
 	if (bitmaps.empty ())
 		return nullptr;
 	auto bestBitmap = bitmaps[0];
@@ -174,10 +293,141 @@ auto CBitmap::getBestPlatformBitmapForScaleFactor (double scaleFactor) const ->
 			bestDiff = std::abs (scaleFactor - bitmap->getScaleFactor ());
 		}
 	}
-
+	if (auto scaledBitmap = getScaledPlatformBitmap (bestBitmap, scaleFactor))
+		return scaledBitmap;
 	return bestBitmap;
 }
 
+//-----------------------------------------------------------------------------
+auto CBitmap::getScaledPlatformBitmap (const PlatformBitmapPtr& source, double scaleFactor) const
+	-> PlatformBitmapPtr
+{
+	auto& cache = CBitmapCache::getInstance ();
+	// only downsampling improves the quality, upsampled bitmaps would just use more memory
+	if (!scaledBitmapsAllowed || cache.getScaledBitmapBudget () == 0 || scaleFactor <= 0. ||
+	    source->getScaleFactor () <= scaleFactor)
+		return nullptr;
+	auto self = const_cast<CBitmap*> (this);
+	for (const auto& bitmap : scaledBitmaps)
+	{
+		if (bitmap->getScaleFactor () == scaleFactor)
+		{
+			cache.useScaled (self);
+			return bitmap;
+		}
+	}
+	// a scale factor which changes on every draw (i.e. while animating a zoom) is not worth the
+	// scaling
+	if (lastScaleFactor != scaleFactor)
+	{
+		lastScaleFactor = scaleFactor;
+		return nullptr;
+	}
+	auto size = getSize ();
+	size.x = std::round (size.x * scaleFactor);
+	size.y = std::round (size.y * scaleFactor);
+	auto bytes = static_cast<uint64_t> (size.x) * static_cast<uint64_t> (size.y) * 4;
+	if (size.x < 1. || size.y < 1. || bytes > cache.getScaledBitmapBudget ())
+		return nullptr;
+	auto bitmap = IPlatformBitmap::create (&size);
+	if (!bitmap || !scalePlatformBitmap (*source, *bitmap))
+		return nullptr;
+	bitmap->setScaleFactor (scaleFactor);
+	scaledBitmaps.emplace_back (bitmap);
+	cache.addScaled (self, bytes);
+	return bitmap;
+}
+
+//-----------------------------------------------------------------------------
+void CBitmap::removeScaledBitmaps ()
+{
+	lastScaleFactor = 0.;
+	if (!scaledBitmaps.empty ())
+		CBitmapCache::getInstance ().removeScaled (this);
+}
+
+//-----------------------------------------------------------------------------
+void CBitmap::disableScaledBitmaps ()
+{
+	removeScaledBitmaps ();
+	scaledBitmapsAllowed = false;
+}
+
+//-----------------------------------------------------------------------------
+void CBitmap::setReloadFunction (ReloadFunction&& func)
+{
+	auto& cache = CBitmapCache::getInstance ();
+	if (reloadFunction)
+	{
+		// an unmanaged bitmap must have its pixels
+		if (evicted)
+			reload ();
+		cache.remove (this);
+	}
+	reloadFunction = std::move (func);
+	if (reloadFunction)
+		cache.add (this);
+}
+
+//-----------------------------------------------------------------------------
+void CBitmap::use () const
+{
+	if (!reloadFunction)
+		return;
+	auto self = const_cast<CBitmap*> (this);
+	if (evicted)
+		self->reload ();
+	else
+	{
+		// without a budget the order of use is not needed
+		auto& cache = CBitmapCache::getInstance ();
+		if (cache.getBudget () != 0)
+			cache.use (self);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void CBitmap::evict ()
+{
+	// don't use getSize () here, it would mark the bitmap as used
+	evictedSize = {};
+	if (!bitmaps.empty ())
+	{
+		auto scaleFactor = bitmaps[0]->getScaleFactor ();
+		evictedSize = bitmaps[0]->getSize ();
+		evictedSize.x /= scaleFactor;
+		evictedSize.y /= scaleFactor;
+	}
+	bitmaps.clear ();
+	removeScaledBitmaps ();
+	evicted = true;
+}
+
+//-----------------------------------------------------------------------------
+void CBitmap::reload ()
+{
+	using Clock = std::chrono::steady_clock;
+	auto start = Clock::now ();
+	// a failing reload function is not called again on every access
+	evicted = false;
+	if (auto bitmap = reloadFunction ())
+		bitmaps = bitmap->bitmaps;
+	std::chrono::duration<double, std::micro> duration = Clock::now () - start;
+	CBitmapCache::getInstance ().reloaded (this, duration.count ());
+}
+
+//-----------------------------------------------------------------------------
+uint64_t CBitmap::getPlatformBitmapBytes () const
+{
+	uint64_t bytes = 0;
+	for (const auto& bitmap : bitmaps)
+	{
+		auto size = bitmap->getSize ();
+		bytes += static_cast<uint64_t> (size.x) * static_cast<uint64_t> (size.y) * 4;
+	}
+	return bytes;
+}
+
 //-----------------------------------------------------------------------------
 // CNinePartTiledBitmap Implementation
 //-----------------------------------------------------------------------------
@@ -228,6 +478,69 @@ void CNinePartTiledBitmap::draw (CDrawContext* inContext, const CRect& inDestRec
 	inContext->drawBitmapNinePartTiled (this, inDestRect, offsets, inAlpha);
 }
 
+//-----------------------------------------------------------------------------
+// CAtlasBitmap Implementation
+//-----------------------------------------------------------------------------
+/*! @class CAtlasBitmap
+An atlas bitmap is usually created by the UIDescription for bitmaps which reference a region of
+an atlas bitmap:
+@code
+<bitmap name="knob" atlas="skin-atlas" frame-size="64, 64">
+	<frame region="0, 0, 60, 62" offset="2, 1"/>
+	<frame region="61, 0, 121, 62" offset="2, 1"/>
+</bitmap>
+@endcode
+All atlas bitmaps of an atlas draw through the platform bitmaps of the atlas, so only one
+surface is needed for all of them. Atlases can be created with the ImageStitcher tool.
+*/
+//-----------------------------------------------------------------------------
+CAtlasBitmap::CAtlasBitmap (CBitmap* atlas, const CPoint& frameSize, const FrameList& frames)
+: atlas (atlas)
+, frameSize (frameSize)
+, frames (frames)
+{
+}
+
+//-----------------------------------------------------------------------------
+CPoint CAtlasBitmap::getSize () const
+{
+	return CPoint (frameSize.x, frameSize.y * frames.size ());
+}
+
+//-----------------------------------------------------------------------------
+void CAtlasBitmap::draw (CDrawContext* context, const CRect& rect, const CPoint& offset, float alpha)
+{
+	if (!atlas || frames.empty () || frameSize.y <= 0.)
+		return;
+	CRect clipRect;
+	context->getClipRect (clipRect);
+	clipRect.bound (rect);
+	if (clipRect.isEmpty ())
+		return;
+
+	// the visible part in the coordinates of the stacked frames
+	CRect source (clipRect);
+	source.offset (offset.x - rect.left, offset.y - rect.top);
+
+	auto firstFrame = static_cast<size_t> (std::max (0., std::floor (source.top / frameSize.y)));
+	auto lastFrame = static_cast<size_t> (std::max (0., std::ceil (source.bottom / frameSize.y)));
+	lastFrame = std::min (lastFrame, frames.size ());
+	for (auto index = firstFrame; index < lastFrame; ++index)
+	{
+		const auto& frame = frames[index];
+		CRect frameRect (CPoint (frame.offset.x, frame.offset.y + index * frameSize.y),
+		                 frame.region.getSize ());
+		CRect visibleRect (frameRect);
+		visibleRect.bound (source);
+		if (visibleRect.isEmpty ())
+			continue;
+		CPoint atlasOffset (frame.region.left + visibleRect.left - frameRect.left,
+		                    frame.region.top + visibleRect.top - frameRect.top);
+		visibleRect.offset (rect.left - offset.x, rect.top - offset.y);
+		context->drawBitmap (atlas, visibleRect, atlasOffset, alpha);
+	}
+}
+
 //------------------------------------------------------------------------
 //------------------------------------------------------------------------
 //------------------------------------------------------------------------
@@ -286,6 +599,7 @@ CBitmapPixelAccess* CBitmapPixelAccess::create (CBitmap* bitmap, bool alphaPremu
 {
 	if (bitmap == nullptr || bitmap->getPlatformBitmap () == nullptr)
 		return nullptr;
+	bitmap->disableScaledBitmaps ();
 	auto pixelAccess = bitmap->getPlatformBitmap ()->lockPixels (alphaPremultiplied);
 	if (pixelAccess == nullptr)
 		return nullptr;
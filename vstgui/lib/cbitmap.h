@@ -10,6 +10,7 @@
 #include "crect.h"
 #include "cresourcedescription.h"
 #include "platform/iplatformbitmap.h"
+#include <functional>
 #include <vector>
 
 namespace VSTGUI {
@@ -30,7 +31,7 @@ public:
 	/** Create an image with a given size and scale factor */
 	CBitmap (CPoint size, double scaleFactor = 1.);
 	explicit CBitmap (const PlatformBitmapPtr& platformBitmap);
-	~CBitmap () noexcept override = default;
+	~CBitmap () noexcept override;
 
 	//-----------------------------------------------------------------------------
 	/// @name CBitmap Methods
@@ -43,10 +44,10 @@ public:
 	/** get the height of the image */
 	CCoord getHeight () const;
 	/** get size of image */
-	CPoint getSize () const;
+	virtual CPoint getSize () const;
 
-	/** check if image is loaded */
-	bool isLoaded () const { return getPlatformBitmap () ? true : false; }
+	/** check if image is loaded, an evicted bitmap is loaded again */
+	virtual bool isLoaded () const { return getPlatformBitmap () ? true : false; }
 
 	const CResourceDescription& getResourceDescription () const { return resourceDesc; }
 
@@ -54,9 +55,39 @@ public:
 	void setPlatformBitmap (const PlatformBitmapPtr& bitmap);
 
 	bool addBitmap (const PlatformBitmapPtr& platformBitmap);
+	/** get the platform bitmap which fits best to the scale factor.
+	 *
+	 *	If there is no platform bitmap with this scale factor and the CBitmapCache has a scaled
+	 *	bitmap budget, a downsampled platform bitmap for the scale factor is generated when the
+	 *	scale factor is requested the second time in a row.
+	 */
 	PlatformBitmapPtr getBestPlatformBitmapForScaleFactor (double scaleFactor) const;
 	//@}
 
+	//-----------------------------------------------------------------------------
+	/// @name Memory Budget
+	//-----------------------------------------------------------------------------
+	//@{
+	using ReloadFunction = std::function<SharedPointer<CBitmap> ()>;
+
+	/** set the function which decodes the platform bitmaps of this bitmap again.
+	 *
+	 *	A bitmap with a reload function is managed by the CBitmapCache and its platform bitmaps
+	 *	may get evicted when they were not used for some time. The reload function must return
+	 *	a bitmap with the same size whose platform bitmaps are taken over.
+	 *	@ingroup new_in_4_7
+	 */
+	void setReloadFunction (ReloadFunction&& func);
+	/** check if the bitmap has a reload function
+	 *	@ingroup new_in_4_7
+	 */
+	bool isReloadable () const { return reloadFunction != nullptr; }
+	/** check if the platform bitmaps were evicted by the CBitmapCache
+	 *	@ingroup new_in_4_7
+	 */
+	bool isEvicted () const { return evicted; }
+	//@}
+
 //-----------------------------------------------------------------------------
 protected:
 	CBitmap ();
@@ -64,6 +95,30 @@ protected:
 	CResourceDescription resourceDesc;
 	using BitmapVector = std::vector<PlatformBitmapPtr>;
 	BitmapVector bitmaps;
+
+private:
+	friend class CBitmapCache;
+	friend class CBitmapPixelAccess;
+	friend class COffscreenContext;
+
+	void use () const;
+	void evict ();
+	void reload ();
+	uint64_t getPlatformBitmapBytes () const;
+
+	PlatformBitmapPtr getScaledPlatformBitmap (const PlatformBitmapPtr& source,
+	                                           double scaleFactor) const;
+	void removeScaledBitmaps ();
+	/** bitmaps whose pixels change must not be scaled */
+	void disableScaledBitmaps ();
+
+	ReloadFunction reloadFunction;
+	CPoint evictedSize;
+	bool evicted {false};
+
+	mutable BitmapVector scaledBitmaps;
+	mutable double lastScaleFactor {0.};
+	bool scaledBitmapsAllowed {true};
 };
 
 //-----------------------------------------------------------------------------
@@ -143,6 +198,59 @@ protected:
 	CNinePartTiledDescription offsets;
 };
 
+//-----------------------------------------------------------------------------
+// CAtlasBitmap Declaration
+/// @brief a stacked bitmap whose frames are regions of a shared atlas bitmap
+///
+/// The bitmap behaves like a filmstrip of frames with the same size stacked vertically, but the
+/// pixels of the frames are drawn from the regions of the atlas. Transparent borders of the
+/// frames can be trimmed away in the atlas, the offset of a frame describes where its region is
+/// placed inside the frame.
+///
+/// As the pixels live in the atlas, the atlas bitmap has no platform bitmap on its own. The draw
+/// contexts resolve it through the atlas when it is passed to CDrawContext::drawBitmap or
+/// CDrawContext::fillRectWithBitmap, and it is loaded when its atlas is loaded.
+/// @ingroup new_in_4_7
+//-----------------------------------------------------------------------------
+class CAtlasBitmap : public CBitmap
+{
+public:
+	struct Frame
+	{
+		/** the region of the frame in the atlas */
+		CRect region;
+		/** the position of the region inside the frame */
+		CPoint offset;
+
+		Frame () = default;
+		Frame (const CRect& region, const CPoint& offset = CPoint ()) : region (region), offset (offset) {}
+	};
+	using FrameList = std::vector<Frame>;
+
+	CAtlasBitmap (CBitmap* atlas, const CPoint& frameSize, const FrameList& frames);
+	~CAtlasBitmap () noexcept override = default;
+
+	//-----------------------------------------------------------------------------
+	/// @name Atlas
+	//-----------------------------------------------------------------------------
+	//@{
+	CBitmap* getAtlas () const { return atlas; }
+	const CPoint& getFrameSize () const { return frameSize; }
+	const FrameList& getFrames () const { return frames; }
+	//@}
+
+	void draw (CDrawContext* context, const CRect& rect, const CPoint& offset = CPoint (0, 0), float alpha = 1.f) override;
+	bool isLoaded () const override { return atlas && atlas->isLoaded (); }
+	/** the size of all frames stacked vertically */
+	CPoint getSize () const override;
+
+//-----------------------------------------------------------------------------
+protected:
+	SharedPointer<CBitmap> atlas;
+	CPoint frameSize;
+	FrameList frames;
+};
+
 //------------------------------------------------------------------------
 // CBitmapPixelAccess
 /// @brief direct pixel access to a CBitmap
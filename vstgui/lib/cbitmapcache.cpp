@@ -0,0 +1,254 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "cbitmapcache.h"
+#include "cbitmap.h"
+#include <algorithm>
+
+namespace VSTGUI {
+
+//-----------------------------------------------------------------------------
+static bool gBitmapCacheDestroyed = false;
+
+//-----------------------------------------------------------------------------
+CBitmapCache& CBitmapCache::getInstance ()
+{
+	static CBitmapCache gInstance;
+	return gInstance;
+}
+
+//-----------------------------------------------------------------------------
+CBitmapCache::~CBitmapCache () noexcept
+{
+	// bitmaps which are destroyed after the cache must not access it anymore
+	gBitmapCacheDestroyed = true;
+}
+
+//-----------------------------------------------------------------------------
+bool CBitmapCache::isDestroyed ()
+{
+	return gBitmapCacheDestroyed;
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::setBudget (uint64_t bytes)
+{
+	budget = bytes;
+	applyBudget ();
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::trim (uint64_t maxBytes)
+{
+	for (auto it = lru.rbegin (); it != lru.rend () && statistics.residentBytes > maxBytes; ++it)
+		evict (*it);
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::beginFrame (const CFrame* frame)
+{
+	drawingFrame = frame;
+	currentDraw = lastDraws[frame] = ++drawCounter;
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::endFrame (const CFrame* frame)
+{
+	applyBudget ();
+	if (frame == drawingFrame)
+		drawingFrame = nullptr;
+	currentDraw = lastDraws[nullptr] = ++drawCounter;
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::removeFrame (const CFrame* frame)
+{
+	lastDraws.erase (frame);
+	if (frame == drawingFrame)
+	{
+		drawingFrame = nullptr;
+		currentDraw = lastDraws[nullptr];
+	}
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::setScaledBitmapBudget (uint64_t bytes)
+{
+	scaledBudget = bytes;
+	if (scaledBudget == 0)
+	{
+		while (!scaledLru.empty ())
+			removeScaled (scaledLru.back ());
+	}
+	else
+		applyScaledBudget ();
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::resetStatistics ()
+{
+	statistics.numEvictions = 0;
+	statistics.numReloads = 0;
+	statistics.reloadTime = 0.;
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::applyBudget ()
+{
+	if (budget == 0 || statistics.residentBytes <= budget)
+		return;
+	for (auto it = lru.rbegin (); it != lru.rend () && statistics.residentBytes > budget; ++it)
+	{
+		if (!isUsedInLastDraw (entries.find (*it)->second))
+			evict (*it);
+	}
+}
+
+//-----------------------------------------------------------------------------
+bool CBitmapCache::isUsedInLastDraw (const Entry& entry) const
+{
+	for (const auto& use : entry.uses)
+	{
+		auto it = lastDraws.find (use.frame);
+		if (it != lastDraws.end () && it->second == use.draw)
+			return true;
+	}
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::applyScaledBudget ()
+{
+	// the most recently used bitmap is drawn right now and keeps its scaled bitmaps
+	while (scaledLru.size () > 1 && statistics.scaledBytes > scaledBudget)
+		removeScaled (scaledLru.back ());
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::add (CBitmap* bitmap)
+{
+	Entry entry;
+	entry.lruPos = lru.insert (lru.begin (), bitmap);
+	entry.bytes = bitmap->getPlatformBitmapBytes ();
+	entries.emplace (bitmap, entry);
+	statistics.residentBytes += entry.bytes;
+	++statistics.numBitmaps;
+	if (bitmap->isEvicted ())
+		++statistics.numEvictedBitmaps;
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::remove (CBitmap* bitmap)
+{
+	auto it = entries.find (bitmap);
+	if (it == entries.end ())
+		return;
+	statistics.residentBytes -= it->second.bytes;
+	--statistics.numBitmaps;
+	if (bitmap->isEvicted ())
+		--statistics.numEvictedBitmaps;
+	lru.erase (it->second.lruPos);
+	entries.erase (it);
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::use (CBitmap* bitmap)
+{
+	auto it = entries.find (bitmap);
+	if (it == entries.end ())
+		return;
+	auto& uses = it->second.uses;
+	auto useIt = std::find_if (uses.begin (), uses.end (),
+	                           [&] (const Use& u) { return u.frame == drawingFrame; });
+	if (useIt != uses.end ())
+		useIt->draw = currentDraw;
+	else
+	{
+		// forget the uses of removed frames
+		uses.erase (std::remove_if (uses.begin (), uses.end (), [&] (const Use& u) {
+			            return lastDraws.find (u.frame) == lastDraws.end ();
+		            }), uses.end ());
+		uses.push_back ({drawingFrame, currentDraw});
+	}
+	if (it->second.lruPos != lru.begin ())
+		lru.splice (lru.begin (), lru, it->second.lruPos);
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::update (CBitmap* bitmap)
+{
+	auto it = entries.find (bitmap);
+	if (it == entries.end ())
+		return;
+	auto bytes = bitmap->getPlatformBitmapBytes ();
+	statistics.residentBytes -= it->second.bytes;
+	statistics.residentBytes += bytes;
+	it->second.bytes = bytes;
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::reloaded (CBitmap* bitmap, double duration)
+{
+	++statistics.numReloads;
+	statistics.reloadTime += duration;
+	--statistics.numEvictedBitmaps;
+	use (bitmap);
+	update (bitmap);
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::addScaled (CBitmap* bitmap, uint64_t bytes)
+{
+	auto it = scaledEntries.find (bitmap);
+	if (it == scaledEntries.end ())
+	{
+		Entry entry;
+		entry.lruPos = scaledLru.insert (scaledLru.begin (), bitmap);
+		it = scaledEntries.emplace (bitmap, entry).first;
+	}
+	else
+		useScaled (bitmap);
+	it->second.bytes += bytes;
+	statistics.scaledBytes += bytes;
+	++statistics.numScaledBitmaps;
+	applyScaledBudget ();
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::useScaled (CBitmap* bitmap)
+{
+	auto it = scaledEntries.find (bitmap);
+	if (it == scaledEntries.end ())
+		return;
+	if (it->second.lruPos != scaledLru.begin ())
+		scaledLru.splice (scaledLru.begin (), scaledLru, it->second.lruPos);
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::removeScaled (CBitmap* bitmap)
+{
+	auto it = scaledEntries.find (bitmap);
+	if (it == scaledEntries.end ())
+		return;
+	statistics.scaledBytes -= it->second.bytes;
+	statistics.numScaledBitmaps -= bitmap->scaledBitmaps.size ();
+	bitmap->scaledBitmaps.clear ();
+	scaledLru.erase (it->second.lruPos);
+	scaledEntries.erase (it);
+}
+
+//-----------------------------------------------------------------------------
+void CBitmapCache::evict (CBitmap* bitmap)
+{
+	auto it = entries.find (bitmap);
+	if (it == entries.end () || bitmap->isEvicted ())
+		return;
+	bitmap->evict ();
+	statistics.residentBytes -= it->second.bytes;
+	it->second.bytes = 0;
+	++statistics.numEvictions;
+	++statistics.numEvictedBitmaps;
+}
+
+} // namespace
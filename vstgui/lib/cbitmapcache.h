@@ -0,0 +1,151 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#ifndef __cbitmapcache__
+#define __cbitmapcache__
+
+#include "vstguifwd.h"
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace VSTGUI {
+
+//-----------------------------------------------------------------------------
+/** @brief Process wide memory budget for decoded bitmaps
+ *
+ *	Bitmaps which have a reload function (see CBitmap::setReloadFunction) are managed by the
+ *	cache. The cache knows how many bytes their platform bitmaps use and in which order they
+ *	were used. The budget is applied after a frame was drawn (see endFrame) and not while
+ *	drawing: when the resident bytes exceed the budget, the platform bitmaps of the least
+ *	recently used bitmaps are evicted. Bitmaps used in the last draw of any frame are never
+ *	evicted, so the bitmaps of hidden views and of templates which are not shown are evicted
+ *	and the budget is exceeded if the visible bitmaps need more memory. As the use is recorded
+ *	per frame, the editors of different plug-ins do not evict the bitmaps of each other. An evicted bitmap keeps
+ *	its size and is decoded again via its reload function when its platform bitmap is needed
+ *	again.
+ *
+ *	The UIDescription makes all its bitmaps reloadable.
+ *
+ *	The default budget is zero, which means no bitmaps are evicted. The cache must only be used
+ *	from the UI thread.
+ *
+ *	The cache also has a separate budget for scaled bitmaps. When a bitmap is drawn more than
+ *	once at a scale factor for which it has no platform bitmap, it generates a downsampled
+ *	platform bitmap for exactly this scale factor, so that it does not need to be scaled on every
+ *	draw. When the scaled bitmaps exceed their budget, the scaled bitmaps of the least recently
+ *	used bitmaps are removed. The default scaled bitmap budget is zero, which disables the
+ *	generation of scaled bitmaps.
+ *
+ *	@ingroup new_in_4_7
+ */
+//-----------------------------------------------------------------------------
+class CBitmapCache
+{
+public:
+	struct Statistics
+	{
+		/** bytes used by the platform bitmaps of the managed bitmaps */
+		uint64_t residentBytes {0};
+		/** number of managed bitmaps */
+		uint64_t numBitmaps {0};
+		/** number of managed bitmaps which are currently evicted */
+		uint64_t numEvictedBitmaps {0};
+		uint64_t numEvictions {0};
+		uint64_t numReloads {0};
+		/** time spent in the reload functions in microseconds */
+		double reloadTime {0.};
+		/** bytes used by the generated scaled bitmaps */
+		uint64_t scaledBytes {0};
+		/** number of generated scaled bitmaps */
+		uint64_t numScaledBitmaps {0};
+	};
+
+	static CBitmapCache& getInstance ();
+
+	/** set the budget in bytes, zero means unlimited */
+	void setBudget (uint64_t bytes);
+	uint64_t getBudget () const { return budget; }
+
+	/** evict least recently used bitmaps until the resident bytes are not more than maxBytes */
+	void trim (uint64_t maxBytes);
+
+	/** start recording the bitmaps used by the frame.
+	 *
+	 *	CFrame calls this before it draws.
+	 */
+	void beginFrame (const CFrame* frame);
+	/** stop recording the bitmaps used by the frame and apply the budget.
+	 *
+	 *	CFrame calls this after it has drawn. The bitmaps used in the last draw of a frame are
+	 *	not evicted. Bitmaps used outside of a draw are recorded for the nullptr frame and are
+	 *	not evicted until endFrame is called the next time.
+	 */
+	void endFrame (const CFrame* frame = nullptr);
+
+	/** set the budget in bytes for the scaled bitmaps, zero disables scaled bitmaps */
+	void setScaledBitmapBudget (uint64_t bytes);
+	uint64_t getScaledBitmapBudget () const { return scaledBudget; }
+
+	const Statistics& getStatistics () const { return statistics; }
+	/** reset the eviction and reload counters */
+	void resetStatistics ();
+
+	~CBitmapCache () noexcept;
+private:
+	CBitmapCache () = default;
+
+	friend class CBitmap;
+	friend class CFrame;
+	static bool isDestroyed ();
+	void removeFrame (const CFrame* frame);
+	void add (CBitmap* bitmap);
+	void remove (CBitmap* bitmap);
+	void use (CBitmap* bitmap);
+	void update (CBitmap* bitmap);
+	void reloaded (CBitmap* bitmap, double duration);
+
+	void addScaled (CBitmap* bitmap, uint64_t bytes);
+	void useScaled (CBitmap* bitmap);
+	void removeScaled (CBitmap* bitmap);
+
+	struct Use
+	{
+		const CFrame* frame;
+		uint64_t draw;
+	};
+
+	struct Entry
+	{
+		std::list<CBitmap*>::iterator lruPos;
+		uint64_t bytes {0};
+		/** the draw of each frame in which the bitmap was used the last time */
+		std::vector<Use> uses;
+	};
+
+	void evict (CBitmap* bitmap);
+	bool isUsedInLastDraw (const Entry& entry) const;
+	void applyBudget ();
+	void applyScaledBudget ();
+
+	uint64_t budget {0};
+	uint64_t drawCounter {1};
+	const CFrame* drawingFrame {nullptr};
+	/** the draw in which the bitmaps are used now */
+	uint64_t currentDraw {1};
+	/** the last draw of each frame */
+	std::unordered_map<const CFrame*, uint64_t> lastDraws {{nullptr, 1}};
+	Statistics statistics;
+	/** most recently used bitmap first */
+	std::list<CBitmap*> lru;
+	std::unordered_map<CBitmap*, Entry> entries;
+
+	uint64_t scaledBudget {0};
+	std::list<CBitmap*> scaledLru;
+	std::unordered_map<CBitmap*, Entry> scaledEntries;
+};
+
+} // namespace
+
+#endif // __cbitmapcache__
@@ -12,6 +12,7 @@
 #include "idatabrowserdelegate.h"
 #include <cmath>
 #include <algorithm>
+#include <limits>
 
 namespace VSTGUI {
 
@@ -46,9 +47,12 @@ public:
 	bool drawFocusOnTop () override;
 	bool getFocusPath (CGraphicsPath& outPath) override;
 protected:
+	void updateColumnOffsets (CCoord lineWidth);
 
 	IDataBrowserDelegate* db;
 	CDataBrowser* browser;
+	/** left edge of every column relative to the view plus the right edge of the last column */
+	std::vector<CCoord> columnOffsets;
 };
 
 //-----------------------------------------------------------------------------------------------
@@ -361,6 +365,136 @@ void CDataBrowser::makeRowVisible (int32_t row)
 	makeRectVisible (r);
 }
 
+//-----------------------------------------------------------------------------------------------
+bool CDataBrowser::RowSet::contains (int32_t row) const
+{
+	auto it = ranges.upper_bound (row);
+	if (it == ranges.begin ())
+		return false;
+	--it;
+	return row <= it->second;
+}
+
+//-----------------------------------------------------------------------------------------------
+void CDataBrowser::RowSet::add (int32_t first, int32_t last)
+{
+	if (first > last)
+		return;
+	// merge with the overlapping or adjacent ranges
+	auto it = ranges.upper_bound (first);
+	if (it != ranges.begin ())
+	{
+		auto prev = std::prev (it);
+		if (static_cast<int64_t> (prev->second) + 1 >= first)
+		{
+			first = prev->first;
+			last = std::max (last, prev->second);
+			count -= static_cast<uint32_t> (prev->second - prev->first) + 1;
+			ranges.erase (prev);
+		}
+	}
+	while (it != ranges.end () && it->first <= static_cast<int64_t> (last) + 1)
+	{
+		last = std::max (last, it->second);
+		count -= static_cast<uint32_t> (it->second - it->first) + 1;
+		it = ranges.erase (it);
+	}
+	ranges.emplace (first, last);
+	count += static_cast<uint32_t> (last - first) + 1;
+}
+
+//-----------------------------------------------------------------------------------------------
+void CDataBrowser::RowSet::remove (int32_t first, int32_t last)
+{
+	if (first > last || ranges.empty ())
+		return;
+	auto it = ranges.upper_bound (first);
+	if (it != ranges.begin ())
+		--it;
+	while (it != ranges.end () && it->first <= last)
+	{
+		auto rangeFirst = it->first;
+		auto rangeLast = it->second;
+		if (rangeLast < first)
+		{
+			++it;
+			continue;
+		}
+		count -= static_cast<uint32_t> (rangeLast - rangeFirst) + 1;
+		it = ranges.erase (it);
+		if (rangeFirst < first)
+		{
+			ranges.emplace (rangeFirst, first - 1);
+			count += static_cast<uint32_t> (first - rangeFirst);
+		}
+		if (rangeLast > last)
+		{
+			ranges.emplace (last + 1, rangeLast);
+			count += static_cast<uint32_t> (rangeLast - last);
+			break;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------------------------
+void CDataBrowser::RowSet::clear ()
+{
+	ranges.clear ();
+	count = 0;
+}
+
+//-----------------------------------------------------------------------------------------------
+int32_t CDataBrowser::RowSet::first () const
+{
+	return ranges.empty () ? kNoSelection : ranges.begin ()->first;
+}
+
+//-----------------------------------------------------------------------------------------------
+void CDataBrowser::invalidateRows (int32_t first, int32_t last)
+{
+	CRect r = dbView->getRowBounds (first);
+	r.unite (dbView->getRowBounds (last));
+	dbView->invalidRect (r);
+}
+
+//-----------------------------------------------------------------------------------------------
+void CDataBrowser::addToSelectionOrder (int32_t first, int32_t last)
+{
+	if (!selectionOrder.empty () && selectionOrder.back ().second + 1 == first)
+		selectionOrder.back ().second = last;
+	else
+		selectionOrder.emplace_back (first, last);
+}
+
+//-----------------------------------------------------------------------------------------------
+void CDataBrowser::removeFromSelectionOrder (int32_t first, int32_t last)
+{
+	for (auto it = selectionOrder.begin (); it != selectionOrder.end ();)
+	{
+		auto rangeFirst = it->first;
+		auto rangeLast = it->second;
+		if (rangeLast < first || rangeFirst > last)
+		{
+			++it;
+			continue;
+		}
+		it = selectionOrder.erase (it);
+		if (rangeFirst < first)
+			it = std::next (selectionOrder.emplace (it, rangeFirst, first - 1));
+		if (rangeLast > last)
+			it = std::next (selectionOrder.emplace (it, last + 1, rangeLast));
+	}
+}
+
+//-----------------------------------------------------------------------------------------------
+void CDataBrowser::updateLastSelectedRow ()
+{
+	// the anchor falls back to the row that was selected most recently
+	if (lastSelectedRow == kNoSelection || selectedRows.contains (lastSelectedRow))
+		return;
+	lastSelectedRow = selectionOrder.empty () ? kNoSelection : selectionOrder.back ().second;
+}
+
 //-----------------------------------------------------------------------------------------------
 /**
  * @param index row to select
@@ -377,25 +511,18 @@ void CDataBrowser::setSelectedRow (int32_t index, bool makeVisible)
 	if (index >= numRows)
 		index = numRows-1;
 
-	bool hasChanged = true;
-	Selection::iterator alreadySelected = std::find (selection.begin (), selection.end (), index);
-	if (alreadySelected != selection.end ())
-	{
-		selection.erase (alreadySelected);
-		hasChanged = selection.size () > 0;
-	}
-	else
-	{
+	bool hasChanged = !(selectedRows.size () == 1 && selectedRows.contains (index));
+	if (!selectedRows.contains (index))
 		invalidateRow (index);
-	}
-	
-	for (auto row : selection)
-	{
-		dbView->invalidateRow (row);
-	}
-	selection.clear ();
-	
-	selection.emplace_back (index);
+	selectedRows.forEachRange ([&] (int32_t first, int32_t last) {
+		invalidateRows (first, last);
+	});
+	selectedRows.clear ();
+	selectedRows.add (index);
+	selectionOrder.clear ();
+	selectionOrder.emplace_back (index, index);
+	lastSelectedRow = index;
+	selectionValid = false;
 	if (hasChanged)
 		db->dbSelectionChanged (this);
 	
@@ -406,9 +533,24 @@ void CDataBrowser::setSelectedRow (int32_t index, bool makeVisible)
 //-----------------------------------------------------------------------------------------------
 int32_t CDataBrowser::getSelectedRow () const
 {
-	if (selection.size () > 0)
-		return selection[0];
-	return kNoSelection;
+	return selectionOrder.empty () ? kNoSelection : selectionOrder.front ().first;
+}
+
+//-----------------------------------------------------------------------------------------------
+auto CDataBrowser::getSelection () const -> const Selection&
+{
+	if (!selectionValid)
+	{
+		selection.clear ();
+		selection.reserve (selectedRows.size ());
+		for (const auto& range : selectionOrder)
+		{
+			for (auto row = range.first; row <= range.second; ++row)
+				selection.emplace_back (row);
+		}
+		selectionValid = true;
+	}
+	return selection;
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -416,12 +558,14 @@ void CDataBrowser::selectRow (int32_t row)
 {
 	if (row > db->dbGetNumRows (this))
 		return;
-	Selection::iterator alreadySelected = std::find (selection.begin (), selection.end (), row);
-	if (alreadySelected == selection.end ())
+	if (!selectedRows.contains (row))
 	{
 		if (getStyle () & kMultiSelectionStyle)
 		{
-			selection.emplace_back (row);
+			selectedRows.add (row);
+			addToSelectionOrder (row, row);
+			lastSelectedRow = row;
+			selectionValid = false;
 			dbView->invalidateRow (row);
 			db->dbSelectionChanged (this);
 		}
@@ -432,17 +576,57 @@ void CDataBrowser::selectRow (int32_t row)
 	}
 }
 
+//-----------------------------------------------------------------------------------------------
+/**
+ * @param first first row to select
+ * @param last last row to select
+ *
+ * the delegate is notified once for the whole range
+ */
+void CDataBrowser::selectRows (int32_t first, int32_t last)
+{
+	if (!(getStyle () & kMultiSelectionStyle))
+		return;
+	if (first > last)
+		std::swap (first, last);
+	first = std::max<int32_t> (first, 0);
+	last = std::min<int32_t> (last, db->dbGetNumRows (this) - 1);
+	if (first > last)
+		return;
+	// only the rows which were not selected before are appended to the selection order
+	auto next = first;
+	selectedRows.forEachRange ([&] (int32_t rangeFirst, int32_t rangeLast) {
+		if (rangeLast < next || rangeFirst > last)
+			return;
+		if (rangeFirst > next)
+			addToSelectionOrder (next, rangeFirst - 1);
+		next = rangeLast + 1;
+	});
+	if (next <= last)
+		addToSelectionOrder (next, last);
+	auto prevSize = selectedRows.size ();
+	selectedRows.add (first, last);
+	if (selectedRows.size () != prevSize)
+	{
+		selectionValid = false;
+		invalidateRows (first, last);
+		db->dbSelectionChanged (this);
+	}
+}
+
 //-----------------------------------------------------------------------------------------------
 void CDataBrowser::unselectRow (int32_t row)
 {
 	if (row > db->dbGetNumRows (this))
 		return;
-	Selection::iterator alreadySelected = std::find (selection.begin (), selection.end (), row);
-	if (alreadySelected != selection.end ())
+	if (selectedRows.contains (row))
 	{
 		if (getStyle () & kMultiSelectionStyle)
 		{
-			selection.erase (alreadySelected);
+			selectedRows.remove (row);
+			removeFromSelectionOrder (row, row);
+			updateLastSelectedRow ();
+			selectionValid = false;
 			dbView->invalidateRow (row);
 			db->dbSelectionChanged (this);
 		}
@@ -456,13 +640,15 @@ void CDataBrowser::unselectRow (int32_t row)
 //-----------------------------------------------------------------------------------------------
 void CDataBrowser::unselectAll ()
 {
-	if (selection.size () > 0)
+	if (!selectedRows.empty ())
 	{
-		for (auto row : selection)
-		{
-			dbView->invalidateRow (row);
-		}
-		selection.clear ();
+		selectedRows.forEachRange ([&] (int32_t first, int32_t last) {
+			invalidateRows (first, last);
+		});
+		selectedRows.clear ();
+		selectionOrder.clear ();
+		lastSelectedRow = kNoSelection;
+		selectionValid = false;
 		db->dbSelectionChanged (this);
 	}
 }
@@ -470,22 +656,16 @@ void CDataBrowser::unselectAll ()
 //-----------------------------------------------------------------------------------------------
 void CDataBrowser::validateSelection ()
 {
-	bool selectionChanged = false;
 	int32_t numRows = db->dbGetNumRows (this);
-	for (Selection::iterator it = selection.begin (); it != selection.end ();)
+	auto prevSize = selectedRows.size ();
+	selectedRows.remove (std::max<int32_t> (numRows, 0), std::numeric_limits<int32_t>::max ());
+	removeFromSelectionOrder (std::max<int32_t> (numRows, 0), std::numeric_limits<int32_t>::max ());
+	updateLastSelectedRow ();
+	if (selectedRows.size () != prevSize)
 	{
-		if (*it >= numRows)
-		{
-			it = selection.erase (it);
-			selectionChanged = true;
-		}
-		else
-		{
-			++it;
-		}
-	}
-	if (selectionChanged)
+		selectionValid = false;
 		db->dbSelectionChanged (this);
+	}
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -792,25 +972,41 @@ void CDataBrowserView::drawRect (CDrawContext* context, const CRect& updateRect)
 	if (drawRowLines)
 		rowHeight += lineWidth;
 	int32_t numRows = db->dbGetNumRows (browser);
-	int32_t numColumns = db->dbGetNumColumns (browser);
-
-	const CDataBrowser::Selection& selection = browser->getSelection ();
+	updateColumnOffsets (lineWidth);
+	auto numColumns = static_cast<int32_t> (columnOffsets.size ()) - 1;
 
 	CDrawContext::LineList lines;
 
-	CRect r (getViewSize ());
+	// only the rows and columns intersecting the update rect are visited
+	const CRect& viewSize = getViewSize ();
+	int32_t firstRow = 0;
+	int32_t lastRow = -1;
+	if (rowHeight > 0.)
+	{
+		firstRow = std::max<int32_t> (0, static_cast<int32_t> (std::floor ((updateRect.top - viewSize.top) / rowHeight)));
+		lastRow = static_cast<int32_t> (std::min<CCoord> (numRows - 1, std::floor ((updateRect.bottom - viewSize.top) / rowHeight)));
+	}
+	auto firstColumn = static_cast<int32_t> (std::upper_bound (columnOffsets.begin (), columnOffsets.end (), updateRect.left - viewSize.left) - columnOffsets.begin ()) - 1;
+	firstColumn = std::max<int32_t> (firstColumn, 0);
+
+	CRect r (viewSize);
 	r.setHeight (rowHeight - lineWidth);
-	for (int32_t row = 0; row < numRows; row++)
+	r.offset (0, rowHeight * firstRow);
+	for (int32_t row = firstRow; row <= lastRow; row++)
 	{
 		CRect testRect (r);
 		testRect.bound (updateRect);
 		if (testRect.isEmpty () == false)
 		{
-			bool isSelected = std::find (selection.begin (), selection.end (), row) != selection.end ();
-			for (int32_t col = 0; col < numColumns; col++)
+			bool isSelected = browser->isRowSelected (row);
+			for (int32_t col = firstColumn; col < numColumns; col++)
 			{
-				CCoord columnWidth = db->dbGetCurrentColumnWidth (col, browser);
-				r.setWidth (columnWidth);
+				r.left = viewSize.left + columnOffsets[col];
+				if (r.left >= updateRect.right)
+					break;
+				r.right = viewSize.left + columnOffsets[col + 1];
+				if (browser->getStyle () & CDataBrowser::kDrawColumnLines)
+					r.right -= lineWidth;
 				testRect = r;
 				testRect.bound (updateRect);
 				if (testRect.isEmpty () == false)
@@ -821,12 +1017,9 @@ void CDataBrowserView::drawRect (CDrawContext* context, const CRect& updateRect)
 					cellSize.right++;
 					db->dbDrawCell (context, cellSize, row, col, isSelected ? IDataBrowserDelegate::kRowSelected : 0, browser);
 				}
-				r.offset (columnWidth, 0);
-				if (browser->getStyle () & CDataBrowser::kDrawColumnLines)
-					r.offset (lineWidth, 0);
 			}
 		}
-		r.left = getViewSize ().left;
+		r.left = viewSize.left;
 		r.setWidth (getWidth ());
 		if (drawRowLines)
 			lines.emplace_back (r.getBottomLeft (), r.getBottomRight ());
@@ -834,18 +1027,12 @@ void CDataBrowserView::drawRect (CDrawContext* context, const CRect& updateRect)
 	}
 	if (browser->getStyle () & CDataBrowser::kDrawColumnLines)
 	{
-		
-		CPoint p1;
-		CPoint p2;
-		if (browser->getStyle () & CDataBrowser::kDrawColumnLines)
+		CPoint p1 (0, viewSize.top);
+		CPoint p2 (0, viewSize.bottom);
+		for (int32_t col = 1; col < numColumns; col++)
 		{
-			p1 (getViewSize ().left - lineWidth, getViewSize ().top);
-			p2 (getViewSize ().left - lineWidth, getViewSize ().bottom);
-			for (int32_t col = 0; col < numColumns - 1; col++)
-			{
-				p1.x = p2.x = p1.x + db->dbGetCurrentColumnWidth (col, browser) + lineWidth;
-				lines.emplace_back (p1, p2);
-			}
+			p1.x = p2.x = viewSize.left + columnOffsets[col] - lineWidth;
+			lines.emplace_back (p1, p2);
 		}
 	}
 	if (lines.size ())
@@ -860,6 +1047,22 @@ void CDataBrowserView::drawRect (CDrawContext* context, const CRect& updateRect)
 	setDirty (false);
 }
 
+//-----------------------------------------------------------------------------------------------
+void CDataBrowserView::updateColumnOffsets (CCoord lineWidth)
+{
+	int32_t numColumns = db->dbGetNumColumns (browser);
+	columnOffsets.resize (static_cast<size_t> (std::max<int32_t> (numColumns, 0)) + 1);
+	CCoord x = 0;
+	columnOffsets[0] = x;
+	for (int32_t col = 0; col < numColumns; col++)
+	{
+		x += db->dbGetCurrentColumnWidth (col, browser);
+		if (browser->getStyle () & CDataBrowser::kDrawColumnLines)
+			x += lineWidth;
+		columnOffsets[col + 1] = x;
+	}
+}
+
 //-----------------------------------------------------------------------------------------------
 bool CDataBrowserView::getCell (const CPoint& where, CDataBrowser::Cell& cell)
 {
@@ -902,8 +1105,7 @@ CMouseEventResult CDataBrowserView::onMouseDown (CPoint &where, const CButtonSta
 	CDataBrowser::Cell cell;
 	if (getCell (where, cell))
 	{
-		const CDataBrowser::Selection& selection = browser->getSelection ();
-		bool alreadySelected = std::find (selection.begin (), selection.end (), cell.row) != selection.end ();
+		bool alreadySelected = browser->isRowSelected (cell.row);
 		if (browser->getStyle () & CDataBrowser::kMultiSelectionStyle)
 		{
 			if (buttons.getModifierState () == kControl)
@@ -915,21 +1117,10 @@ CMouseEventResult CDataBrowserView::onMouseDown (CPoint &where, const CButtonSta
 			}
 			else if (buttons.getModifierState () == kShift)
 			{
-				int32_t lastSelectedRow = selection.size () > 0 ? selection.back () : -1;
-				if (lastSelectedRow < cell.row)
-				{
-					for (int32_t i = lastSelectedRow; i <= cell.row; i++)
-					{
-						browser->selectRow (i);
-					}
-				}
-				else if (lastSelectedRow > cell.row)
-				{
-					for (int32_t i = cell.row; i < lastSelectedRow; i++)
-					{
-						browser->selectRow (i);
-					}
-				}
+				int32_t anchorRow = browser->getLastSelectedRow ();
+				if (anchorRow == CDataBrowser::kNoSelection)
+					anchorRow = cell.row;
+				browser->selectRows (anchorRow, cell.row);
 			}
 			else
 			{
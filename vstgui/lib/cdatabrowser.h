@@ -10,6 +10,7 @@
 #include "cfont.h"
 #include "ccolor.h"
 #include "cstring.h"
+#include <map>
 #include <vector>
 
 namespace VSTGUI {
@@ -63,6 +64,47 @@ public:
 
 	using Selection = std::vector<int32_t>;
 
+	//-----------------------------------------------------------------------------
+	/** @brief set of rows stored as sorted, non overlapping ranges
+	 *
+	 *	Membership tests and changes are O(log n) in the number of ranges, so selecting a large
+	 *	contiguous block of rows does not cost more than selecting a single row.
+	 *
+	 *	@ingroup new_in_4_7
+	 */
+	class RowSet
+	{
+	public:
+		bool contains (int32_t row) const;
+		/** add all rows from first to last (inclusive) */
+		void add (int32_t first, int32_t last);
+		/** remove all rows from first to last (inclusive) */
+		void remove (int32_t first, int32_t last);
+		void add (int32_t row) { add (row, row); }
+		void remove (int32_t row) { remove (row, row); }
+		void clear ();
+
+		bool empty () const { return ranges.empty (); }
+		/** number of rows in the set */
+		uint32_t size () const { return count; }
+		/** lowest row or CDataBrowser::kNoSelection if empty */
+		int32_t first () const;
+		/** number of ranges */
+		uint32_t getNumRanges () const { return static_cast<uint32_t> (ranges.size ()); }
+
+		/** call proc (first, last) for every range in ascending order */
+		template<typename Proc>
+		void forEachRange (Proc proc) const
+		{
+			for (const auto& range : ranges)
+				proc (range.first, range.second);
+		}
+
+	private:
+		std::map<int32_t, int32_t> ranges;
+		uint32_t count {0};
+	};
+
 	//-----------------------------------------------------------------------------
 	/// @name CDataBrowser Methods
 	//-----------------------------------------------------------------------------
@@ -86,10 +128,18 @@ public:
 	/** set the exclusive selected row */
 	virtual void setSelectedRow (int32_t row, bool makeVisible = false);
 
-	/** get all selected rows */
-	const Selection& getSelection () const { return selection; }
+	/** get all selected rows in the order they were selected */
+	const Selection& getSelection () const;
+	/** get all selected rows as ranges */
+	const RowSet& getSelectedRows () const { return selectedRows; }
+	/** get the row that was selected last, used as anchor for range selection */
+	int32_t getLastSelectedRow () const { return lastSelectedRow; }
+	/** check if row is selected */
+	bool isRowSelected (int32_t row) const { return selectedRows.contains (row); }
 	/** add row to selection */
 	virtual void selectRow (int32_t row);
+	/** add the rows from first to last (inclusive) to the selection, needs kMultiSelectionStyle */
+	virtual void selectRows (int32_t first, int32_t last);
 	/** remove row from selection */
 	virtual void unselectRow (int32_t row);
 	/** empty selection */
@@ -118,12 +168,21 @@ protected:
 
 	void recalculateSubViews () override;
 	void validateSelection ();
+	void invalidateRows (int32_t first, int32_t last);
+	void addToSelectionOrder (int32_t first, int32_t last);
+	void removeFromSelectionOrder (int32_t first, int32_t last);
+	void updateLastSelectedRow ();
 
 	IDataBrowserDelegate* db;
 	CDataBrowserView* dbView;
 	CDataBrowserHeader* dbHeader;
 	CViewContainer* dbHeaderContainer;
-	Selection selection;
+	RowSet selectedRows;
+	/** the selected row ranges in the order they were selected */
+	std::vector<std::pair<int32_t, int32_t>> selectionOrder;
+	int32_t lastSelectedRow {kNoSelection};
+	mutable Selection selection;
+	mutable bool selectionValid {true};
 };
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,859 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "cdisplaylist.h"
+#include "cbitmap.h"
+#include "cdrawcontext.h"
+#include "cgradient.h"
+#include "cgraphicspath.h"
+#include "platform/iplatformstring.h"
+#include <algorithm>
+#include <vector>
+
+namespace VSTGUI {
+
+/// @cond ignore
+namespace {
+
+//-----------------------------------------------------------------------------
+class RecordingPath : public CGraphicsPath
+{
+public:
+	CGradient* createGradient (double color1Start, double color2Start, const CColor& color1,
+	                           const CColor& color2) override
+	{
+		return CGradient::create (color1Start, color2Start, color1, color2);
+	}
+
+	bool hitTest (const CPoint& p, bool evenOddFilled, CGraphicsTransform* transform) override
+	{
+		// recorded paths are only used for drawing, the bounding box is good enough here
+		CPoint where (p);
+		if (transform)
+			transform->inverse ().transform (where);
+		return getBoundingBox ().pointInside (where);
+	}
+
+	CPoint getCurrentPosition () override
+	{
+		if (elements.empty ())
+			return {};
+		const auto& e = elements.back ();
+		switch (e.type)
+		{
+			case Element::kLine:
+			case Element::kBeginSubpath:
+				return CPoint (e.instruction.point.x, e.instruction.point.y);
+			case Element::kBezierCurve:
+				return CPoint (e.instruction.curve.end.x, e.instruction.curve.end.y);
+			case Element::kRect:
+			case Element::kEllipse:
+				return CPoint (e.instruction.rect.left, e.instruction.rect.top);
+			default:
+				break;
+		}
+		return {};
+	}
+
+	CRect getBoundingBox () override
+	{
+		CRect result;
+		bool empty = true;
+		auto add = [&] (CCoord x, CCoord y) {
+			if (empty)
+			{
+				result = CRect (x, y, x, y);
+				empty = false;
+				return;
+			}
+			result.left = std::min (result.left, x);
+			result.top = std::min (result.top, y);
+			result.right = std::max (result.right, x);
+			result.bottom = std::max (result.bottom, y);
+		};
+		for (const auto& e : elements)
+		{
+			switch (e.type)
+			{
+				case Element::kArc:
+				{
+					const auto& r = e.instruction.arc.rect;
+					add (r.left, r.top);
+					add (r.right, r.bottom);
+					break;
+				}
+				case Element::kEllipse:
+				case Element::kRect:
+				{
+					const auto& r = e.instruction.rect;
+					add (r.left, r.top);
+					add (r.right, r.bottom);
+					break;
+				}
+				case Element::kLine:
+				case Element::kBeginSubpath:
+				{
+					add (e.instruction.point.x, e.instruction.point.y);
+					break;
+				}
+				case Element::kBezierCurve:
+				{
+					const auto& c = e.instruction.curve;
+					add (c.control1.x, c.control1.y);
+					add (c.control2.x, c.control2.y);
+					add (c.end.x, c.end.y);
+					break;
+				}
+				case Element::kCloseSubpath:
+					break;
+			}
+		}
+		return result;
+	}
+
+private:
+	void dirty () override {}
+};
+
+//-----------------------------------------------------------------------------
+template<typename T>
+struct RecordedValue
+{
+	bool update (const T& newValue)
+	{
+		if (valid && value == newValue)
+			return false;
+		value = newValue;
+		valid = true;
+		return true;
+	}
+
+	T value {};
+	bool valid {false};
+};
+
+} // anonymous
+/// @endcond
+
+//-----------------------------------------------------------------------------
+struct CDisplayList::Impl
+{
+	enum class Command : uint8_t
+	{
+		FillColor,
+		FrameColor,
+		FontColor,
+		LineWidth,
+		LineStyle,
+		DrawMode,
+		GlobalAlpha,
+		BitmapQuality,
+		Font,
+		Clip,
+		Transform,
+		Line,
+		Lines,
+		Polygon,
+		Rect,
+		Arc,
+		Ellipse,
+		Point,
+		Bitmap,
+		ClearRect,
+		Path,
+		LinearGradient,
+		RadialGradient,
+		String,
+		Rects,
+		BitmapSprites,
+		Polylines
+	};
+
+	enum Flags : uint8_t
+	{
+		kEvenOddFlag = 1 << 5,
+		kAntialiasFlag = 1 << 6,
+		kTransformFlag = 1 << 7,
+		kValueMask = kEvenOddFlag - 1
+	};
+
+	// every command consumes its arguments in order from the typed argument lists
+	struct Entry
+	{
+		Command command;
+		uint8_t flags;
+		uint32_t value;
+	};
+
+	CRect bounds;
+	std::vector<Entry> commands;
+	std::vector<CColor> colors;
+	std::vector<CCoord> values;
+	std::vector<CRect> rects;
+	std::vector<CPoint> points;
+	std::vector<CGraphicsTransform> transforms;
+	std::vector<CLineStyle> lineStyles;
+	std::vector<CDrawContext::LineList> lineLists;
+	std::vector<CDrawContext::PointList> pointLists;
+	std::vector<CDrawContext::RectList> rectLists;
+	std::vector<CDrawContext::BitmapSpriteList> spriteLists;
+	std::vector<CDrawContext::PolylineList> polylineLists;
+	std::vector<SharedPointer<CFontDesc>> fonts;
+	std::vector<SharedPointer<CBitmap>> bitmaps;
+	std::vector<SharedPointer<CGraphicsPath>> paths;
+	std::vector<SharedPointer<CGradient>> gradients;
+	std::vector<SharedPointer<IPlatformString>> strings;
+
+	void add (Command command, uint8_t flags = 0, uint32_t value = 0)
+	{
+		commands.push_back ({command, flags, value});
+	}
+
+	void shrink ()
+	{
+		commands.shrink_to_fit ();
+		colors.shrink_to_fit ();
+		values.shrink_to_fit ();
+		rects.shrink_to_fit ();
+		points.shrink_to_fit ();
+		transforms.shrink_to_fit ();
+	}
+
+	void replay (CDrawContext& context, const CPoint& offset) const;
+};
+
+//-----------------------------------------------------------------------------
+class CDisplayList::Recorder : public CDrawContext
+{
+public:
+	using Command = Impl::Command;
+
+	Recorder (Impl& list, const CRect& bounds, double scaleFactor)
+	: CDrawContext (bounds), list (list), scaleFactor (scaleFactor)
+	{
+		init ();
+	}
+
+	bool failed () const { return hasFailed; }
+
+	void drawLine (const LinePair& line) override
+	{
+		recordState (kStrokeState);
+		list.add (Command::Line);
+		list.points.push_back (line.first);
+		list.points.push_back (line.second);
+	}
+
+	void drawLines (const LineList& lines) override
+	{
+		if (lines.empty ())
+			return;
+		recordState (kStrokeState);
+		list.add (Command::Lines);
+		list.lineLists.push_back (lines);
+	}
+
+	void drawPolygon (const PointList& polygonPointList, const CDrawStyle drawStyle) override
+	{
+		if (polygonPointList.empty ())
+			return;
+		recordState (stateForDrawStyle (drawStyle));
+		list.add (Command::Polygon, static_cast<uint8_t> (drawStyle));
+		list.pointLists.push_back (polygonPointList);
+	}
+
+	void drawRect (const CRect& rect, const CDrawStyle drawStyle) override
+	{
+		recordState (stateForDrawStyle (drawStyle));
+		list.add (Command::Rect, static_cast<uint8_t> (drawStyle));
+		list.rects.push_back (rect);
+	}
+
+	void drawArc (const CRect& rect, const float startAngle1, const float endAngle2,
+	              const CDrawStyle drawStyle) override
+	{
+		recordState (stateForDrawStyle (drawStyle));
+		list.add (Command::Arc, static_cast<uint8_t> (drawStyle));
+		list.rects.push_back (rect);
+		list.values.push_back (startAngle1);
+		list.values.push_back (endAngle2);
+	}
+
+	void drawEllipse (const CRect& rect, const CDrawStyle drawStyle) override
+	{
+		recordState (stateForDrawStyle (drawStyle));
+		list.add (Command::Ellipse, static_cast<uint8_t> (drawStyle));
+		list.rects.push_back (rect);
+	}
+
+	void drawPoint (const CPoint& point, const CColor& color) override
+	{
+		recordState (kStrokeState);
+		list.add (Command::Point);
+		list.points.push_back (point);
+		list.colors.push_back (color);
+	}
+
+	void drawBitmap (CBitmap* bitmap, const CRect& dest, const CPoint& offset, float alpha) override
+	{
+		if (bitmap == nullptr)
+			return;
+		recordState (kBitmapState);
+		list.add (Command::Bitmap);
+		list.bitmaps.emplace_back (bitmap);
+		list.rects.push_back (dest);
+		list.points.push_back (offset);
+		list.values.push_back (alpha);
+	}
+
+	void clearRect (const CRect& rect) override
+	{
+		recordState (0);
+		list.add (Command::ClearRect);
+		list.rects.push_back (rect);
+	}
+
+	void drawRects (const RectList& rects, const CDrawStyle drawStyle) override
+	{
+		if (rects.empty ())
+			return;
+		recordState (stateForDrawStyle (drawStyle));
+		list.add (Command::Rects, static_cast<uint8_t> (drawStyle));
+		list.rectLists.push_back (rects);
+	}
+
+	void drawBitmapSprites (CBitmap* bitmap, const BitmapSpriteList& sprites, float alpha) override
+	{
+		if (bitmap == nullptr || sprites.empty ())
+			return;
+		recordState (kBitmapState);
+		list.add (Command::BitmapSprites);
+		list.bitmaps.emplace_back (bitmap);
+		list.spriteLists.push_back (sprites);
+		list.values.push_back (alpha);
+	}
+
+	void drawPolylines (const PolylineList& polylines) override
+	{
+		if (polylines.empty ())
+			return;
+		recordState (kStrokeState);
+		list.add (Command::Polylines);
+		list.polylineLists.push_back (polylines);
+	}
+
+	CGraphicsPath* createGraphicsPath () override { return new RecordingPath (); }
+
+	CGraphicsPath* createTextPath (const CFontRef font, UTF8StringPtr text) override
+	{
+		// the glyph outlines are only known to the platform context
+		hasFailed = true;
+		return nullptr;
+	}
+
+	void drawGraphicsPath (CGraphicsPath* path, PathDrawMode mode,
+	                       CGraphicsTransform* transformation) override
+	{
+		if (path == nullptr)
+			return;
+		recordState (mode == kPathStroked ? kStrokeState : kFillState);
+		list.add (Command::Path, static_cast<uint8_t> (mode) | transformFlag (transformation));
+		recordPath (path, transformation);
+	}
+
+	void fillLinearGradient (CGraphicsPath* path, const CGradient& gradient,
+	                         const CPoint& startPoint, const CPoint& endPoint, bool evenOdd,
+	                         CGraphicsTransform* transformation) override
+	{
+		if (path == nullptr)
+			return;
+		recordState (0);
+		list.add (Command::LinearGradient, evenOddFlag (evenOdd) | transformFlag (transformation));
+		recordPath (path, transformation);
+		recordGradient (gradient);
+		list.points.push_back (startPoint);
+		list.points.push_back (endPoint);
+	}
+
+	void fillRadialGradient (CGraphicsPath* path, const CGradient& gradient, const CPoint& center,
+	                         CCoord radius, const CPoint& originOffset, bool evenOdd,
+	                         CGraphicsTransform* transformation) override
+	{
+		if (path == nullptr)
+			return;
+		recordState (0);
+		list.add (Command::RadialGradient, evenOddFlag (evenOdd) | transformFlag (transformation));
+		recordPath (path, transformation);
+		recordGradient (gradient);
+		list.points.push_back (center);
+		list.points.push_back (originOffset);
+		list.values.push_back (radius);
+	}
+
+	double getScaleFactor () const override { return scaleFactor; }
+
+protected:
+	void drawPlatformString (const IFontPainter* painter, IPlatformString* string,
+	                         const CPoint& point, bool antialias) override
+	{
+		recordState (kFontState);
+		list.add (Command::String, antialias ? Impl::kAntialiasFlag : 0);
+		list.strings.emplace_back (string);
+		list.points.push_back (point);
+	}
+
+private:
+	enum StateFlags : uint32_t
+	{
+		kFillState = 1 << 0,
+		kStrokeState = 1 << 1,
+		kFontState = 1 << 2,
+		kBitmapState = 1 << 3,
+	};
+
+	static uint32_t stateForDrawStyle (CDrawStyle drawStyle)
+	{
+		switch (drawStyle)
+		{
+			case kDrawStroked: return kStrokeState;
+			case kDrawFilled: return kFillState;
+			case kDrawFilledAndStroked: return kFillState | kStrokeState;
+		}
+		return kFillState | kStrokeState;
+	}
+
+	static uint8_t transformFlag (CGraphicsTransform* transformation)
+	{
+		return transformation ? Impl::kTransformFlag : 0;
+	}
+
+	static uint8_t evenOddFlag (bool evenOdd) { return evenOdd ? Impl::kEvenOddFlag : 0; }
+
+	void recordPath (CGraphicsPath* path, CGraphicsTransform* transformation)
+	{
+		// the path may be changed by the caller after drawing, so we need our own copy
+		auto copy = makeOwned<RecordingPath> ();
+		copy->addPath (*path);
+		list.paths.emplace_back (std::move (copy));
+		if (transformation)
+			list.transforms.push_back (*transformation);
+	}
+
+	void recordGradient (const CGradient& gradient)
+	{
+		// gradients are immutable platform objects, so we can share it
+		list.gradients.emplace_back (const_cast<CGradient*> (&gradient));
+	}
+
+	/** add the state changes needed for the next primitive */
+	void recordState (uint32_t flags)
+	{
+		const auto& state = getCurrentState ();
+		if (clip.update (state.clipRect))
+		{
+			list.add (Command::Clip);
+			list.rects.push_back (state.clipRect);
+		}
+		if (transform.update (getCurrentTransform ()))
+		{
+			list.add (Command::Transform);
+			list.transforms.push_back (transform.value);
+		}
+		if (drawMode.update (state.drawMode ()))
+			list.add (Command::DrawMode, 0, drawMode.value);
+		if (globalAlpha.update (state.globalAlpha))
+		{
+			list.add (Command::GlobalAlpha);
+			list.values.push_back (globalAlpha.value);
+		}
+		if ((flags & kFillState) && fillColor.update (state.fillColor))
+		{
+			list.add (Command::FillColor);
+			list.colors.push_back (fillColor.value);
+		}
+		if (flags & kStrokeState)
+		{
+			if (frameColor.update (state.frameColor))
+			{
+				list.add (Command::FrameColor);
+				list.colors.push_back (frameColor.value);
+			}
+			if (lineWidth.update (state.frameWidth))
+			{
+				list.add (Command::LineWidth);
+				list.values.push_back (lineWidth.value);
+			}
+			if (lineStyle.update (state.lineStyle))
+			{
+				list.add (Command::LineStyle);
+				list.lineStyles.push_back (lineStyle.value);
+			}
+		}
+		if (flags & kFontState)
+		{
+			if (fontColor.update (state.fontColor))
+			{
+				list.add (Command::FontColor);
+				list.colors.push_back (fontColor.value);
+			}
+			if (state.font && font.update (state.font))
+			{
+				list.add (Command::Font);
+				list.fonts.push_back (font.value);
+			}
+		}
+		if ((flags & kBitmapState) && bitmapQuality.update (state.bitmapQuality))
+			list.add (Command::BitmapQuality, 0, static_cast<uint32_t> (bitmapQuality.value));
+	}
+
+	Impl& list;
+	double scaleFactor;
+	bool hasFailed {false};
+
+	RecordedValue<CRect> clip;
+	RecordedValue<CGraphicsTransform> transform;
+	RecordedValue<uint32_t> drawMode;
+	RecordedValue<float> globalAlpha;
+	RecordedValue<CColor> fillColor;
+	RecordedValue<CColor> frameColor;
+	RecordedValue<CColor> fontColor;
+	RecordedValue<CCoord> lineWidth;
+	RecordedValue<CLineStyle> lineStyle;
+	RecordedValue<SharedPointer<CFontDesc>> font;
+	RecordedValue<BitmapInterpolationQuality> bitmapQuality;
+};
+
+//-----------------------------------------------------------------------------
+void CDisplayList::Impl::replay (CDrawContext& context, const CPoint& offset) const
+{
+	context.saveGlobalState ();
+
+	CRect baseClip;
+	context.getClipRect (baseClip);
+	const auto baseAlpha = context.getGlobalAlpha ();
+	CGraphicsTransform offsetTransform;
+	offsetTransform.translate (offset);
+	CGraphicsTransform recordedTransform;
+	auto transform = std::unique_ptr<CDrawContext::Transform> (
+	    new CDrawContext::Transform (context, offsetTransform));
+	bool clipIsEmpty = baseClip.isEmpty ();
+
+	size_t colorIndex = 0;
+	size_t valueIndex = 0;
+	size_t rectIndex = 0;
+	size_t pointIndex = 0;
+	size_t transformIndex = 0;
+	size_t lineStyleIndex = 0;
+	size_t lineListIndex = 0;
+	size_t pointListIndex = 0;
+	size_t rectListIndex = 0;
+	size_t spriteListIndex = 0;
+	size_t polylineListIndex = 0;
+	size_t fontIndex = 0;
+	size_t bitmapIndex = 0;
+	size_t pathIndex = 0;
+	size_t gradientIndex = 0;
+	size_t stringIndex = 0;
+
+	auto nextTransform = [&] (uint8_t flags) {
+		return (flags & kTransformFlag) ? transforms[transformIndex++] : CGraphicsTransform ();
+	};
+	auto createPlatformPath = [&] (size_t index) -> SharedPointer<CGraphicsPath> {
+		auto path = owned (context.createGraphicsPath ());
+		if (path)
+			path->addPath (*paths[index]);
+		return path;
+	};
+
+	for (const auto& entry : commands)
+	{
+		switch (entry.command)
+		{
+			case Command::FillColor:
+			{
+				const auto& color = colors[colorIndex++];
+				if (context.getFillColor () != color)
+					context.setFillColor (color);
+				break;
+			}
+			case Command::FrameColor:
+			{
+				const auto& color = colors[colorIndex++];
+				if (context.getFrameColor () != color)
+					context.setFrameColor (color);
+				break;
+			}
+			case Command::FontColor:
+			{
+				const auto& color = colors[colorIndex++];
+				if (context.getFontColor () != color)
+					context.setFontColor (color);
+				break;
+			}
+			case Command::LineWidth:
+			{
+				auto width = values[valueIndex++];
+				if (context.getLineWidth () != width)
+					context.setLineWidth (width);
+				break;
+			}
+			case Command::LineStyle:
+			{
+				const auto& style = lineStyles[lineStyleIndex++];
+				if (context.getLineStyle () != style)
+					context.setLineStyle (style);
+				break;
+			}
+			case Command::DrawMode:
+			{
+				if (context.getDrawMode () () != entry.value)
+					context.setDrawMode (entry.value);
+				break;
+			}
+			case Command::GlobalAlpha:
+			{
+				auto alpha = baseAlpha * static_cast<float> (values[valueIndex++]);
+				if (context.getGlobalAlpha () != alpha)
+					context.setGlobalAlpha (alpha);
+				break;
+			}
+			case Command::BitmapQuality:
+			{
+				auto quality = static_cast<BitmapInterpolationQuality> (entry.value);
+				if (context.getBitmapInterpolationQuality () != quality)
+					context.setBitmapInterpolationQuality (quality);
+				break;
+			}
+			case Command::Font:
+			{
+				const auto& font = fonts[fontIndex++];
+				auto current = context.getFont ();
+				if (current != font && (current == nullptr || *current != *font))
+					context.setFont (font);
+				break;
+			}
+			case Command::Clip:
+			{
+				// the clip rect is recorded in the untransformed coordinates
+				CRect clip (rects[rectIndex++]);
+				clip.offset (offset.x, offset.y);
+				clip.bound (baseClip);
+				transform = nullptr;
+				CRect current;
+				if (context.getClipRect (current) != clip)
+					context.setClipRect (clip);
+				transform = std::unique_ptr<CDrawContext::Transform> (
+				    new CDrawContext::Transform (context, offsetTransform * recordedTransform));
+				clipIsEmpty = clip.isEmpty ();
+				break;
+			}
+			case Command::Transform:
+			{
+				recordedTransform = transforms[transformIndex++];
+				transform = nullptr;
+				transform = std::unique_ptr<CDrawContext::Transform> (
+				    new CDrawContext::Transform (context, offsetTransform * recordedTransform));
+				break;
+			}
+			case Command::Line:
+			{
+				const auto& start = points[pointIndex++];
+				const auto& end = points[pointIndex++];
+				if (!clipIsEmpty)
+					context.drawLine (start, end);
+				break;
+			}
+			case Command::Lines:
+			{
+				const auto& lines = lineLists[lineListIndex++];
+				if (!clipIsEmpty)
+					context.drawLines (lines);
+				break;
+			}
+			case Command::Rects:
+			{
+				const auto& rectList = rectLists[rectListIndex++];
+				if (!clipIsEmpty)
+					context.drawRects (rectList, static_cast<CDrawStyle> (entry.flags));
+				break;
+			}
+			case Command::BitmapSprites:
+			{
+				const auto& bitmap = bitmaps[bitmapIndex++];
+				const auto& sprites = spriteLists[spriteListIndex++];
+				auto alpha = static_cast<float> (values[valueIndex++]);
+				if (!clipIsEmpty)
+					context.drawBitmapSprites (bitmap.get (), sprites, alpha);
+				break;
+			}
+			case Command::Polylines:
+			{
+				const auto& polylines = polylineLists[polylineListIndex++];
+				if (!clipIsEmpty)
+					context.drawPolylines (polylines);
+				break;
+			}
+			case Command::Polygon:
+			{
+				const auto& polygon = pointLists[pointListIndex++];
+				if (!clipIsEmpty)
+					context.drawPolygon (polygon, static_cast<CDrawStyle> (entry.flags));
+				break;
+			}
+			case Command::Rect:
+			{
+				const auto& rect = rects[rectIndex++];
+				if (!clipIsEmpty)
+					context.drawRect (rect, static_cast<CDrawStyle> (entry.flags));
+				break;
+			}
+			case Command::Arc:
+			{
+				const auto& rect = rects[rectIndex++];
+				auto startAngle = static_cast<float> (values[valueIndex++]);
+				auto endAngle = static_cast<float> (values[valueIndex++]);
+				if (!clipIsEmpty)
+					context.drawArc (rect, startAngle, endAngle, static_cast<CDrawStyle> (entry.flags));
+				break;
+			}
+			case Command::Ellipse:
+			{
+				const auto& rect = rects[rectIndex++];
+				if (!clipIsEmpty)
+					context.drawEllipse (rect, static_cast<CDrawStyle> (entry.flags));
+				break;
+			}
+			case Command::Point:
+			{
+				const auto& point = points[pointIndex++];
+				const auto& color = colors[colorIndex++];
+				if (!clipIsEmpty)
+					context.drawPoint (point, color);
+				break;
+			}
+			case Command::Bitmap:
+			{
+				const auto& bitmap = bitmaps[bitmapIndex++];
+				const auto& dest = rects[rectIndex++];
+				const auto& bitmapOffset = points[pointIndex++];
+				auto alpha = static_cast<float> (values[valueIndex++]);
+				if (!clipIsEmpty)
+					context.drawBitmap (bitmap.get (), dest, bitmapOffset, alpha);
+				break;
+			}
+			case Command::ClearRect:
+			{
+				const auto& rect = rects[rectIndex++];
+				if (!clipIsEmpty)
+					context.clearRect (rect);
+				break;
+			}
+			case Command::Path:
+			{
+				auto index = pathIndex++;
+				auto pathTransform = nextTransform (entry.flags);
+				if (clipIsEmpty)
+					break;
+				if (auto path = createPlatformPath (index))
+				{
+					auto mode = static_cast<CDrawContext::PathDrawMode> (entry.flags & kValueMask);
+					context.drawGraphicsPath (path, mode,
+					                          (entry.flags & kTransformFlag) ? &pathTransform : nullptr);
+				}
+				break;
+			}
+			case Command::LinearGradient:
+			{
+				auto index = pathIndex++;
+				auto pathTransform = nextTransform (entry.flags);
+				const auto& gradient = gradients[gradientIndex++];
+				const auto& startPoint = points[pointIndex++];
+				const auto& endPoint = points[pointIndex++];
+				if (clipIsEmpty)
+					break;
+				if (auto path = createPlatformPath (index))
+				{
+					context.fillLinearGradient (path, *gradient, startPoint, endPoint,
+					                            (entry.flags & kEvenOddFlag) != 0,
+					                            (entry.flags & kTransformFlag) ? &pathTransform : nullptr);
+				}
+				break;
+			}
+			case Command::RadialGradient:
+			{
+				auto index = pathIndex++;
+				auto pathTransform = nextTransform (entry.flags);
+				const auto& gradient = gradients[gradientIndex++];
+				const auto& center = points[pointIndex++];
+				const auto& originOffset = points[pointIndex++];
+				auto radius = values[valueIndex++];
+				if (clipIsEmpty)
+					break;
+				if (auto path = createPlatformPath (index))
+				{
+					context.fillRadialGradient (path, *gradient, center, radius, originOffset,
+					                            (entry.flags & kEvenOddFlag) != 0,
+					                            (entry.flags & kTransformFlag) ? &pathTransform : nullptr);
+				}
+				break;
+			}
+			case Command::String:
+			{
+				const auto& string = strings[stringIndex++];
+				const auto& point = points[pointIndex++];
+				if (!clipIsEmpty)
+					context.drawString (string.get (), point, (entry.flags & kAntialiasFlag) != 0);
+				break;
+			}
+		}
+	}
+	transform = nullptr;
+	context.restoreGlobalState ();
+}
+
+//-----------------------------------------------------------------------------
+CDisplayList::CDisplayList (const CRect& bounds)
+{
+	impl = std::unique_ptr<Impl> (new Impl ());
+	impl->bounds = bounds;
+}
+
+//-----------------------------------------------------------------------------
+CDisplayList::~CDisplayList () noexcept = default;
+
+//-----------------------------------------------------------------------------
+SharedPointer<CDisplayList> CDisplayList::record (const CRect& bounds, double scaleFactor,
+                                                  const DrawProc& proc)
+{
+	auto displayList = owned (new CDisplayList (bounds));
+	auto recorder = owned (new Recorder (*displayList->impl, bounds, scaleFactor));
+	recorder->beginDraw ();
+	proc (recorder);
+	recorder->endDraw ();
+	if (recorder->failed ())
+		return nullptr;
+	displayList->impl->shrink ();
+	return displayList;
+}
+
+//-----------------------------------------------------------------------------
+void CDisplayList::replay (CDrawContext* context, const CPoint& offset) const
+{
+	if (context && !impl->commands.empty ())
+		impl->replay (*context, offset);
+}
+
+//-----------------------------------------------------------------------------
+const CRect& CDisplayList::getBounds () const
+{
+	return impl->bounds;
+}
+
+//-----------------------------------------------------------------------------
+size_t CDisplayList::getNumCommands () const
+{
+	return impl->commands.size ();
+}
+
+} // namespace
@@ -0,0 +1,70 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#ifndef __cdisplaylist__
+#define __cdisplaylist__
+
+#include "vstguifwd.h"
+#include "cpoint.h"
+#include "crect.h"
+#include <functional>
+#include <memory>
+
+namespace VSTGUI {
+
+//-----------------------------------------------------------------------------
+// CDisplayList Declaration
+/// @brief a recorded list of drawing commands which can be replayed into any draw context
+///
+/// The display list is recorded by a draw context which captures the draw primitives, paths,
+/// bitmaps and strings. State changes are only recorded when they differ from the state the
+/// previous primitive was drawn with and they are skipped on replay when the target context has
+/// already the same state.
+///
+/// Replaying a display list is much cheaper than drawing views which compute their appearance
+/// on every draw call. See CView::setDisplayListCacheEnabled
+/// @ingroup new_in_4_7
+//-----------------------------------------------------------------------------
+class CDisplayList : public AtomicReferenceCounted
+{
+public:
+	using DrawProc = std::function<void (CDrawContext* context)>;
+
+	/** record the drawing of a function.
+	 *
+	 *	@param bounds surface and clip rect of the recording context
+	 *	@param scaleFactor the scale factor the recording context reports to the drawing function
+	 *	@param proc the drawing function
+	 *	@return the display list or nullptr if the drawing function used a feature which cannot
+	 *			be recorded
+	 */
+	static SharedPointer<CDisplayList> record (const CRect& bounds, double scaleFactor,
+	                                           const DrawProc& proc);
+
+	/** replay the recorded commands into a context.
+	 *
+	 *	The clip rect and the global alpha of the context at the time of the call are respected,
+	 *	the state of the context is restored afterwards.
+	 *	@param context target context
+	 *	@param offset offset added to all recorded coordinates
+	 */
+	void replay (CDrawContext* context, const CPoint& offset = CPoint ()) const;
+
+	/** the bounds the display list was recorded with */
+	const CRect& getBounds () const;
+	/** the number of recorded commands, including state changes */
+	size_t getNumCommands () const;
+
+	~CDisplayList () noexcept override;
+private:
+	CDisplayList (const CRect& bounds);
+
+	class Recorder;
+	struct Impl;
+	std::unique_ptr<Impl> impl;
+};
+
+} // namespace
+
+#endif // __cdisplaylist__
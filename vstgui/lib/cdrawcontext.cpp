@@ -258,7 +258,7 @@ void CDrawContext::drawString (IPlatformString* string, const CRect& _rect, cons
 			rect.left = rect.left + (rect.getWidth () / 2.) - (stringWidth / 2.);
 	}
 
-	painter->drawString (this, string, CPoint (rect.left, rect.bottom), antialias);
+	drawPlatformString (painter, string, CPoint (rect.left, rect.bottom), antialias);
 }
 
 //------------------------------------------------------------------------
@@ -268,7 +268,13 @@ void CDrawContext::drawString (IPlatformString* string, const CPoint& point, boo
 		return;
 	
 	if (auto painter = currentState.font->getFontPainter ())
-		painter->drawString (this, string, point, antialias);
+		drawPlatformString (painter, string, point, antialias);
+}
+
+//------------------------------------------------------------------------
+void CDrawContext::drawPlatformString (const IFontPainter* painter, IPlatformString* string, const CPoint& point, bool antialias)
+{
+	painter->drawString (this, string, point, antialias);
 }
 
 //-----------------------------------------------------------------------------
@@ -291,6 +297,33 @@ void CDrawContext::drawString (UTF8StringPtr string, const CRect& rect, const CH
 	clearDrawString ();
 }
 
+//-----------------------------------------------------------------------------
+void CDrawContext::drawRects (const RectList& rects, const CDrawStyle drawStyle)
+{
+	for (const auto& rect : rects)
+		drawRect (rect, drawStyle);
+}
+
+//-----------------------------------------------------------------------------
+void CDrawContext::drawBitmapSprites (CBitmap* bitmap, const BitmapSpriteList& sprites, float alpha)
+{
+	for (const auto& sprite : sprites)
+		bitmap->draw (this, sprite.dest, sprite.offset, alpha);
+}
+
+//-----------------------------------------------------------------------------
+void CDrawContext::drawPolylines (const PolylineList& polylines)
+{
+	LineList lines;
+	for (const auto& polyline : polylines)
+	{
+		for (size_t i = 1; i < polyline.size (); ++i)
+			lines.emplace_back (polyline[i - 1], polyline[i]);
+	}
+	if (!lines.empty ())
+		drawLines (lines);
+}
+
 //-----------------------------------------------------------------------------
 void CDrawContext::fillRectWithBitmap (CBitmap* bitmap, const CRect& srcRect, const CRect& dstRect, float alpha)
 {
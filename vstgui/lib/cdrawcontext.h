@@ -74,6 +74,34 @@ public:
 	virtual void clearRect (const CRect& rect) = 0;
 	//@}
 
+	//-----------------------------------------------------------------------------
+	/// @name Batched Draw primitives
+	//-----------------------------------------------------------------------------
+	//@{
+	using RectList = std::vector<CRect>;
+	using PolylineList = std::vector<PointList>;
+
+	struct BitmapSprite
+	{
+		CRect dest;
+		CPoint offset;
+	};
+	using BitmapSpriteList = std::vector<BitmapSprite>;
+
+	/** draw multiple rects with the same draw style at once
+	 *	@ingroup new_in_4_7
+	 */
+	virtual void drawRects (const RectList& rects, const CDrawStyle drawStyle = kDrawStroked);
+	/** draw multiple parts of one bitmap at once, every sprite is drawn like CBitmap::draw would do
+	 *	@ingroup new_in_4_7
+	 */
+	virtual void drawBitmapSprites (CBitmap* bitmap, const BitmapSpriteList& sprites, float alpha = 1.f);
+	/** stroke multiple polylines at once
+	 *	@ingroup new_in_4_7
+	 */
+	virtual void drawPolylines (const PolylineList& polylines);
+	//@}
+
 	//-----------------------------------------------------------------------------
 	// @name Bitmap Interpolation Quality
 	//-----------------------------------------------------------------------------
@@ -244,6 +272,12 @@ protected:
 	const UTF8String& getDrawString (UTF8StringPtr string);
 	void clearDrawString ();
 
+	/** draws the platform string at point with the font painter of the current font.
+	 *	All string drawing methods end up here.
+	 *	@ingroup new_in_4_7
+	 */
+	virtual void drawPlatformString (const IFontPainter* painter, IPlatformString* string, const CPoint& point, bool antialias);
+
 	/// @cond ignore
 	struct CDrawContextState
 	{
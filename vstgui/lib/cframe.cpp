@@ -3,14 +3,18 @@
 // distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
 
 #include "cframe.h"
+#include "cbitmapcache.h"
 #include "coffscreencontext.h"
+#include "crowcolumnview.h"
 #include "ctooltipsupport.h"
+#include "drawprofiler.h"
 #include "itouchevent.h"
 #include "iscalefactorchangedlistener.h"
 #include "idatapackage.h"
 #include "animation/animator.h"
 #include "controls/ctextedit.h"
 #include "platform/iplatformframe.h"
+#include <algorithm>
 #include <cassert>
 #include <vector>
 #include <queue>
@@ -55,6 +59,7 @@ struct CFrame::Impl
 	using ViewList = std::list<CView*>;
 	using FunctionQueue = std::queue<Function>;
 	using ModalViewSessionStack = std::stack<std::unique_ptr<ModalViewSession>>;
+	using LayoutViews = std::vector<SharedPointer<CAutoLayoutContainerView>>;
 
 	SharedPointer<IPlatformFrame> platformFrame;
 	VSTGUIEditorInterface* editor {nullptr};
@@ -76,12 +81,17 @@ struct CFrame::Impl
 	DispatchList<IFocusViewObserver*> focusViewObservers;
 	DispatchList<IKeyboardHook*> keyboardHooks;
 	FunctionQueue postEventFunctionQueue;
+	LayoutViews scheduledLayouts;
+	LayoutStatistics layoutStatistics;
+	uint32_t numLayoutPassesSinceDraw {0};
 
 	double userScaleFactor {1.};
 	double platformScaleFactor {1.};
 	bool active {false};
 	bool windowActive {false};
 	bool inEventHandling {false};
+	bool layoutPassQueued {false};
+	bool inLayoutPass {false};
 	BitmapInterpolationQuality bitmapQuality {BitmapInterpolationQuality::kDefault};
 
 	struct PostEventHandler
@@ -140,10 +150,14 @@ void CFrame::beforeDelete ()
 
 	setParentFrame (nullptr);
 	removeAll ();
+	pImpl->scheduledLayouts.clear ();
 
 	pImpl->tooltips = nullptr;
 	pImpl->animator = nullptr;
 
+	if (!CBitmapCache::isDestroyed ())
+		CBitmapCache::getInstance ().removeFrame (this);
+
 #if DEBUG
 	if (!pImpl->scaleFactorChangedListenerList.empty ())
 	{
@@ -185,6 +199,7 @@ void CFrame::close ()
 	setCursor (kCursorDefault);
 	setParentFrame (nullptr);
 	removeAll ();
+	pImpl->scheduledLayouts.clear ();
 	if (pImpl->platformFrame)
 	{
 		pImpl->platformFrame->onFrameClosed ();
@@ -196,7 +211,7 @@ void CFrame::close ()
 //-----------------------------------------------------------------------------
 bool CFrame::open (void* systemWin, PlatformType systemWindowType, IPlatformFrameConfig* config)
 {
-	if (!systemWin || isAttached ())
+	if ((!systemWin && systemWindowType != kHeadless) || isAttached ())
 		return false;
 
 	pImpl->platformFrame = owned (IPlatformFrame::createPlatformFrame (this, getViewSize (), systemWin, systemWindowType, config));
@@ -324,7 +339,12 @@ void CFrame::drawRect (CDrawContext* pContext, const CRect& updateRect)
 		pContext->remember ();
 
 	if (pImpl)
+	{
+		performScheduledLayouts ();
+		pImpl->layoutStatistics.numPassesLastFrame = pImpl->numLayoutPassesSinceDraw;
+		pImpl->numLayoutPassesSinceDraw = 0;
 		pContext->setBitmapInterpolationQuality(pImpl->bitmapQuality);
+	}
 
 	CRect oldClip;
 	pContext->getClipRect (oldClip);
@@ -332,11 +352,16 @@ void CFrame::drawRect (CDrawContext* pContext, const CRect& updateRect)
 	newClip.bound (oldClip);
 	pContext->setClipRect (newClip);
 
+	// bitmaps are only evicted when they are not drawn
+	CBitmapCache::getInstance ().beginFrame (this);
+
 	// draw the background and the children
 	CViewContainer::drawRect (pContext, updateRect);
 
 	pContext->setClipRect (oldClip);
 
+	CBitmapCache::getInstance ().endFrame (this);
+
 	pContext->forget ();
 }
 
@@ -1579,6 +1604,7 @@ IPlatformFrame* CFrame::getPlatformFrame () const
 //-----------------------------------------------------------------------------
 bool CFrame::platformDrawRect (CDrawContext* context, const CRect& rect)
 {
+	VSTGUI_DRAW_PROFILER_SCOPE (this, rect);
 	drawRect (context, rect);
 	return true;
 }
@@ -1846,6 +1872,72 @@ bool CFrame::inEventProcessing () const
 	return pImpl->inEventHandling;
 }
 
+//-----------------------------------------------------------------------------
+void CFrame::scheduleLayout (CAutoLayoutContainerView* view)
+{
+	pImpl->scheduledLayouts.emplace_back (view);
+	if (!pImpl->layoutPassQueued && !pImpl->inLayoutPass && inEventProcessing ())
+	{
+		pImpl->layoutPassQueued = true;
+		doAfterEventProcessing ([this] () { performScheduledLayouts (); });
+	}
+}
+
+//-----------------------------------------------------------------------------
+void CFrame::performScheduledLayouts ()
+{
+	pImpl->layoutPassQueued = false;
+	if (pImpl->inLayoutPass || pImpl->scheduledLayouts.empty ())
+		return;
+	pImpl->inLayoutPass = true;
+
+	using DepthAndView = std::pair<uint32_t, CAutoLayoutContainerView*>;
+	std::vector<DepthAndView> views;
+	uint32_t numLayouts = 0;
+	// layouting a container may schedule layouts for the containers inside of it, those are
+	// performed in the same pass
+	while (!pImpl->scheduledLayouts.empty ())
+	{
+		Impl::LayoutViews layoutViews;
+		layoutViews.swap (pImpl->scheduledLayouts);
+		views.clear ();
+		for (auto& view : layoutViews)
+		{
+			uint32_t depth = 0;
+			for (auto parent = view->getParentView (); parent; parent = parent->getParentView ())
+				++depth;
+			views.emplace_back (depth, view);
+		}
+		std::stable_sort (views.begin (), views.end (), [] (const DepthAndView& v1, const DepthAndView& v2) {
+			return v1.first < v2.first;
+		});
+		for (auto& view : views)
+		{
+			if (view.second->layoutIfNeeded ())
+				++numLayouts;
+		}
+	}
+
+	++pImpl->layoutStatistics.numPasses;
+	pImpl->layoutStatistics.numLayouts += numLayouts;
+	pImpl->layoutStatistics.numLayoutsLastPass = numLayouts;
+	++pImpl->numLayoutPassesSinceDraw;
+	pImpl->inLayoutPass = false;
+}
+
+//-----------------------------------------------------------------------------
+const CFrame::LayoutStatistics& CFrame::getLayoutStatistics () const
+{
+	return pImpl->layoutStatistics;
+}
+
+//-----------------------------------------------------------------------------
+void CFrame::resetLayoutStatistics ()
+{
+	pImpl->layoutStatistics = LayoutStatistics ();
+	pImpl->numLayoutPassesSinceDraw = 0;
+}
+
 //-----------------------------------------------------------------------------
 void CFrame::onStartLocalEventLoop ()
 {
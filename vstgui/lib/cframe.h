@@ -40,6 +40,7 @@ public:
 	/// @name CFrame Methods
 	//-----------------------------------------------------------------------------
 	//@{
+	/** pSystemWindow may only be nullptr if systemWindowType is kHeadless */
 	bool open (void* pSystemWindow, PlatformType systemWindowType = kDefaultNative, IPlatformFrameConfig* = nullptr);
 	/** closes the frame and calls forget */
 	void close ();
@@ -156,6 +157,33 @@ public:
 	CCoord getFocusWidth () const;
 	//@}
 
+	//-----------------------------------------------------------------------------
+	/// @name Layout Methods [new in 4.7]
+	//! Auto layout container views don't layout their children on every change, they schedule a
+	//! layout at the frame instead. The frame performs all scheduled layouts in one pass after the
+	//! current event was handled or before it draws.
+	//-----------------------------------------------------------------------------
+	//@{
+	struct LayoutStatistics
+	{
+		/** number of layout passes */
+		uint64_t numPasses {0};
+		/** number of container layouts of all layout passes */
+		uint64_t numLayouts {0};
+		/** number of container layouts of the last layout pass */
+		uint32_t numLayoutsLastPass {0};
+		/** number of layout passes between the last two draws of the frame */
+		uint32_t numPassesLastFrame {0};
+	};
+
+	/** schedule a layout of the view, see CAutoLayoutContainerView::setNeedsLayout */
+	void scheduleLayout (CAutoLayoutContainerView* view);
+	/** perform all scheduled layouts, containers are layouted before the containers inside of them */
+	void performScheduledLayouts ();
+	const LayoutStatistics& getLayoutStatistics () const;
+	void resetLayoutStatistics ();
+	//@}
+
 	using Function = std::function<void ()>;
 	/** Queue a function which will be executed after the current event was handled.
 	 *	Only allowed when inEventProcessing () is true
@@ -182,6 +182,15 @@ void CLayeredViewContainer::setAlphaValue (float alpha)
 		CViewContainer::setAlphaValue (alpha);
 }
 
+//-----------------------------------------------------------------------------
+bool CLayeredViewContainer::isOpaque () const
+{
+	// the content of the layer is composited by the platform
+	if (layer)
+		return CView::isOpaque ();
+	return CViewContainer::isOpaque ();
+}
+
 //-----------------------------------------------------------------------------
 void CLayeredViewContainer::drawRect (CDrawContext* pContext, const CRect& updateRect)
 {
@@ -41,6 +41,7 @@ public:
 	void parentSizeChanged () override;
 	void setViewSize (const CRect& rect, bool invalid = true) override;
 	void setAlphaValue (float alpha) override;
+	bool isOpaque () const override;
 //-----------------------------------------------------------------------------
 protected:
 	void drawRect (CDrawContext* pContext, const CRect& updateRect) override;
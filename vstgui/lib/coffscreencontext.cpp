@@ -14,6 +14,7 @@ COffscreenContext::COffscreenContext (CBitmap* bitmap)
 : CDrawContext (CRect (0, 0, bitmap->getWidth (), bitmap->getHeight ()))
 , bitmap (bitmap)
 {
+	bitmap->disableScaledBitmaps ();
 }
 
 //-----------------------------------------------------------------------------
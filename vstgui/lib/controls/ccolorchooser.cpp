@@ -108,6 +108,7 @@ public:
 			context->setFillColor (checkerBoardColor1);
 			context->drawRect (getViewSize (), kDrawFilled);
 			context->setFillColor (checkerBoardColor2);
+			CDrawContext::RectList rects;
 			CRect r (getViewSize ().left, getViewSize ().top, getViewSize ().left + 5, getViewSize ().top + 5);
 			for (int32_t x = 0; x < getViewSize ().getWidth (); x+=5)
 			{
@@ -117,10 +118,11 @@ public:
 				r.bottom = r.top + 5;
 				for (int32_t y = 0; y < getViewSize ().getHeight (); y+=10)
 				{
-					context->drawRect (r, kDrawFilled);
+					rects.push_back (r);
 					r.offset (0, 10);
 				}
 			}
+			context->drawRects (rects, kDrawFilled);
 		}
 		context->setLineWidth (1);
 		context->setFillColor (color);
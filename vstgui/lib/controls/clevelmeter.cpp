@@ -0,0 +1,383 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "clevelmeter.h"
+#include "../cdrawcontext.h"
+#include "../cframe.h"
+#include <cmath>
+
+namespace VSTGUI {
+
+//------------------------------------------------------------------------
+// LevelMeterModel
+//------------------------------------------------------------------------
+void LevelMeterModel::setInput (float level)
+{
+	if (level < 0.f)
+		level = 0.f;
+	else if (level > 1.f)
+		level = 1.f;
+	input = level;
+	if (!hasNewInput || level > inputMax)
+		inputMax = level;
+	hasNewInput = true;
+}
+
+//------------------------------------------------------------------------
+void LevelMeterModel::advance (uint32_t elapsedMs)
+{
+	auto seconds = elapsedMs / 1000.;
+
+	auto newPeak = static_cast<float> (peak - ballistics.peakRelease * seconds);
+	peak = std::max (std::max (newPeak, inputMax), 0.f);
+
+	if (ballistics.rmsWindow > 0.)
+	{
+		auto coefficient = 1. - std::exp (-static_cast<double> (elapsedMs) / ballistics.rmsWindow);
+		meanSquare += (input * input - meanSquare) * coefficient;
+		rms = static_cast<float> (std::sqrt (meanSquare));
+	}
+	else
+	{
+		meanSquare = input * input;
+		rms = input;
+	}
+
+	if (peak >= hold)
+	{
+		hold = peak;
+		holdCountdown = ballistics.holdTime;
+	}
+	else if (holdCountdown > 0.)
+	{
+		holdCountdown -= elapsedMs;
+	}
+	else
+	{
+		auto newHold = static_cast<float> (hold - ballistics.holdRelease * seconds);
+		hold = std::max (newHold, peak);
+	}
+
+	inputMax = input;
+	hasNewInput = false;
+}
+
+//------------------------------------------------------------------------
+void LevelMeterModel::reset ()
+{
+	input = inputMax = peak = rms = hold = 0.f;
+	meanSquare = holdCountdown = 0.;
+	hasNewInput = false;
+}
+
+//------------------------------------------------------------------------
+// CLevelMeter
+//------------------------------------------------------------------------
+/**
+ * CLevelMeter constructor.
+ * @param size the size of this view
+ * @param numSegments number of segments (LEDs)
+ * @param style combination of CLevelMeter::Style flags
+ */
+//------------------------------------------------------------------------
+CLevelMeter::CLevelMeter (const CRect& size, int32_t numSegments, int32_t style)
+: CControl (size, nullptr, 0)
+, numSegments (std::max (numSegments, 1))
+, style (style)
+{
+	setMin (0.f);
+	setMax (1.f);
+	updateSegmentRects ();
+	setWantsIdle (true);
+}
+
+//------------------------------------------------------------------------
+CLevelMeter::CLevelMeter (const CLevelMeter& m)
+: CControl (m)
+, model (m.model)
+, displayState (m.displayState)
+, segmentRects (m.segmentRects)
+, offBitmap (m.offBitmap)
+, numSegments (m.numSegments)
+, style (m.style)
+, segmentSpacing (m.segmentSpacing)
+, warnThreshold (m.warnThreshold)
+, clipThreshold (m.clipThreshold)
+, normalColor (m.normalColor)
+, warnColor (m.warnColor)
+, clipColor (m.clipColor)
+, rmsColor (m.rmsColor)
+, offColor (m.offColor)
+{
+	setWantsIdle (true);
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::setNumSegments (int32_t num)
+{
+	num = std::max (num, 1);
+	if (numSegments == num)
+		return;
+	numSegments = num;
+	updateSegmentRects ();
+	displayState = calculateDisplayState ();
+	invalid ();
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::setStyle (int32_t newStyle)
+{
+	if (style == newStyle)
+		return;
+	style = newStyle;
+	updateSegmentRects ();
+	displayState = calculateDisplayState ();
+	invalid ();
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::setSegmentSpacing (CCoord spacing)
+{
+	if (segmentSpacing == spacing)
+		return;
+	segmentSpacing = spacing;
+	updateSegmentRects ();
+	invalid ();
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::setSegmentColors (const CColor& normal, const CColor& warn, const CColor& clip)
+{
+	normalColor = normal;
+	warnColor = warn;
+	clipColor = clip;
+	invalid ();
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::setSegmentThresholds (float warn, float clip)
+{
+	warnThreshold = warn;
+	clipThreshold = clip;
+	invalid ();
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::setRMSColor (const CColor& color)
+{
+	rmsColor = color;
+	invalid ();
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::setOffColor (const CColor& color)
+{
+	offColor = color;
+	invalid ();
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::setOffBitmap (CBitmap* bitmap)
+{
+	offBitmap = bitmap;
+	invalid ();
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::setViewSize (const CRect& newSize, bool invalid)
+{
+	CControl::setViewSize (newSize, invalid);
+	updateSegmentRects ();
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::updateSegmentRects ()
+{
+	segmentRects.resize (static_cast<size_t> (numSegments));
+	const auto& vs = getViewSize ();
+	auto totalSpacing = segmentSpacing * (numSegments - 1);
+	if (style & kHorizontal)
+	{
+		auto segmentWidth = (vs.getWidth () - totalSpacing) / numSegments;
+		for (auto i = 0; i < numSegments; ++i)
+		{
+			auto& r = segmentRects[static_cast<size_t> (i)];
+			r = vs;
+			r.left = vs.left + i * (segmentWidth + segmentSpacing);
+			r.setWidth (segmentWidth);
+		}
+	}
+	else
+	{
+		auto segmentHeight = (vs.getHeight () - totalSpacing) / numSegments;
+		for (auto i = 0; i < numSegments; ++i)
+		{
+			auto& r = segmentRects[static_cast<size_t> (i)];
+			r = vs;
+			r.bottom = vs.bottom - i * (segmentHeight + segmentSpacing);
+			r.top = r.bottom - segmentHeight;
+		}
+	}
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::setValue (float val)
+{
+	CControl::setValue (val);
+	model.setInput (getValueNormalized ());
+}
+
+//------------------------------------------------------------------------
+bool CLevelMeter::isDirty () const
+{
+	// value changes are not drawn directly, they go through the model
+	return CView::isDirty ();
+}
+
+//------------------------------------------------------------------------
+bool CLevelMeter::attached (CView* parent)
+{
+	lastTicks = 0;
+	return CControl::attached (parent);
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::onIdle ()
+{
+	auto frame = getFrame ();
+	if (!frame)
+		return;
+	auto now = frame->getTicks ();
+	auto elapsed = lastTicks == 0 ? 0 : now - lastTicks;
+	lastTicks = now;
+	advance (elapsed);
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::advance (uint32_t elapsedMs)
+{
+	model.advance (elapsedMs);
+	auto newState = calculateDisplayState ();
+	invalidChangedSegments (displayState, newState);
+	displayState = newState;
+}
+
+//------------------------------------------------------------------------
+auto CLevelMeter::calculateDisplayState () const -> DisplayState
+{
+	auto toSegments = [this] (float level) {
+		return static_cast<int32_t> (level * numSegments + 0.5f);
+	};
+	DisplayState state;
+	if (style & kShowPeak)
+		state.peakSegments = toSegments (model.getPeak ());
+	if (style & kShowRMS)
+		state.rmsSegments = toSegments (model.getRMS ());
+	if (style & kShowHold)
+		state.holdSegment = toSegments (model.getHold ()) - 1;
+	return state;
+}
+
+//------------------------------------------------------------------------
+auto CLevelMeter::getSegmentState (const DisplayState& state, int32_t index) const -> SegmentState
+{
+	if (index < state.rmsSegments)
+		return SegmentState::kRMS;
+	if (index < state.peakSegments)
+		return SegmentState::kPeak;
+	if (index == state.holdSegment)
+		return SegmentState::kHold;
+	return SegmentState::kOff;
+}
+
+//------------------------------------------------------------------------
+auto CLevelMeter::getSegmentState (int32_t index) const -> SegmentState
+{
+	return getSegmentState (displayState, index);
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::invalidChangedSegments (const DisplayState& oldState, const DisplayState& newState)
+{
+	// peak and hold segments are drawn the same way
+	auto drawState = [this] (const DisplayState& state, int32_t index) {
+		auto segmentState = getSegmentState (state, index);
+		return segmentState == SegmentState::kHold ? SegmentState::kPeak : segmentState;
+	};
+	CRect dirty;
+	for (auto i = 0; i < numSegments; ++i)
+	{
+		if (drawState (oldState, i) != drawState (newState, i))
+		{
+			if (dirty.isEmpty ())
+				dirty = getSegmentRect (i);
+			else
+				dirty.unite (getSegmentRect (i));
+		}
+		else if (!dirty.isEmpty ())
+		{
+			invalidRect (dirty);
+			dirty = CRect ();
+		}
+	}
+	if (!dirty.isEmpty ())
+		invalidRect (dirty);
+}
+
+//------------------------------------------------------------------------
+CColor CLevelMeter::getSegmentColor (int32_t index, SegmentState state) const
+{
+	switch (state)
+	{
+		case SegmentState::kOff: return offColor;
+		case SegmentState::kRMS: return rmsColor;
+		case SegmentState::kPeak:
+		case SegmentState::kHold:
+		{
+			auto position = (index + 0.5f) / numSegments;
+			if (position >= clipThreshold)
+				return clipColor;
+			if (position >= warnThreshold)
+				return warnColor;
+			return normalColor;
+		}
+	}
+	return offColor;
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::draw (CDrawContext* pContext)
+{
+	drawRect (pContext, getViewSize ());
+}
+
+//------------------------------------------------------------------------
+void CLevelMeter::drawRect (CDrawContext* pContext, const CRect& updateRect)
+{
+	auto onBitmap = getOnBitmap ();
+	if (!onBitmap)
+		pContext->setDrawMode (kAliasing);
+	const auto& vs = getViewSize ();
+	for (auto i = 0; i < numSegments; ++i)
+	{
+		const auto& r = getSegmentRect (i);
+		if (!r.rectOverlap (updateRect))
+			continue;
+		auto state = getSegmentState (i);
+		if (onBitmap)
+		{
+			auto bitmap = state == SegmentState::kOff ? offBitmap.get () : onBitmap;
+			if (bitmap)
+				bitmap->draw (pContext, r, CPoint (r.left - vs.left, r.top - vs.top));
+		}
+		else
+		{
+			pContext->setFillColor (getSegmentColor (i, state));
+			pContext->drawRect (r, kDrawFilled);
+		}
+	}
+	setDirty (false);
+}
+
+} // namespace
@@ -0,0 +1,192 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#ifndef __clevelmeter__
+#define __clevelmeter__
+
+#include "ccontrol.h"
+#include "../ccolor.h"
+#include "../cbitmap.h"
+#include <vector>
+
+namespace VSTGUI {
+
+//-----------------------------------------------------------------------------
+/** @brief Ballistics of a level meter
+ *
+ *	Holds the peak, RMS and peak hold levels of one meter channel. The levels are only changed
+ *	by advance() which should be called from a clock (normally the idle of the owning view) and
+ *	never while drawing. All levels are normalized [0..1].
+ *
+ *	@ingroup new_in_4_7
+ */
+//-----------------------------------------------------------------------------
+class LevelMeterModel
+{
+public:
+	struct Ballistics
+	{
+		/** peak fall back in normalized units per second */
+		double peakRelease {1.5};
+		/** integration time of the RMS level in milliseconds */
+		double rmsWindow {300.};
+		/** time in milliseconds the peak hold stays before it falls back */
+		double holdTime {1500.};
+		/** peak hold fall back in normalized units per second */
+		double holdRelease {0.5};
+	};
+
+	LevelMeterModel () = default;
+
+	void setBallistics (const Ballistics& newBallistics) { ballistics = newBallistics; }
+	const Ballistics& getBallistics () const { return ballistics; }
+
+	/** feed a new input level. Multiple inputs between two advance calls are combined. */
+	void setInput (float level);
+	/** advance the ballistics by elapsedMs milliseconds */
+	void advance (uint32_t elapsedMs);
+	/** reset all levels to zero */
+	void reset ();
+
+	float getPeak () const { return peak; }
+	float getRMS () const { return rms; }
+	float getHold () const { return hold; }
+
+private:
+	Ballistics ballistics;
+	float input {0.f};
+	float inputMax {0.f};
+	float peak {0.f};
+	float rms {0.f};
+	float hold {0.f};
+	double meanSquare {0.};
+	double holdCountdown {0.};
+	bool hasNewInput {false};
+};
+
+//-----------------------------------------------------------------------------
+// CLevelMeter Declaration
+//! @brief a segmented level meter with peak, RMS and peak hold display
+/*! The control value is the input level of the meter. The ballistics run in a LevelMeterModel
+ *	which is advanced on idle (see CView::idleRate), drawing only reads the last computed state.
+ *	Only segments which changed their lit state are invalidated.
+ *
+ *	Segments are either drawn as filled rects with the segment colors or, if an on bitmap is set,
+ *	as sub rects of the on and off bitmaps.
+ *	@ingroup controls
+ *	@ingroup new_in_4_7
+ */
+//-----------------------------------------------------------------------------
+class CLevelMeter : public CControl
+{
+public:
+	enum Style
+	{
+		kHorizontal = 1 << 0,
+		kVertical = 1 << 1,
+		/** show the peak level */
+		kShowPeak = 1 << 2,
+		/** show the RMS level */
+		kShowRMS = 1 << 3,
+		/** show the peak hold segment */
+		kShowHold = 1 << 4,
+	};
+
+	/** lit state of one segment */
+	enum class SegmentState : uint8_t
+	{
+		kOff,
+		kPeak,
+		kRMS,
+		kHold,
+	};
+
+	CLevelMeter (const CRect& size, int32_t numSegments, int32_t style = kVertical | kShowPeak | kShowHold);
+	CLevelMeter (const CLevelMeter& meter);
+
+	//-----------------------------------------------------------------------------
+	/// @name CLevelMeter Methods
+	//-----------------------------------------------------------------------------
+	//@{
+	void setNumSegments (int32_t numSegments);
+	int32_t getNumSegments () const { return numSegments; }
+
+	void setStyle (int32_t newStyle);
+	int32_t getStyle () const { return style; }
+
+	/** set the gap between two segments */
+	void setSegmentSpacing (CCoord spacing);
+	CCoord getSegmentSpacing () const { return segmentSpacing; }
+
+	/** set the segment colors. Segments above the threshold (normalized) use the warn/clip color */
+	void setSegmentColors (const CColor& normal, const CColor& warn, const CColor& clip);
+	void setSegmentThresholds (float warnThreshold, float clipThreshold);
+	void setRMSColor (const CColor& color);
+	void setOffColor (const CColor& color);
+
+	/** if an on bitmap is set the segments are drawn from the bitmaps instead of as filled rects */
+	void setOnBitmap (CBitmap* bitmap) { setBackground (bitmap); }
+	CBitmap* getOnBitmap () const { return getBackground (); }
+	void setOffBitmap (CBitmap* bitmap);
+	CBitmap* getOffBitmap () const { return offBitmap; }
+
+	LevelMeterModel& getModel () { return model; }
+	const LevelMeterModel& getModel () const { return model; }
+
+	/** advance the ballistics and invalidate the segments which changed. Called on idle. */
+	void advance (uint32_t elapsedMs);
+	/** get the currently displayed state of a segment, index 0 is at the bottom/left */
+	SegmentState getSegmentState (int32_t index) const;
+	/** get the rect of a segment */
+	const CRect& getSegmentRect (int32_t index) const { return segmentRects[static_cast<size_t> (index)]; }
+	//@}
+
+	// overrides
+	void setValue (float val) override;
+	void draw (CDrawContext* pContext) override;
+	void drawRect (CDrawContext* pContext, const CRect& updateRect) override;
+	void setViewSize (const CRect& newSize, bool invalid = true) override;
+	bool isDirty () const override;
+	bool attached (CView* parent) override;
+	void onIdle () override;
+
+	CLASS_METHODS(CLevelMeter, CControl)
+protected:
+	~CLevelMeter () noexcept override = default;
+
+	struct DisplayState
+	{
+		int32_t peakSegments {0};
+		int32_t rmsSegments {0};
+		int32_t holdSegment {-1};
+	};
+
+	SegmentState getSegmentState (const DisplayState& state, int32_t index) const;
+	DisplayState calculateDisplayState () const;
+	void invalidChangedSegments (const DisplayState& oldState, const DisplayState& newState);
+	void updateSegmentRects ();
+	CColor getSegmentColor (int32_t index, SegmentState state) const;
+
+	LevelMeterModel model;
+	DisplayState displayState;
+	std::vector<CRect> segmentRects;
+	SharedPointer<CBitmap> offBitmap;
+
+	int32_t numSegments;
+	int32_t style;
+	CCoord segmentSpacing {1.};
+	float warnThreshold {0.7f};
+	float clipThreshold {0.9f};
+	uint32_t lastTicks {0};
+
+	CColor normalColor {kGreenCColor};
+	CColor warnColor {kYellowCColor};
+	CColor clipColor {kRedCColor};
+	CColor rmsColor {0, 160, 0, 255};
+	CColor offColor {40, 40, 40, 255};
+};
+
+} // namespace
+
+#endif
@@ -3,6 +3,7 @@
 // distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
 
 #include "crowcolumnview.h"
+#include "cframe.h"
 #include "animation/animations.h"
 #include "animation/timingfunctions.h"
 
@@ -27,8 +28,7 @@ void CRowColumnView::setStyle (Style newStyle)
 	if (newStyle != style)
 	{
 		style = newStyle;
-		if (isAttached ())
-			layoutViews ();
+		setNeedsLayout ();
 	}
 }
 
@@ -38,8 +38,7 @@ void CRowColumnView::setSpacing (CCoord newSpacing)
 	if (newSpacing != spacing)
 	{
 		spacing = newSpacing;
-		if (isAttached ())
-			layoutViews ();
+		setNeedsLayout ();
 	}
 }
 
@@ -49,8 +48,7 @@ void CRowColumnView::setMargin (const CRect& newMargin)
 	if (newMargin != margin)
 	{
 		margin = newMargin;
-		if (isAttached ())
-			layoutViews ();
+		setNeedsLayout ();
 	}
 }
 
@@ -60,8 +58,7 @@ void CRowColumnView::setLayoutStyle (LayoutStyle style)
 	if (style != layoutStyle)
 	{
 		layoutStyle = style;
-		if (isAttached ())
-			layoutViews ();
+		setNeedsLayout ();
 	}
 }
 
@@ -234,10 +231,7 @@ bool CRowColumnView::sizeToFit ()
 CMessageResult CRowColumnView::notify (CBaseObject* sender, IdStringPtr message)
 {
 	if (message == kMsgViewSizeChanged)
-	{
-		if (isAttached ())
-			layoutViews ();
-	}
+		setNeedsLayout ();
 	return CViewContainer::notify (sender, message);
 }
 
@@ -249,6 +243,32 @@ CAutoLayoutContainerView::CAutoLayoutContainerView (const CRect& size)
 {
 }
 
+//--------------------------------------------------------------------------------
+void CAutoLayoutContainerView::setNeedsLayout ()
+{
+	if (layoutPending || !isAttached ())
+		return;
+	if (auto frame = getFrame ())
+	{
+		layoutPending = true;
+		invalid ();
+		frame->scheduleLayout (this);
+	}
+	else
+		layoutViews ();
+}
+
+//--------------------------------------------------------------------------------
+bool CAutoLayoutContainerView::layoutIfNeeded ()
+{
+	if (!layoutPending)
+		return false;
+	// changes while layouting are part of this layout
+	layoutViews ();
+	layoutPending = false;
+	return true;
+}
+
 //--------------------------------------------------------------------------------
 bool CAutoLayoutContainerView::attached (CView* parent)
 {
@@ -260,12 +280,19 @@ bool CAutoLayoutContainerView::attached (CView* parent)
 	return false;
 }
 
+//--------------------------------------------------------------------------------
+bool CAutoLayoutContainerView::removed (CView* parent)
+{
+	// the view is layouted again when it is attached
+	layoutPending = false;
+	return CViewContainer::removed (parent);
+}
+
 //--------------------------------------------------------------------------------
 void CAutoLayoutContainerView::setViewSize (const CRect& rect, bool invalid)
 {
 	CViewContainer::setViewSize (rect, invalid);
-	if (isAttached ())
-		layoutViews ();
+	setNeedsLayout ();
 }
 
 //--------------------------------------------------------------------------------
@@ -273,8 +300,7 @@ bool CAutoLayoutContainerView::addView (CView* pView, CView* pBefore)
 {
 	if (CViewContainer::addView (pView, pBefore))
 	{
-		if (isAttached ())
-			layoutViews ();
+		setNeedsLayout ();
 		return true;
 	}
 	return false;
@@ -285,8 +311,7 @@ bool CAutoLayoutContainerView::removeView (CView* pView, bool withForget)
 {
 	if (CViewContainer::removeView (pView, withForget))
 	{
-		if (isAttached ())
-			layoutViews ();
+		setNeedsLayout ();
 		return true;
 	}
 	return false;
@@ -297,8 +322,7 @@ bool CAutoLayoutContainerView::changeViewZOrder (CView* view, uint32_t newIndex)
 {
 	if (CViewContainer::changeViewZOrder (view, newIndex))
 	{
-		if (isAttached ())
-			layoutViews ();
+		setNeedsLayout ();
 		return true;
 	}
 	return false;
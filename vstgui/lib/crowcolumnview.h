@@ -19,13 +19,31 @@ public:
 
 	virtual void layoutViews () = 0;
 
+	/** mark the view as needing a layout.
+	 *
+	 *	When the view is attached, the frame performs the layout once for all changes after the
+	 *	current event was handled or before it draws the next time, see
+	 *	CFrame::performScheduledLayouts. Otherwise the view is layouted when it is attached.
+	 *	@ingroup new_in_4_7
+	 */
+	void setNeedsLayout ();
+	bool needsLayout () const { return layoutPending; }
+	/** perform a pending layout now
+	 *	@return true if the views were layouted
+	 *	@ingroup new_in_4_7
+	 */
+	bool layoutIfNeeded ();
+
 	bool attached (CView* parent) override;
+	bool removed (CView* parent) override;
 	void setViewSize (const CRect& rect, bool invalid = true) override;
 	bool addView (CView* pView, CView* pBefore = nullptr) override;
 	bool removeView (CView* pView, bool withForget = true) override;
 	bool changeViewZOrder (CView* view, uint32_t newIndex) override;
 
 	CLASS_METHODS_VIRTUAL(CAutoLayoutContainerView, CViewContainer)
+private:
+	bool layoutPending {false};
 };
 
 
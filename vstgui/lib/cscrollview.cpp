@@ -33,6 +33,9 @@ public:
 	bool isDirty () const override;
 
 	void setAutoDragScroll (bool state) { autoDragScroll = state; }
+	void setScrollByTransform (bool state);
+
+	CRect getVisibleSize (const CRect& rect) const override;
 
 	bool attached (CView* parent) override;
 	CMessageResult notify (CBaseObject* sender, IdStringPtr message) override;
@@ -73,11 +76,14 @@ protected:
 	};
 
 	bool getScrollValue (const CPoint& where, float& x, float& y);
+	void moveChildren (const CPoint& distance);
+	bool canScrollByBlit () const;
 
 	CRect containerSize;
 	CPoint offset;
 	bool autoDragScroll;
 	bool inScrolling;
+	bool scrollByTransform {false};
 };
 
 //-----------------------------------------------------------------------------
@@ -100,6 +106,7 @@ CScrollContainer::CScrollContainer (const CScrollContainer& v)
 , offset (v.offset)
 , autoDragScroll (v.autoDragScroll)
 , inScrolling (false)
+, scrollByTransform (v.scrollByTransform)
 {
 }
 
@@ -113,8 +120,6 @@ void CScrollContainer::setContainerSize (const CRect& cs)
 //-----------------------------------------------------------------------------
 void CScrollContainer::setScrollOffset (CPoint newOffset, bool redraw)
 {
-	newOffset.x = floor (newOffset.x + 0.5);
-	newOffset.y = floor (newOffset.y + 0.5);
 	if (containerSize.getWidth () >= getViewSize ().getWidth ())
 	{
 		if (newOffset.x < containerSize.left - (containerSize.getWidth () - getViewSize ().getWidth ()))
@@ -131,26 +136,22 @@ void CScrollContainer::setScrollOffset (CPoint newOffset, bool redraw)
 		newOffset.y = containerSize.top;
 	if (newOffset.y > containerSize.bottom)
 		newOffset.y = containerSize.bottom;
-	CPoint diff ((int32_t)(newOffset.x - offset.x), (int32_t)(offset.y - newOffset.y));
+	// the limits may be fractional, the children, the transform and the blit must all be moved
+	// by the same integral distance
+	newOffset.x = floor (newOffset.x + 0.5);
+	newOffset.y = floor (newOffset.y + 0.5);
+	CPoint diff (newOffset.x - offset.x, offset.y - newOffset.y);
 	if (diff.x == 0 && diff.y == 0)
 		return;
-	inScrolling = true;
-	for (const auto& pV : getChildren ())
-	{
-		CRect r = pV->getViewSize ();
-		CRect mr;
-		pV->getMouseableArea (mr);
-		r.offset (diff.x , diff.y);
-		pV->setViewSize (r, false);
-		mr.offset (diff.x , diff.y);
-		pV->setMouseableArea (mr);
-	}
-	inScrolling = false;
+	if (scrollByTransform)
+		setTransform (CGraphicsTransform ().translate (newOffset.x, -newOffset.y));
+	else
+		moveChildren (diff);
 	offset = newOffset;
 	if (!isAttached ())
 		return;
 
-	if (getTransparency ())
+	if (!canScrollByBlit ())
 	{
 		invalid ();
 	}
@@ -177,6 +178,91 @@ void CScrollContainer::setScrollOffset (CPoint newOffset, bool redraw)
 	}
 }
 
+//-----------------------------------------------------------------------------
+void CScrollContainer::moveChildren (const CPoint& distance)
+{
+	inScrolling = true;
+	for (const auto& pV : getChildren ())
+	{
+		CRect r = pV->getViewSize ();
+		CRect mr;
+		pV->getMouseableArea (mr);
+		r.offset (distance.x , distance.y);
+		pV->setViewSize (r, false);
+		mr.offset (distance.x , distance.y);
+		pV->setMouseableArea (mr);
+	}
+	inScrolling = false;
+}
+
+//-----------------------------------------------------------------------------
+void CScrollContainer::setScrollByTransform (bool state)
+{
+	if (scrollByTransform == state)
+		return;
+	scrollByTransform = state;
+	// move the scroll offset from the children to the transform or vice versa
+	CPoint distance (offset.x, -offset.y);
+	if (state)
+	{
+		moveChildren (CPoint (-distance.x, -distance.y));
+		setTransform (CGraphicsTransform ().translate (distance));
+	}
+	else
+	{
+		setTransform (CGraphicsTransform ());
+		moveChildren (distance);
+	}
+}
+
+//-----------------------------------------------------------------------------
+CRect CScrollContainer::getVisibleSize (const CRect& rect) const
+{
+	if (!scrollByTransform)
+		return CViewContainer::getVisibleSize (rect);
+	CRect viewSize (getViewSize ());
+	CRect result (rect);
+	getTransform ().transform (result);
+	result.offset (viewSize.left, viewSize.top);
+	result.bound (viewSize);
+	if (auto parent = getParentView ())
+		result = static_cast<CViewContainer*> (parent)->getVisibleSize (result);
+	result.offset (-viewSize.left, -viewSize.top);
+	getTransform ().inverse ().transform (result);
+	return result;
+}
+
+//-----------------------------------------------------------------------------
+bool CScrollContainer::canScrollByBlit () const
+{
+	auto parent = getParentView () ? getParentView ()->asViewContainer () : nullptr;
+	if (!parent)
+		return !getTransparency ();
+	// overlay scrollbars are drawn above the content and would be moved with it
+	auto scrollView = dynamic_cast<CScrollView*> (parent);
+	if (scrollView && scrollView->getStyle () & CScrollView::kOverlayScrollbars)
+		return false;
+	bool overlapped = false;
+	parent->forEachChild ([&] (CView* view) {
+		if (view == this || !view->isVisible ())
+			return;
+		CRect r (view->getViewSize ());
+		r.bound (getViewSize ());
+		if (!r.isEmpty ())
+			overlapped = true;
+	});
+	if (overlapped)
+		return false;
+	if (!getTransparency ())
+		return true;
+	// a transparent container can only be blitted if the parent paints its whole area. The
+	// background of a scroll view is filled by CViewContainer::drawBackgroundRect for its whole
+	// view size, so the automatic opacity of the view container can be used here.
+	if (scrollView)
+		return scrollView->CViewContainer::isOpaque ();
+	return parent->isOpaque ();
+}
+
 //-----------------------------------------------------------------------------
 bool CScrollContainer::isDirty () const
 {
@@ -461,6 +547,7 @@ void CScrollView::recalculateSubViews ()
 	if (style & kOverlayScrollbars)
 		CViewContainer::changeViewZOrder (sc, 0);
 	sc->setAutoDragScroll ((style & kAutoDragScrolling) ? true : false);
+	sc->setScrollByTransform ((style & kScrollByTransform) ? true : false);
 	recalculateSubViewsRecursionGard = false;
 }
 
@@ -747,6 +834,13 @@ void CScrollView::drawBackgroundRect (CDrawContext *pContext, const CRect& _upda
 	CViewContainer::drawBackgroundRect (pContext, r);
 }
 
+//-----------------------------------------------------------------------------
+bool CScrollView::isOpaque () const
+{
+	// drawBackgroundRect is overridden, so only the opaque flag can be trusted
+	return CView::isOpaque ();
+}
+
 //-----------------------------------------------------------------------------
 bool CScrollView::onWheel (const CPoint &where, const CMouseWheelAxis &axis, const float &distance, const CButtonState &buttons)
 {
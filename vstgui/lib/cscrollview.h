@@ -30,6 +30,7 @@ protected:
 		kOverlayScrollbarsFlag,
 		kFollowFocusViewFlag,
 		kAutoHideScrollbarsFlag,
+		kScrollByTransformFlag,
 
 		kLastScrollViewStyleFlag
 	};
@@ -54,7 +55,12 @@ public:
 		/** scroll to focus view when focus view changes */
 		kFollowFocusView = 1 << kFollowFocusViewFlag,
 		/** automatically hides the scrollbar if the container size is smaller than the size of the scrollview */
-		kAutoHideScrollbars = 1 << kAutoHideScrollbarsFlag
+		kAutoHideScrollbars = 1 << kAutoHideScrollbarsFlag,
+		/** scroll by changing the transform of the container instead of moving every subview.
+		 *	The view sizes of the subviews stay in content coordinates.
+		 *	@ingroup new_in_4_7
+		 */
+		kScrollByTransform = 1 << kScrollByTransformFlag
 	};
 
 	//-----------------------------------------------------------------------------
@@ -93,6 +99,7 @@ public:
 	CView* getView (uint32_t index) const override;
 	bool changeViewZOrder (CView* view, uint32_t newIndex) override;
 	void drawBackgroundRect (CDrawContext* pContext, const CRect& _updateRect) override;
+	bool isOpaque () const override;
 	bool onWheel (const CPoint& where, const CMouseWheelAxis& axis, const float& distance, const CButtonState& buttons) override;
 	void valueChanged (CControl* pControl) override;
 	void setTransparency (bool val) override;
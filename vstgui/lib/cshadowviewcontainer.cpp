@@ -215,6 +215,13 @@ void CShadowViewContainer::drawBackgroundRect (CDrawContext* pContext, const CRe
 	}
 }
 
+//-----------------------------------------------------------------------------
+bool CShadowViewContainer::isOpaque () const
+{
+	// the background is drawn with the shadow intensity
+	return CView::isOpaque ();
+}
+
 //-----------------------------------------------------------------------------
 void CShadowViewContainer::setViewSize (const CRect& rect, bool invalid)
 {
@@ -47,6 +47,7 @@ public:
 	bool attached (CView* parent) override;
 	void drawRect (CDrawContext* pContext, const CRect& updateRect) override;
 	void drawBackgroundRect (CDrawContext* pContext, const CRect& _updateRect) override;
+	bool isOpaque () const override;
 	void setViewSize (const CRect& rect, bool invalid = true) override;
 	CMessageResult notify (CBaseObject* sender, IdStringPtr message) override;
 
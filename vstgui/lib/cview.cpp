@@ -5,6 +5,7 @@
 #include "cview.h"
 #include "cdrawcontext.h"
 #include "cbitmap.h"
+#include "cdisplaylist.h"
 #include "cframe.h"
 #include "cvstguitimer.h"
 #include "cgraphicspath.h"
@@ -17,6 +18,7 @@
 #include "platform/iplatformframe.h"
 #include <cassert>
 #include <unordered_map>
+#include <vector>
 #if DEBUG
 #include <list>
 #include <typeinfo>
@@ -144,6 +146,25 @@ protected:
 };
 std::unique_ptr<IdleViewUpdater> IdleViewUpdater::gInstance;
 
+//-----------------------------------------------------------------------------
+struct ResizeTransactionEntry
+{
+	ResizeTransactionEntry (CView* view, const CRect& oldSize, bool invalid)
+	: view (view), oldSize (oldSize), invalid (invalid) {}
+
+	SharedPointer<CView> view;
+	CRect oldSize;
+	bool invalid;
+};
+
+//-----------------------------------------------------------------------------
+struct ResizeTransactionState
+{
+	uint32_t depth {0};
+	std::vector<ResizeTransactionEntry> entries;
+};
+static ResizeTransactionState gResizeTransaction;
+
 } // CViewInternal
 
 uint32_t CView::idleRate = 30;
@@ -167,6 +188,7 @@ bool CView::kDirtyCallAlwaysOnMainThread = false;
 const CViewAttributeID kCViewAttributeReferencePointer = 'cvrp';
 const CViewAttributeID kCViewTooltipAttribute = 'cvtt';
 const CViewAttributeID kCViewControllerAttribute = 'ictr';
+const CViewAttributeID kCViewClassNameAttribute = 'cvcr';
 const CViewAttributeID kCViewHitTestPathAttribute = 'cvht';
 const CViewAttributeID kCViewCustomDropTarget = 'cvdt';
 
@@ -193,6 +215,19 @@ struct CView::Impl
 	
 	SharedPointer<CBitmap> background;
 	SharedPointer<CBitmap> disabledBackground;
+
+	struct DisplayListCache
+	{
+		SharedPointer<CDisplayList> displayList;
+		CRect recordedSize;
+		double scaleFactor {0.};
+		uint32_t version {0};
+		bool valid {false};
+	};
+	std::unique_ptr<DisplayListCache> displayListCache;
+	uint32_t drawContentVersion {0};
+	/** index + 1 of the entry in the current resize transaction */
+	uint32_t resizeTransactionEntry {0};
 };
 
 //-----------------------------------------------------------------------------
@@ -222,6 +257,8 @@ CView::CView (const CView& v)
 	pImpl->alphaValue = v.pImpl->alphaValue;
 	pImpl->background = v.pImpl->background;
 	pImpl->disabledBackground = v.pImpl->disabledBackground;
+	if (v.pImpl->displayListCache)
+		setDisplayListCacheEnabled (true);
 	setHitTestPath (v.getHitTestPath ());
 
 	for (auto& attribute : v.pImpl->attributes)
@@ -552,6 +589,7 @@ CGraphicsTransform CView::getGlobalTransform () const
  */
 void CView::invalidRect (const CRect& rect)
 {
+	++pImpl->drawContentVersion;
 	if (isAttached () && hasViewFlag (kVisible))
 	{
 		vstgui_assert (pImpl->parentView);
@@ -572,6 +610,72 @@ void CView::draw (CDrawContext* pContext)
 	setDirty (false);
 }
 
+//-----------------------------------------------------------------------------
+void CView::setDisplayListCacheEnabled (bool state)
+{
+	if (state == isDisplayListCacheEnabled ())
+		return;
+	if (state)
+		pImpl->displayListCache = std::unique_ptr<Impl::DisplayListCache> (new Impl::DisplayListCache ());
+	else
+		pImpl->displayListCache = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+bool CView::isDisplayListCacheEnabled () const
+{
+	return pImpl->displayListCache != nullptr;
+}
+
+//-----------------------------------------------------------------------------
+uint32_t CView::getDrawContentVersion () const
+{
+	return pImpl->drawContentVersion;
+}
+
+//-----------------------------------------------------------------------------
+/**
+ * @param pContext draw context in which to draw
+ * @param updateRect the rect which needs to be drawn
+ */
+void CView::drawRectCached (CDrawContext* pContext, const CRect& updateRect)
+{
+	auto cache = pImpl->displayListCache.get ();
+	if (cache == nullptr || asViewContainer ())
+	{
+		drawRect (pContext, updateRect);
+		return;
+	}
+	// a dirty view was changed but not yet invalidated
+	if (isDirty ())
+		++pImpl->drawContentVersion;
+
+	const auto& viewSize = getViewSize ();
+	auto scaleFactor = pContext->getScaleFactor ();
+	auto version = getDrawContentVersion ();
+	if (!cache->valid || cache->version != version || cache->scaleFactor != scaleFactor ||
+	    cache->recordedSize.getSize () != viewSize.getSize ())
+	{
+		cache->displayList = CDisplayList::record (
+		    viewSize, scaleFactor, [this, &viewSize] (CDrawContext* context) {
+			    drawRect (context, viewSize);
+		    });
+		cache->recordedSize = viewSize;
+		cache->scaleFactor = scaleFactor;
+		cache->version = version;
+		cache->valid = true;
+	}
+	if (cache->displayList)
+	{
+		cache->displayList->replay (pContext, viewSize.getTopLeft () - cache->recordedSize.getTopLeft ());
+		setDirty (false);
+	}
+	else
+	{
+		drawRect (pContext, updateRect);
+	}
+}
+
 //-----------------------------------------------------------------------------
 /**
  * @param where location
@@ -706,20 +810,82 @@ void CView::setViewSize (const CRect& newSize, bool doInvalid)
 {
 	if (getViewSize () != newSize)
 	{
+		auto& transaction = CViewInternal::gResizeTransaction;
+		if (transaction.depth > 0)
+		{
+			if (pImpl->resizeTransactionEntry == 0)
+			{
+				transaction.entries.emplace_back (this, getViewSize (), doInvalid);
+				pImpl->resizeTransactionEntry = static_cast<uint32_t> (transaction.entries.size ());
+			}
+			else if (doInvalid)
+				transaction.entries[pImpl->resizeTransactionEntry - 1].invalid = true;
+			pImpl->size = newSize;
+			return;
+		}
 		if (doInvalid && kDirtyCallAlwaysOnMainThread)
 			invalid ();
 		CRect oldSize = getViewSize ();
 		pImpl->size = newSize;
 		if (doInvalid)
 			setDirty ();
-		if (getParentView ())
-			getParentView ()->notify (this, kMsgViewSizeChanged);
-		if (pImpl->viewListeners)
+		dispatchViewSizeChanged (oldSize);
+	}
+}
+
+//------------------------------------------------------------------------------
+void CView::dispatchViewSizeChanged (const CRect& oldSize)
+{
+	if (getParentView ())
+		getParentView ()->notify (this, kMsgViewSizeChanged);
+	if (pImpl->viewListeners)
+	{
+		pImpl->viewListeners->forEach (
+		    [&] (IViewListener* listener) { listener->viewSizeChanged (this, oldSize); });
+	}
+}
+
+//------------------------------------------------------------------------------
+CView::ResizeTransaction::ResizeTransaction ()
+{
+	++CViewInternal::gResizeTransaction.depth;
+}
+
+//------------------------------------------------------------------------------
+CView::ResizeTransaction::~ResizeTransaction () noexcept
+{
+	auto& transaction = CViewInternal::gResizeTransaction;
+	vstgui_assert (transaction.depth > 0);
+	if (--transaction.depth > 0)
+		return;
+	// the notifications may start new transactions
+	decltype (transaction.entries) entries;
+	entries.swap (transaction.entries);
+	for (auto& entry : entries)
+		entry.view->pImpl->resizeTransactionEntry = 0;
+	for (auto& entry : entries)
+	{
+		auto& view = entry.view;
+		if (view->getViewSize () == entry.oldSize)
+			continue;
+		if (entry.invalid)
 		{
-			pImpl->viewListeners->forEach (
-			    [&] (IViewListener* listener) { listener->viewSizeChanged (this, oldSize); });
+			CRect r (entry.oldSize);
+			r.unite (view->getViewSize ());
+			if (auto parent = view->getParentView ())
+			{
+				if (view->isVisible ())
+					parent->invalidRect (r);
+			}
+			else
+				view->invalid ();
 		}
+		view->dispatchViewSizeChanged (entry.oldSize);
 	}
+	// keep the allocated memory for the next transaction
+	entries.clear ();
+	if (transaction.entries.empty ())
+		entries.swap (transaction.entries);
 }
 
 //------------------------------------------------------------------------------
@@ -43,6 +43,8 @@ extern IdStringPtr kMsgViewSizeChanged;
 extern const CViewAttributeID kCViewAttributeReferencePointer;	// 'cvrp'
 extern const CViewAttributeID kCViewTooltipAttribute;			// 'cvtt'
 extern const CViewAttributeID kCViewControllerAttribute;		// 'ictr'
+/** IdStringPtr with the class name of the view, set by the UIViewFactory */
+extern const CViewAttributeID kCViewClassNameAttribute;		// 'cvcr'
 
 //-----------------------------------------------------------------------------
 // CView Declaration
@@ -81,6 +83,28 @@ public:
 	virtual void setVisible (bool state);
 	/** get visibility state */
 	bool isVisible () const { return hasViewFlag (kVisible) && getAlphaValue () > 0.f; }
+
+	/** cache the drawing of the view in a display list.
+	 *	The display list is replayed instead of calling drawRect as long as the view size, the
+	 *	scale factor of the draw context and the draw content version do not change.
+	 *	Not supported for view containers.
+	 *	@ingroup new_in_4_7
+	 */
+	void setDisplayListCacheEnabled (bool state);
+	/** returns true if the drawing of the view is cached in a display list
+	 *	@ingroup new_in_4_7
+	 */
+	bool isDisplayListCacheEnabled () const;
+	/** returns the version of the content the view draws.
+	 *	The default implementation returns a counter which is incremented on every invalidation of
+	 *	the view.
+	 *	@ingroup new_in_4_7
+	 */
+	virtual uint32_t getDrawContentVersion () const;
+	/** draw the view via its display list cache if enabled, otherwise calls drawRect
+	 *	@ingroup new_in_4_7
+	 */
+	void drawRectCached (CDrawContext* pContext, const CRect& updateRect);
 	//@}
 
 	//-----------------------------------------------------------------------------
@@ -174,6 +198,27 @@ public:
 	virtual CRect getVisibleViewSize () const;
 	/** notification that one of the views parent has changed its size */
 	virtual void parentSizeChanged () {}
+
+	/** @brief Collects the size changes of views
+	 *
+	 *	While a resize transaction exists, views which change their size neither invalidate
+	 *	themselves nor send size change notifications. When the outermost transaction ends, every
+	 *	view which changed its size invalidates the union of its old and new size once and gets
+	 *	one notification with its size before the transaction (kMsgViewSizeChanged to the parent
+	 *	view and IViewListener::viewSizeChanged). CViewContainer::setViewSize autosizes its
+	 *	children inside of a transaction.
+	 *
+	 *	@ingroup new_in_4_7
+	 */
+	class ResizeTransaction
+	{
+	public:
+		ResizeTransaction ();
+		~ResizeTransaction () noexcept;
+
+		ResizeTransaction (const ResizeTransaction&) = delete;
+		ResizeTransaction& operator= (const ResizeTransaction&) = delete;
+	};
 	/** conversion from frame coordinates to local view coordinates */
 	virtual CPoint& frameToLocal (CPoint& point) const;
 	/** conversion from local view coordinates to frame coordinates */
@@ -262,6 +307,16 @@ public:
 	virtual void setAlphaValue (float alpha);
 	/** get alpha value */
 	float getAlphaValue () const;
+
+	/** declare that the view paints every pixel of its view size with opaque colors.
+	 *	Views covered by an opaque view are not drawn by their view container.
+	 *	@ingroup new_in_4_7
+	 */
+	void setOpaque (bool state) { setViewFlag (kOpaque, state); }
+	/** returns true if the view paints every pixel of its view size with opaque colors
+	 *	@ingroup new_in_4_7
+	 */
+	virtual bool isOpaque () const { return hasViewFlag (kOpaque); }
 	//@}
 
 	//-----------------------------------------------------------------------------
@@ -383,7 +438,8 @@ protected:
 		kDirty					= 1 << 5,
 		kWantsIdle				= 1 << 6,
 		kIsSubview				= 1 << 7,
-		kLastCViewFlag			= 7
+		kOpaque					= 1 << 8,
+		kLastCViewFlag			= 8
 	};
 
 	~CView () noexcept override;
@@ -398,6 +454,8 @@ protected:
 	void setParentView (CView* parent);
 
 private:
+	void dispatchViewSizeChanged (const CRect& oldSize);
+
 	struct Impl;
 	std::unique_ptr<Impl> pImpl;
 };
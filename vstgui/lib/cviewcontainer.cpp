@@ -13,6 +13,7 @@
 #include "cgraphicspath.h"
 #include "controls/ccontrol.h"
 #include "dragging.h"
+#include "drawprofiler.h"
 
 #include <algorithm>
 #include <cassert>
@@ -26,6 +27,9 @@ const CViewAttributeID kCViewContainerMouseDownViewAttribute = 'vcmd';
 const CViewAttributeID kCViewContainerLastDrawnFocusAttribute = 'vclf';
 const CViewAttributeID kCViewContainerBackgroundOffsetAttribute = 'vcbo';
 
+/** number of containers currently autosizing their children */
+static uint32_t gAutosizingDepth = 0;
+
 //-----------------------------------------------------------------------------
 // CViewContainer Implementation
 //-----------------------------------------------------------------------------
@@ -40,8 +44,15 @@ struct CViewContainer::Impl
 	
 	CDrawStyle backgroundColorDrawStyle {kDrawFilledAndStroked};
 	CColor backgroundColor {kBlackCColor};
+
+	/** storage for drawRect, kept to not allocate on every draw */
+	std::vector<CRect> childDrawRects;
+	std::vector<CRect> occluders;
 };
 
+/** maximum number of opaque children used to cull the children behind them */
+static constexpr size_t kMaxOccluders = 16;
+
 //------------------------------------------------------------------------
 struct CViewContainerDropTarget : public IDropTarget, public NonAtomicReferenceCounted
 {
@@ -282,6 +293,8 @@ void CViewContainer::setViewSize (const CRect &rect, bool invalid)
 	if (rect == getViewSize ())
 		return;
 
+	// the whole subview tree is resized before the views are invalidated and notified
+	ResizeTransaction transaction;
 	CRect oldSize (getViewSize ());
 	CView::setViewSize (rect, invalid);
 
@@ -289,10 +302,14 @@ void CViewContainer::setViewSize (const CRect &rect, bool invalid)
 	{
 		CCoord widthDelta = rect.getWidth () - oldSize.getWidth ();
 		CCoord heightDelta = rect.getHeight () - oldSize.getHeight ();
-		getTransform ().inverse ().transform (widthDelta, heightDelta);
+		// the deltas are sizes, so the translation of the transform must not be applied
+		CGraphicsTransform inverseTransform = getTransform ().inverse ();
+		inverseTransform.dx = inverseTransform.dy = 0.;
+		inverseTransform.transform (widthDelta, heightDelta);
 
 		if (widthDelta != 0 || heightDelta != 0)
 		{
+			++gAutosizingDepth;
 			uint32_t numSubviews = getNbViews ();
 			uint32_t counter = 0;
 			bool treatAsColumn = (getAutosizeFlags () & kAutosizeColumn) != 0;
@@ -344,14 +361,19 @@ void CViewContainer::setViewSize (const CRect &rect, bool invalid)
 				}
 				if (viewSize != pV->getViewSize ())
 				{
-					pV->setViewSize (viewSize);
+					// the subviews are inside of the area of this container, which is invalidated
+					// by the caller
+					pV->setViewSize (viewSize, false);
 					pV->setMouseableArea (mouseSize);
 				}
 				counter++;
 			}
+			--gAutosizingDepth;
 		}
 	}
-	parentSizeChanged ();
+	// the outermost autosized container notifies the whole subview tree
+	if (gAutosizingDepth == 0)
+		parentSizeChanged ();
 }
 
 //-----------------------------------------------------------------------------
@@ -467,6 +489,15 @@ CDrawStyle CViewContainer::getBackgroundColorDrawStyle () const
 	return pImpl->backgroundColorDrawStyle;
 }
 
+//------------------------------------------------------------------------------
+bool CViewContainer::isOpaque () const
+{
+	if (CView::isOpaque ())
+		return true;
+	return !getDrawBackground () && !getTransparency () && pImpl->backgroundColor.alpha == 255 &&
+	       pImpl->backgroundColorDrawStyle != kDrawStroked;
+}
+
 //------------------------------------------------------------------------------
 CMessageResult CViewContainer::notify (CBaseObject* sender, IdStringPtr message)
 {
@@ -801,6 +832,82 @@ void CViewContainer::drawBackgroundRect (CDrawContext* pContext, const CRect& _u
 	}
 }
 
+//-----------------------------------------------------------------------------
+/** remove the part of rect which is covered by occluder if it can be expressed as a rect.
+ *	returns false if rect is completely covered
+ */
+static bool removeOccludedArea (CRect& rect, const CRect& occluder)
+{
+	if (!rect.rectOverlap (occluder))
+		return true;
+	bool coversWidth = occluder.left <= rect.left && occluder.right >= rect.right;
+	bool coversHeight = occluder.top <= rect.top && occluder.bottom >= rect.bottom;
+	if (coversWidth && coversHeight)
+		return false;
+	if (coversWidth)
+	{
+		if (occluder.top <= rect.top)
+			rect.top = occluder.bottom;
+		else if (occluder.bottom >= rect.bottom)
+			rect.bottom = occluder.top;
+	}
+	else if (coversHeight)
+	{
+		if (occluder.left <= rect.left)
+			rect.left = occluder.right;
+		else if (occluder.right >= rect.right)
+			rect.right = occluder.left;
+	}
+	return !rect.isEmpty ();
+}
+
+//-----------------------------------------------------------------------------
+/** calculate the rects of the children which need to be drawn.
+ *
+ *	walks the children from front to back, children completely covered by opaque children in
+ *	front of them get an empty rect, partially covered children a smaller one if possible.
+ */
+void CViewContainer::calculateChildDrawRects (const CRect& updateRect, const CRect& clip,
+                                              std::vector<CRect>& drawRects)
+{
+	auto& occluders = pImpl->occluders;
+	occluders.clear ();
+	drawRects.resize (pImpl->children.size ());
+	auto index = drawRects.size ();
+	for (auto it = pImpl->children.rbegin (); it != pImpl->children.rend (); ++it)
+	{
+		--index;
+		const auto& pV = *it;
+		auto& rect = drawRects[index];
+		rect = CRect ();
+		if (!pV->isVisible () || !checkUpdateRect (pV, updateRect))
+			continue;
+		rect = pV->getViewSize ();
+		rect.bound (clip);
+		if (rect.isEmpty ())
+			continue;
+		auto visibleRect = rect;
+		bool changed = true;
+		while (changed && !rect.isEmpty ())
+		{
+			changed = false;
+			for (const auto& occluder : occluders)
+			{
+				auto previous = rect;
+				if (!removeOccludedArea (rect, occluder))
+				{
+					rect = CRect ();
+					break;
+				}
+				changed = changed || previous != rect;
+			}
+		}
+		if (!rect.isEmpty () && occluders.size () < kMaxOccluders && pV->isOpaque () &&
+		    pV->getAlphaValue () >= 1.f)
+			occluders.emplace_back (visibleRect);
+	}
+}
+
 //-----------------------------------------------------------------------------
 /**
  * @param pContext the context which to use to draw
@@ -843,9 +950,25 @@ void CViewContainer::drawRect (CDrawContext* pContext, const CRect& updateRect)
 		getTransform ().inverse ().transform (clientRect);
 		getTransform ().transform (oldClip2);
 		
+		// a child draws through to its siblings when the context draws translucent
+		std::vector<CRect> childDrawRects;
+		auto hasOpaqueChild = pContext->getGlobalAlpha () >= 1.f &&
+		                      std::any_of (pImpl->children.begin (), pImpl->children.end (),
+		                                   [] (const ViewList::value_type& v) {
+			                                   return v->isVisible () && v->isOpaque ();
+		                                   });
+		if (hasOpaqueChild)
+		{
+			// take the storage, a child may draw this container again
+			childDrawRects.swap (pImpl->childDrawRects);
+			calculateChildDrawRects (clientRect, newClip, childDrawRects);
+		}
+
 		// draw each view
+		size_t childIndex = 0;
 		for (const auto& pV : pImpl->children)
 		{
+			auto index = childIndex++;
 			if (pV->isVisible ())
 			{
 				if (frame && _focusDrawing && _focusView == pV && !_focusDrawing->drawFocusOnTop ())
@@ -873,18 +996,30 @@ void CViewContainer::drawRect (CDrawContext* pContext, const CRect& updateRect)
 
 				if (checkUpdateRect (pV, clientRect))
 				{
-					CRect viewSize = pV->getViewSize ();
-					viewSize.bound (newClip);
+					CRect viewSize;
+					if (hasOpaqueChild)
+						viewSize = childDrawRects[index];
+					else
+					{
+						viewSize = pV->getViewSize ();
+						viewSize.bound (newClip);
+					}
 					if (viewSize.getWidth () == 0 || viewSize.getHeight () == 0)
 						continue;
 					pContext->setClipRect (viewSize);
 					float globalContextAlpha = pContext->getGlobalAlpha ();
 					pContext->setGlobalAlpha (globalContextAlpha * pV->getAlphaValue ());
-					pV->drawRect (pContext, viewSize);
+					{
+						// viewSize is the clipped update rect of the view here
+						VSTGUI_DRAW_PROFILER_SCOPE (pV, viewSize);
+						pV->drawRectCached (pContext, viewSize);
+					}
 					pContext->setGlobalAlpha (globalContextAlpha);
 				}
 			}
 		}
+		if (hasOpaqueChild)
+			pImpl->childDrawRects.swap (childDrawRects);
 	}
 	
 	pContext->setClipRect (oldClip2);
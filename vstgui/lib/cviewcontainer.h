@@ -13,6 +13,7 @@
 #endif
 #include <list>
 #include <memory>
+#include <vector>
 
 namespace VSTGUI {
 
@@ -122,6 +123,11 @@ public:
 	
 	virtual void setBackgroundColorDrawStyle (CDrawStyle style);
 	CDrawStyle getBackgroundColorDrawStyle () const;
+
+	/** the container is opaque if it is set opaque or if it fills its background with an opaque color.
+	 *	Subclasses which override drawBackgroundRect must override this too, see CTabView.
+	 */
+	bool isOpaque () const override;
 	//@}
 
 	virtual bool advanceNextFocusView (CView* oldFocus, bool reverse = false);
@@ -245,6 +251,8 @@ protected:
 	void beforeDelete () override;
 	
 	virtual bool checkUpdateRect (CView* view, const CRect& rect);
+	void calculateChildDrawRects (const CRect& updateRect, const CRect& clip,
+	                              std::vector<CRect>& drawRects);
 
 	void setMouseDownView (CView* view);
 	CView* getMouseDownView () const;
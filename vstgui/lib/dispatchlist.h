@@ -39,18 +39,39 @@ private:
 	using Array = std::vector<std::pair<bool, T>>;
 	using AddArray = std::vector<T>;
 
+	bool canAddInPlace () const;
+	typename Array::iterator find (const T& obj);
 	void postForEach ();
 
 	Array entries;
 	AddArray toAdd;
+	size_t numRemoved {0};
 	bool inForEach{false};
 };
 
+//------------------------------------------------------------------------
+template<typename T>
+inline bool DispatchList<T>::canAddInPlace () const
+{
+	// the entries must not be reallocated while iterating, and the order of added objects must
+	// be kept when some of them have to be added after iterating
+	return !inForEach || (toAdd.empty () && entries.size () < entries.capacity ());
+}
+
+//------------------------------------------------------------------------
+template<typename T>
+inline typename DispatchList<T>::Array::iterator DispatchList<T>::find (const T& obj)
+{
+	return std::find_if (
+		entries.begin (), entries.end (),
+		[&](const typename Array::value_type& element) { return element.first && element.second == obj; });
+}
+
 //------------------------------------------------------------------------
 template<typename T>
 inline void DispatchList<T>::add (const T& obj)
 {
-	if (inForEach)
+	if (!canAddInPlace ())
 		toAdd.emplace_back (obj);
 	else
 		entries.emplace_back (std::make_pair (true, obj));
@@ -60,7 +81,7 @@ inline void DispatchList<T>::add (const T& obj)
 template<typename T>
 inline void DispatchList<T>::add (T&& obj)
 {
-	if (inForEach)
+	if (!canAddInPlace ())
 		toAdd.emplace_back (std::move (obj));
 	else
 		entries.emplace_back (std::make_pair (true, std::move (obj)));
@@ -70,32 +91,30 @@ inline void DispatchList<T>::add (T&& obj)
 template<typename T>
 inline void DispatchList<T>::remove (const T& obj)
 {
-	auto it = std::find_if (
-		entries.begin (), entries.end (),
-		[&](const typename Array::value_type& element) { return element.second == obj; });
+	auto it = find (obj);
 	if (it != entries.end ())
 	{
 		if (inForEach)
+		{
 			it->first = false;
+			++numRemoved;
+		}
 		else
 			entries.erase (it);
 	}
+	else if (!toAdd.empty ())
+	{
+		auto addIt = std::find (toAdd.begin (), toAdd.end (), obj);
+		if (addIt != toAdd.end ())
+			toAdd.erase (addIt);
+	}
 }
 
 //------------------------------------------------------------------------
 template<typename T>
 inline void DispatchList<T>::remove (T&& obj)
 {
-	auto it = std::find (
-		entries.begin (), entries.end (),
-		[&](const typename Array::value_type& element) { return element.second == obj; });
-	if (it != entries.end ())
-	{
-		if (inForEach)
-			it->first = false;
-		else
-			entries.erase (it);
-	}
+	remove (static_cast<const T&> (obj));
 }
 
 //------------------------------------------------------------------------
@@ -109,20 +128,28 @@ inline bool DispatchList<T>::empty () const
 template<typename T>
 inline void DispatchList<T>::postForEach ()
 {
-	AddArray toRemove;
-	for (auto& element : entries)
+	if (numRemoved)
 	{
-		if (element.first)
-			continue;
-		toRemove.emplace_back (std::move (element.second));
-	}
-	if (!toRemove.empty ())
-	{
-		entries.erase (std::remove_if (entries.begin (), entries.end (),
-		                               [] (const typename Array::value_type& element) {
-			                               return element.first == false;
-		                               }),
+		// move the removed entries to the end while keeping the order of the others
+		auto numEntries = size_t {0};
+		for (auto i = size_t {0}; i < entries.size (); ++i)
+		{
+			if (entries[i].first == false)
+				continue;
+			if (i != numEntries)
+				std::swap (entries[numEntries], entries[i]);
+			++numEntries;
+		}
+		// the removed objects are released after the entries are consistent again, as their
+		// destructors may change this list
+		AddArray released;
+		released.reserve (numRemoved);
+		for (auto i = numEntries; i < entries.size (); ++i)
+			released.emplace_back (std::move (entries[i].second));
+		entries.erase (entries.begin () + static_cast<typename Array::difference_type> (numEntries),
 		               entries.end ());
+		numRemoved = 0;
+		released.clear ();
 	}
 	if (!toAdd.empty ())
 	{
@@ -130,6 +157,10 @@ inline void DispatchList<T>::postForEach ()
 		toAdd.swap (tmp);
 		for (auto&& it : tmp)
 			add (std::move (it));
+		// keep the storage for the next time
+		tmp.clear ();
+		if (toAdd.empty ())
+			toAdd.swap (tmp);
 	}
 }
 
@@ -143,8 +174,11 @@ inline void DispatchList<T>::forEach (Procedure proc)
 
 	bool wasInForEach = inForEach;
 	inForEach = true;
-	for (auto& it : entries)
+	// objects added while iterating are not visited
+	auto numEntries = entries.size ();
+	for (auto i = size_t {0}; i < numEntries; ++i)
 	{
+		auto& it = entries[i];
 		if (it.first == false)
 			continue;
 		proc (it.second);
@@ -164,11 +198,12 @@ inline void DispatchList<T>::forEachReverse (Procedure proc)
 	
 	bool wasInForEach = inForEach;
 	inForEach = true;
-	for (auto it = entries.rbegin (); it != entries.rend (); ++it)
+	for (auto i = entries.size (); i > 0; --i)
 	{
-		if ((*it).first == false)
+		auto& it = entries[i - 1];
+		if (it.first == false)
 			continue;
-		proc ((*it).second);
+		proc (it.second);
 	}
 	inForEach = wasInForEach;
 	if (!inForEach)
@@ -185,8 +220,10 @@ inline void DispatchList<T>::forEach (Procedure proc, Condition condition)
 
 	bool wasInForEach = inForEach;
 	inForEach = true;
-	for (auto& it : entries)
+	auto numEntries = entries.size ();
+	for (auto i = size_t {0}; i < numEntries; ++i)
 	{
+		auto& it = entries[i];
 		if (it.first == false)
 			continue;
 		if (condition (proc (it.second)))
@@ -207,11 +244,12 @@ inline void DispatchList<T>::forEachReverse (Procedure proc, Condition condition
 
 	bool wasInForEach = inForEach;
 	inForEach = true;
-	for (auto it = entries.rbegin (); it != entries.rend (); ++it)
+	for (auto i = entries.size (); i > 0; --i)
 	{
-		if ((*it).first == false)
+		auto& it = entries[i - 1];
+		if (it.first == false)
 			continue;
-		if (condition (proc ((*it).second)))
+		if (condition (proc (it.second)))
 			break;
 	}
 	inForEach = wasInForEach;
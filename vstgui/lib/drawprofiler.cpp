@@ -0,0 +1,203 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "drawprofiler.h"
+#include "cview.h"
+#include <algorithm>
+#include <cstdio>
+#include <typeinfo>
+#include <unordered_map>
+
+namespace VSTGUI {
+
+//-----------------------------------------------------------------------------
+namespace {
+
+//-----------------------------------------------------------------------------
+struct ProfilerData
+{
+	struct OpenScope
+	{
+		size_t eventIndex;
+		DrawProfiler::Clock::time_point start;
+		double childTime;
+	};
+
+	DrawProfiler::Clock::time_point startTime {DrawProfiler::Clock::now ()};
+	DrawProfiler::EventList events;
+	std::vector<OpenScope> stack;
+};
+
+//-----------------------------------------------------------------------------
+ProfilerData& getData ()
+{
+	static ProfilerData data;
+	return data;
+}
+
+//-----------------------------------------------------------------------------
+inline double toMicroseconds (DrawProfiler::Clock::duration d)
+{
+	return std::chrono::duration<double, std::micro> (d).count ();
+}
+
+//-----------------------------------------------------------------------------
+std::string getViewName (const CView* view)
+{
+	IdStringPtr viewName = nullptr;
+	uint32_t size = sizeof (IdStringPtr);
+	if (view->getAttribute (kCViewClassNameAttribute, size, &viewName, size) && viewName)
+		return viewName;
+	return typeid (*view).name ();
+}
+
+//-----------------------------------------------------------------------------
+void appendJSONString (std::string& str, const std::string& value)
+{
+	str += '"';
+	for (auto c : value)
+	{
+		if (c == '"' || c == '\\')
+			str += '\\';
+		str += c;
+	}
+	str += '"';
+}
+
+} // anonymous
+
+//-----------------------------------------------------------------------------
+bool DrawProfiler::enabled = false;
+
+//-----------------------------------------------------------------------------
+void DrawProfiler::setEnabled (bool state)
+{
+	if (state == enabled)
+		return;
+	if (state && getData ().events.empty ())
+		getData ().startTime = Clock::now ();
+	enabled = state;
+}
+
+//-----------------------------------------------------------------------------
+void DrawProfiler::clear ()
+{
+	auto& data = getData ();
+	data.events.clear ();
+	data.startTime = Clock::now ();
+}
+
+//-----------------------------------------------------------------------------
+auto DrawProfiler::getEvents () -> const EventList&
+{
+	return getData ().events;
+}
+
+//-----------------------------------------------------------------------------
+std::string DrawProfiler::createChromeTrace ()
+{
+	std::string result ("{\"traceEvents\":[\n");
+	char buffer[256];
+	bool first = true;
+	for (const auto& event : getData ().events)
+	{
+		if (!first)
+			result += ",\n";
+		first = false;
+		result += "{\"name\":";
+		appendJSONString (result, event.name);
+		snprintf (buffer, sizeof (buffer),
+		          ",\"cat\":\"draw\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f,"
+		          "\"args\":{\"viewRect\":\"%g, %g, %g, %g\",\"updateRect\":\"%g, %g, %g, %g\","
+		          "\"pixels\":%.0f,\"self\":%.3f}}",
+		          event.start, event.total, event.viewRect.left, event.viewRect.top,
+		          event.viewRect.right, event.viewRect.bottom, event.updateRect.left,
+		          event.updateRect.top, event.updateRect.right, event.updateRect.bottom, event.pixels,
+		          event.self);
+		result += buffer;
+	}
+	result += "\n]}\n";
+	return result;
+}
+
+//-----------------------------------------------------------------------------
+std::string DrawProfiler::createReport (size_t topN)
+{
+	struct Entry
+	{
+		std::string name;
+		uint32_t count {0};
+		double total {0.};
+		double self {0.};
+		double pixels {0.};
+	};
+	std::unordered_map<std::string, Entry> map;
+	for (const auto& event : getData ().events)
+	{
+		auto& entry = map[event.name];
+		entry.name = event.name;
+		++entry.count;
+		entry.total += event.total;
+		entry.self += event.self;
+		entry.pixels += event.pixels;
+	}
+	std::vector<Entry> entries;
+	entries.reserve (map.size ());
+	for (auto& it : map)
+		entries.emplace_back (std::move (it.second));
+	std::sort (entries.begin (), entries.end (),
+	           [] (const Entry& e1, const Entry& e2) { return e1.self > e2.self; });
+	if (entries.size () > topN)
+		entries.resize (topN);
+
+	std::string result;
+	char buffer[512];
+	snprintf (buffer, sizeof (buffer), "%12s %12s %8s %14s  %s\n", "self (ms)", "total (ms)",
+	          "count", "pixels", "view");
+	result += buffer;
+	for (const auto& entry : entries)
+	{
+		snprintf (buffer, sizeof (buffer), "%12.3f %12.3f %8u %14.0f  %s\n", entry.self / 1000.,
+		          entry.total / 1000., entry.count, entry.pixels, entry.name.data ());
+		result += buffer;
+	}
+	return result;
+}
+
+//-----------------------------------------------------------------------------
+void DrawProfiler::Scope::begin (const CView* view, const CRect& updateRect)
+{
+	auto& data = getData ();
+	active = true;
+	auto now = Clock::now ();
+	Event event;
+	event.name = getViewName (view);
+	event.viewRect = view->getViewSize ();
+	event.updateRect = updateRect;
+	event.start = toMicroseconds (now - data.startTime);
+	event.total = event.self = 0.;
+	event.pixels = updateRect.getWidth () * updateRect.getHeight ();
+	event.depth = static_cast<uint32_t> (data.stack.size ());
+	data.events.emplace_back (std::move (event));
+	data.stack.push_back ({data.events.size () - 1, now, 0.});
+}
+
+//-----------------------------------------------------------------------------
+void DrawProfiler::Scope::end ()
+{
+	auto& data = getData ();
+	auto scope = data.stack.back ();
+	data.stack.pop_back ();
+	auto total = toMicroseconds (Clock::now () - scope.start);
+	if (scope.eventIndex < data.events.size ())
+	{
+		auto& event = data.events[scope.eventIndex];
+		event.total = total;
+		event.self = total - scope.childTime;
+	}
+	if (!data.stack.empty ())
+		data.stack.back ().childTime += total;
+}
+
+} // namespace
@@ -0,0 +1,105 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#ifndef __drawprofiler__
+#define __drawprofiler__
+
+#include "vstguifwd.h"
+#include "crect.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace VSTGUI {
+
+//-----------------------------------------------------------------------------
+/** @brief Records the time spent drawing each view
+ *
+ *	When VSTGUI_DRAW_PROFILER is set to 1 the frame and the view containers open a Scope around
+ *	every view they draw. While the profiler is enabled each scope records the name of the view,
+ *	its size, the clipped rect which was drawn, the pixel area of this rect, and the total and
+ *	self time (total minus the time of the sub views).
+ *
+ *	The view name is the class name stored by the UIViewFactory or the C++ type name otherwise.
+ *
+ *	When VSTGUI_DRAW_PROFILER is 0 no scopes are compiled in. When it is 1 but the profiler is
+ *	disabled a scope only checks a flag.
+ *
+ *	@ingroup new_in_4_7
+ */
+//-----------------------------------------------------------------------------
+class DrawProfiler
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	struct Event
+	{
+		std::string name;
+		/** the size of the view */
+		CRect viewRect;
+		/** the part of the view which was drawn, in the coordinate system of the view's parent */
+		CRect updateRect;
+		/** microseconds since the profiler was enabled */
+		double start;
+		/** duration in microseconds */
+		double total;
+		/** duration in microseconds without the time of the sub views */
+		double self;
+		/** pixel area of updateRect */
+		double pixels;
+		uint32_t depth;
+	};
+	using EventList = std::vector<Event>;
+
+	static void setEnabled (bool state);
+	static bool isEnabled () { return enabled; }
+
+	/** remove all recorded events */
+	static void clear ();
+	static const EventList& getEvents ();
+
+	/** create chrome trace_event json of the recorded events (open it in chrome://tracing) */
+	static std::string createChromeTrace ();
+	/** create a flat text report of the topN views with the most self time */
+	static std::string createReport (size_t topN = 20);
+
+	//-----------------------------------------------------------------------------
+	class Scope
+	{
+	public:
+		/** updateRect is the clipped rect which is drawn, in the coordinate system of the view's
+		 *	parent
+		 */
+		Scope (const CView* view, const CRect& updateRect)
+		{
+			if (enabled)
+				begin (view, updateRect);
+		}
+		~Scope () noexcept
+		{
+			if (active)
+				end ();
+		}
+
+	private:
+		void begin (const CView* view, const CRect& updateRect);
+		void end ();
+
+		bool active {false};
+	};
+
+private:
+	static bool enabled;
+};
+
+} // namespace
+
+#if VSTGUI_DRAW_PROFILER
+	#define VSTGUI_DRAW_PROFILER_SCOPE(view, updateRect) VSTGUI::DrawProfiler::Scope drawProfilerScope (view, updateRect)
+#else
+	#define VSTGUI_DRAW_PROFILER_SCOPE(view, updateRect)
+#endif
+
+#endif // __drawprofiler__
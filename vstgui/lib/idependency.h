@@ -7,8 +7,7 @@
 
 #include "vstguibase.h"
 #include "vstguidebug.h"
-#include <list>
-#include <set>
+#include <vector>
 #include <algorithm>
 #include <cassert>
 
@@ -21,6 +20,9 @@ namespace VSTGUI {
 	@details You can inject this implementation into CBaseObjects whenever you need other CBaseObjects to be informed about
 	changes to that class instance. Note that you need to handle recursions yourself and that no reference counting is done
 	and that you must make sure that the dependent objects are alife while added as dependent.
+
+	Dependent objects may be added or removed while they are notified. Objects added while a change is dispatched
+	are not notified of this change, removed objects are not notified anymore. Notifying does not allocate memory.
 */
 //----------------------------------------------------------------------------------------------------
 class IDependency
@@ -53,11 +55,12 @@ protected:
 	static void rememberObject (CBaseObject* obj) { obj->remember (); }
 	static void forgetObject (CBaseObject* obj) { obj->forget (); }
 
-	using DeferedChangesSet = std::set<IdStringPtr>;
-	using DependentList = std::list<CBaseObject*>;
+	using DeferedChangesList = std::vector<IdStringPtr>;
+	using DependentList = std::vector<CBaseObject*>;
 
 	int32_t deferChangeCount {0};
-	DeferedChangesSet deferedChanges;
+	int32_t notifyDepth {0};
+	DeferedChangesList deferedChanges;
 	DependentList dependents;
 };
 
@@ -70,7 +73,11 @@ inline void IDependency::addDependency (CBaseObject* obj)
 //----------------------------------------------------------------------------------------------------
 inline void IDependency::removeDependency (CBaseObject* obj)
 {
-	dependents.remove (obj);
+	// while notifying the entries are only cleared, so that the indices stay valid
+	if (notifyDepth)
+		std::replace (dependents.begin (), dependents.end (), obj, static_cast<CBaseObject*> (nullptr));
+	else
+		dependents.erase (std::remove (dependents.begin (), dependents.end (), obj), dependents.end ());
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -78,16 +85,29 @@ inline void IDependency::changed (IdStringPtr message)
 {
 	if (deferChangeCount)
 	{
-		deferedChanges.emplace (message);
+		if (std::find (deferedChanges.begin (), deferedChanges.end (), message) == deferedChanges.end ())
+			deferedChanges.emplace_back (message);
 	}
 	else if (dependents.empty () == false)
 	{
 		CBaseObject* This = dynamic_cast<CBaseObject*> (this);
-		DependentList localList (dependents);
-		std::for_each (localList.begin (), localList.end (), rememberObject);
-		for (auto& obj : localList)
+		// a dependent may release this object while it is notified
+		SharedPointer<CBaseObject> guard (This);
+		// dependents added while notifying are appended and not notified of this change
+		auto numDependents = dependents.size ();
+		++notifyDepth;
+		for (auto i = 0u; i < numDependents; ++i)
+		{
+			auto obj = dependents[i];
+			if (obj == nullptr)
+				continue;
+			rememberObject (obj);
 			obj->notify (This, message);
-		std::for_each (localList.begin (), localList.end (), forgetObject);
+			forgetObject (obj);
+		}
+		if (--notifyDepth == 0)
+			dependents.erase (std::remove (dependents.begin (), dependents.end (), nullptr),
+			                  dependents.end ());
 	}
 }
 
@@ -98,18 +118,24 @@ inline void IDependency::deferChanges (bool state)
 	{
 		deferChangeCount++;
 	}
-	else if (--deferChangeCount == 0)
+	else if (--deferChangeCount == 0 && deferedChanges.empty () == false)
 	{
-		for (auto& msg : deferedChanges)
+		DeferedChangesList messages;
+		messages.swap (deferedChanges);
+		for (auto& msg : messages)
 			changed (msg);
-		deferedChanges.clear ();
+		// keep the storage for the next time
+		messages.clear ();
+		if (deferedChanges.empty ())
+			deferedChanges.swap (messages);
 	}
 }
 
 //----------------------------------------------------------------------------------------------------
 inline IDependency::~IDependency () noexcept
 {
-	vstgui_assert (dependents.size () == 0);
+	vstgui_assert (std::all_of (dependents.begin (), dependents.end (),
+	                            [] (CBaseObject* obj) { return obj == nullptr; }));
 }
 
 } // namespace
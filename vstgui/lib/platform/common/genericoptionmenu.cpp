@@ -3,6 +3,7 @@
 // distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
 
 #include "genericoptionmenu.h"
+#include "genericoptionmenudetail.h"
 
 #include "../../animation/animations.h"
 #include "../../animation/timingfunctions.h"
@@ -15,6 +16,7 @@
 #include "../../idatabrowserdelegate.h"
 #include "../../controls/coptionmenu.h"
 #include "../../controls/cscrollbar.h"
+#include "../iplatformframe.h"
 
 //------------------------------------------------------------------------
 namespace VSTGUI {
@@ -44,6 +46,7 @@ public:
 	, parentDataSource (parentDataSource)
 	, clickCallback (clickCallback)
 	, theme (theme)
+	, filter (menu)
 	{
 		vstgui_assert (menu->getNbEntries () > 0);
 	}
@@ -61,16 +64,18 @@ public:
 		maxWidth = 0.;
 		maxTitleWidth = 0.;
 		hasRightMargin = false;
+		std::vector<CMenuItem*> items;
+		items.reserve (menu->getItems ()->size ());
 		for (auto& item : *menu->getItems ())
 		{
 			if (item->isSeparator ())
 				continue;
-			auto width = context->getStringWidth (item->getTitle ());
 			hasRightMargin |= item->getSubmenu () ? true : false;
 			hasRightMargin |= item->getIcon () ? true : false;
-			if (maxTitleWidth < width)
-				maxTitleWidth = width;
+			items.push_back (item);
 		}
+		maxTitleWidth = calculateMaxTitleWidth (
+			items, [&] (const UTF8String& str) { return context->getStringWidth (str); });
 		maxWidth = maxTitleWidth + getCheckmarkWidth () * 2.;
 		if (hasRightMargin)
 			maxWidth += getSubmenuIndicatorWidth ();
@@ -122,7 +127,9 @@ private:
 		db->setSelectedRow (CDataBrowser::kNoSelection);
 	}
 
-	int32_t dbGetNumRows (CDataBrowser* browser) override { return menu->getNbEntries (); }
+	CMenuItem* getItem (int32_t row) const { return menu->getEntry (filter.getItemIndex (row)); }
+
+	int32_t dbGetNumRows (CDataBrowser* browser) override { return filter.getNumRows (); }
 	int32_t dbGetNumColumns (CDataBrowser* browser) override { return 1; }
 	CCoord dbGetCurrentColumnWidth (int32_t index, CDataBrowser* browser) override
 	{
@@ -138,23 +145,75 @@ private:
 			if (direction == 1)
 				index = -1;
 			else
-				index = menu->getNbEntries ();
+				index = filter.getNumRows ();
 		}
 		index += direction;
-		if (auto item = menu->getEntry (index))
+		while (auto item = getItem (index))
 		{
 			if (item->isEnabled () && !item->isSeparator () && !item->isTitle ())
 			{
 				closeSubMenu ();
 				db->setSelectedRow (index, true);
+				break;
+			}
+			index += direction;
+		}
+	}
+
+	void setFilter (const std::string& searchString)
+	{
+		if (searchString == filter.getSearchString ())
+			return;
+		closeSubMenu ();
+		filter.setSearchString (searchString);
+		db->recalculateLayout (false);
+		auto row = filter.getBestRow ();
+		if (row != CDataBrowser::kNoSelection)
+			db->setSelectedRow (row, true);
+	}
+
+	bool onFilterKey (const VstKeyCode& key)
+	{
+		if (key.modifier & ~MODIFIER_SHIFT)
+			return false;
+		auto searchString = filter.getSearchString ();
+		if (key.virt == VKEY_BACK)
+		{
+			if (searchString.empty ())
+				return false;
+			// remove the last UTF-8 character
+			auto pos = searchString.size () - 1;
+			while (pos > 0 && (searchString[pos] & 0xC0) == 0x80)
+				--pos;
+			searchString.erase (pos);
+		}
+		else if (key.virt == VKEY_SPACE)
+			searchString += ' ';
+		else if (key.virt == 0 && key.character >= 0x20)
+		{
+			Optional<UTF8String> text;
+			if (auto frame = db->getFrame ())
+			{
+				if (auto platformFrame = frame->getPlatformFrame ())
+					text = platformFrame->convertCurrentKeyEventToText ();
 			}
+			if (text)
+				searchString += text->getString ();
+			else if (key.character < 0x80)
+				searchString += static_cast<char> (key.character);
 			else
-				alterSelection (index, direction);
+				return false;
 		}
+		else
+			return false;
+		setFilter (searchString);
+		return true;
 	}
 
 	int32_t dbOnKeyDown (const VstKeyCode& key, CDataBrowser* browser) override
 	{
+		if (onFilterKey (key))
+			return 1;
 		if (key.character == 0 && key.modifier == 0)
 		{
 			switch (key.virt)
@@ -171,9 +230,28 @@ private:
 				}
 				case VKEY_ESCAPE:
 				{
+					if (filter.isActive ())
+					{
+						setFilter ({});
+						return 1;
+					}
 					clickCallback (menu, CDataBrowser::kNoSelection);
 					return 1;
 				}
+				case VKEY_RETURN:
+				case VKEY_ENTER:
+				{
+					auto row = browser->getSelectedRow ();
+					if (auto item = getItem (row))
+					{
+						if (!item->getSubmenu () && clickCallback)
+						{
+							clickCallback (menu, filter.getItemIndex (row));
+							return 1;
+						}
+					}
+					break;
+				}
 				case VKEY_LEFT:
 				{
 					if (parentDataSource)
@@ -186,7 +264,7 @@ private:
 				case VKEY_RIGHT:
 				{
 					auto row = db->getSelectedRow ();
-					if (auto item = menu->getEntry (row))
+					if (auto item = getItem (row))
 					{
 						if (auto subMenu = item->getSubmenu ())
 						{
@@ -206,7 +284,7 @@ private:
 	CMouseEventResult dbOnMouseMoved (const CPoint& where, const CButtonState& buttons, int32_t row,
 	                                  int32_t column, CDataBrowser* browser) override
 	{
-		if (auto item = menu->getEntry (row))
+		if (auto item = getItem (row))
 		{
 			if (browser->getSelectedRow () != row)
 			{
@@ -228,7 +306,7 @@ private:
 	CMouseEventResult dbOnMouseDown (const CPoint& where, const CButtonState& buttons, int32_t row,
 	                                 int32_t column, CDataBrowser* browser) override
 	{
-		if (auto item = menu->getEntry (row))
+		if (auto item = getItem (row))
 		{
 			if (item->isTitle () || !item->isEnabled () || item->isSeparator ())
 				browser->setSelectedRow (CDataBrowser::kNoSelection);
@@ -239,10 +317,10 @@ private:
 	CMouseEventResult dbOnMouseUp (const CPoint& where, const CButtonState& buttons, int32_t row,
 	                               int32_t column, CDataBrowser* browser) override
 	{
-		if (auto item = menu->getEntry (row))
+		if (auto item = getItem (row))
 		{
 			if (!item->isSeparator () && !item->isTitle () && item->isEnabled () && clickCallback)
-				clickCallback (menu, row);
+				clickCallback (menu, filter.getItemIndex (row));
 		}
 		return kMouseEventHandled;
 	}
@@ -333,7 +411,7 @@ private:
 	void dbDrawCell (CDrawContext* context, const CRect& size, int32_t row, int32_t column,
 	                 int32_t flags, CDataBrowser* browser) override
 	{
-		if (auto item = menu->getEntry (row))
+		if (auto item = getItem (row))
 		{
 			context->setDrawMode (kAntiAliasing);
 			if (item->isSeparator ())
@@ -419,6 +497,7 @@ private:
 	CCoord maxTitleWidth {-1.};
 	bool hasRightMargin {false};
 	GenericOptionMenuTheme theme;
+	ItemFilter filter;
 };
 
 //------------------------------------------------------------------------
@@ -0,0 +1,183 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#pragma once
+
+#include "../../cdatabrowser.h"
+#include "../../controls/coptionmenu.h"
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+namespace GenericOptionMenuDetail {
+
+//------------------------------------------------------------------------
+/** Filters the items of a menu by a case insensitive substring of their titles.
+ *
+ *	Case folding only covers the ASCII letters, all other characters must match exactly (the
+ *	search string "ä" does not find the title "Ä").
+ *
+ *	The lower cased titles are only created when the first character is typed. Extending the
+ *	search string only searches the previous matches again and the matches of all shorter search
+ *	strings are kept, so removing the last character does not search at all.
+ */
+class ItemFilter
+{
+public:
+	explicit ItemFilter (COptionMenu* menu) : menu (menu) {}
+
+	bool isActive () const { return !searchString.empty (); }
+	const std::string& getSearchString () const { return searchString; }
+
+	void setSearchString (const std::string& str)
+	{
+		size_t commonLength = 0;
+		while (commonLength < str.size () && commonLength < searchString.size () &&
+		       str[commonLength] == searchString[commonLength])
+			++commonLength;
+		matches.resize (commonLength);
+		searchString = str;
+		if (searchString.size () > commonLength && titles.empty ())
+			buildIndex ();
+		for (auto length = commonLength + 1; length <= searchString.size (); ++length)
+		{
+			auto search = toLower (searchString.substr (0, length));
+			std::vector<int32_t> result;
+			auto addIfMatch = [&] (int32_t index) {
+				if (titles[index].find (search) != std::string::npos)
+					result.push_back (index);
+			};
+			if (matches.empty ())
+			{
+				for (auto index = 0; index < static_cast<int32_t> (titles.size ()); ++index)
+					addIfMatch (index);
+			}
+			else
+			{
+				for (auto index : matches.back ())
+					addIfMatch (index);
+			}
+			matches.emplace_back (std::move (result));
+		}
+	}
+
+	int32_t getNumRows () const
+	{
+		return isActive () ? static_cast<int32_t> (matches.back ().size ()) : menu->getNbEntries ();
+	}
+
+	int32_t getItemIndex (int32_t row) const
+	{
+		if (!isActive ())
+			return row;
+		if (row < 0 || row >= static_cast<int32_t> (matches.back ().size ()))
+			return -1;
+		return matches.back ()[row];
+	}
+
+	/** first row whose title starts with the search string, or the first row */
+	int32_t getBestRow () const
+	{
+		if (!isActive () || matches.back ().empty ())
+			return CDataBrowser::kNoSelection;
+		auto search = toLower (searchString);
+		const auto& rows = matches.back ();
+		for (auto row = 0u; row < rows.size (); ++row)
+		{
+			if (titles[rows[row]].compare (0, search.size (), search) == 0)
+				return static_cast<int32_t> (row);
+		}
+		return 0;
+	}
+
+private:
+	static std::string toLower (std::string str)
+	{
+		std::transform (str.begin (), str.end (), str.begin (), [] (char c) {
+			return static_cast<char> (std::tolower (static_cast<unsigned char> (c)));
+		});
+		return str;
+	}
+
+	void buildIndex ()
+	{
+		// titles and separators are not selectable and get no title to never match
+		titles.reserve (menu->getItems ()->size ());
+		for (auto& item : *menu->getItems ())
+		{
+			if (item->isSeparator () || item->isTitle () || !item->isEnabled ())
+				titles.emplace_back ();
+			else
+				titles.emplace_back (toLower (item->getTitle ().getString ()));
+		}
+	}
+
+	COptionMenu* menu;
+	std::string searchString;
+	std::vector<std::string> titles;
+	/** matches[n] contains the item indices matching the first n + 1 bytes of the search string */
+	std::vector<std::vector<int32_t>> matches;
+};
+
+//------------------------------------------------------------------------
+/** Returns the width of the widest title.
+ *
+ *	To not measure every title of huge menus, the ASCII titles are measured from the longest to
+ *	the shortest and skipped once their length times the widest ASCII glyph cannot beat the widest
+ *	title measured so far. The widest glyph is measured, not guessed, so only kerning which widens
+ *	a title beyond the sum of its glyphs could cut it off. Titles with other characters are always
+ *	measured, as a single glyph may be wider than its bytes times the widest ASCII glyph.
+ *
+ *	@param items the menu items, separators are expected to be filtered out already
+ *	@param measure callable returning the width of an UTF8String
+ */
+template <typename MeasureProc>
+CCoord calculateMaxTitleWidth (const std::vector<CMenuItem*>& items, const MeasureProc& measure)
+{
+	static constexpr char firstPrintableASCII = 0x20;
+	static constexpr char lastPrintableASCII = 0x7e;
+	static constexpr size_t numPrintableASCII = lastPrintableASCII - firstPrintableASCII + 1;
+
+	auto isASCII = [] (char c) { return static_cast<unsigned char> (c) < 0x80; };
+
+	CCoord maxWidth = 0.;
+	std::vector<CMenuItem*> asciiItems;
+	asciiItems.reserve (items.size ());
+	for (auto item : items)
+	{
+		const auto& title = item->getTitle ().getString ();
+		if (std::all_of (title.begin (), title.end (), isASCII))
+			asciiItems.push_back (item);
+		else
+			maxWidth = std::max (maxWidth, measure (item->getTitle ()));
+	}
+	if (asciiItems.size () <= numPrintableASCII)
+	{
+		// measuring the glyphs would cost more than measuring the titles
+		for (auto item : asciiItems)
+			maxWidth = std::max (maxWidth, measure (item->getTitle ()));
+		return maxWidth;
+	}
+	std::stable_sort (asciiItems.begin (), asciiItems.end (), [] (CMenuItem* i1, CMenuItem* i2) {
+		return i1->getTitle ().length () > i2->getTitle ().length ();
+	});
+	CCoord maxGlyphWidth = 0.;
+	for (auto c = firstPrintableASCII; c <= lastPrintableASCII; ++c)
+		maxGlyphWidth = std::max (maxGlyphWidth, measure (UTF8String (std::string (1, c))));
+	for (auto item : asciiItems)
+	{
+		if (item->getTitle ().length () * maxGlyphWidth <= maxWidth)
+			break;
+		maxWidth = std::max (maxWidth, measure (item->getTitle ()));
+	}
+	return maxWidth;
+}
+
+//------------------------------------------------------------------------
+} // GenericOptionMenuDetail
+} // VSTGUI
@@ -3,6 +3,7 @@
 // distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
 
 #include "generictextedit.h"
+#include "generictexteditdetail.h"
 #include "../iplatformfont.h"
 #include "../iplatformframe.h"
 #include "../../controls/ctextlabel.h"
@@ -32,6 +33,9 @@ using STB_CharT = char;
 
 #include "stb_textedit.h"
 
+//-----------------------------------------------------------------------------
+using GenericTextEditDetail::CharAdvanceTable;
+
 //-----------------------------------------------------------------------------
 class STBTextEditView
 	: public CTextLabel
@@ -86,8 +90,11 @@ private:
 	void onStateChanged ();
 	void onTextChange ();
 	void fillCharWidthCache ();
+	void updateCharWidthCache (size_t start, size_t end);
+	void setTextInternal (const UTF8String& txt);
 	void calcCursorSizes ();
 	CCoord getCharWidth (STB_CharT c, STB_CharT pc) const;
+	CCoord measureCharWidth (STB_CharT c, STB_CharT pc) const;
 
 	static constexpr auto BitRecursiveKeyGuard = 1 << 0;
 	static constexpr auto BitBlinkToggle = 1 << 1;
@@ -111,6 +118,8 @@ private:
 	IPlatformTextEditCallback* callback;
 	STB_TexteditState editState;
 	std::vector<CCoord> charWidthCache;
+	mutable std::shared_ptr<CharAdvanceTable> charAdvanceTable;
+	mutable SharedPointer<IPlatformString> measureString;
 	CColor selectionColor{kBlueCColor};
 	CCoord cursorOffset{0.};
 	CCoord cursorHeight{0.};
@@ -447,6 +456,7 @@ void STBTextEditView::drawStyleChanged ()
 {
 	setCursorSizesValid (false);
 	charWidthCache.clear ();
+	charAdvanceTable = nullptr;
 	CTextLabel::drawStyleChanged ();
 }
 
@@ -454,7 +464,7 @@ void STBTextEditView::drawStyleChanged ()
 void STBTextEditView::selectAll ()
 {
 	editState.select_start = 0;
-	editState.select_end = static_cast<int> (getText ().length ());
+	editState.select_end = getLength (this);
 	onStateChanged ();
 }
 
@@ -535,6 +545,12 @@ void STBTextEditView::onStateChanged ()
 void STBTextEditView::setText (const UTF8String& txt)
 {
 	charWidthCache.clear ();
+	setTextInternal (txt);
+}
+
+//-----------------------------------------------------------------------------
+void STBTextEditView::setTextInternal (const UTF8String& txt)
+{
 	CTextLabel::setText (txt);
 	if (editState.select_start != editState.select_end)
 		selectAll ();
@@ -545,35 +561,41 @@ void STBTextEditView::setText (const UTF8String& txt)
 
 //-----------------------------------------------------------------------------
 CCoord STBTextEditView::getCharWidth (STB_CharT c, STB_CharT pc) const
+{
+	if (!charAdvanceTable)
+		charAdvanceTable = CharAdvanceTable::get (getFont ());
+	return charAdvanceTable->getAdvance (
+		c, pc, [this] (STB_CharT c, STB_CharT pc) { return measureCharWidth (c, pc); });
+}
+
+//-----------------------------------------------------------------------------
+CCoord STBTextEditView::measureCharWidth (STB_CharT c, STB_CharT pc) const
 {
 	auto platformFont = getFont ()->getPlatformFont ();
 	assert (platformFont);
 	auto fontPainter = platformFont->getPainter ();
 	assert (fontPainter);
 
+	if (!measureString)
+		measureString = IPlatformString::createWithUTF8String ();
+	auto measure = [&] (const std::string& str) {
+		measureString->setUTF8String (str.data ());
+		return fontPainter->getStringWidth (nullptr, measureString, true);
+	};
+
 #if VSTGUI_STB_TEXTEDIT_USE_UNICODE
+	StringConvert convert;
+	auto str = convert.to_bytes (c);
 	if (pc)
 	{
-		UTF8String str (StringConvert{}.to_bytes (pc));
-		auto pcWidth = fontPainter->getStringWidth (nullptr, str.getPlatformString (), true);
-		str += StringConvert{}.to_bytes (c);
-		auto tcWidth = fontPainter->getStringWidth (nullptr, str.getPlatformString (), true);
-		return tcWidth - pcWidth;
+		auto pcStr = convert.to_bytes (pc);
+		return measure (pcStr + str) - measure (pcStr);
 	}
-	UTF8String str (StringConvert{}.to_bytes (c));
-	return fontPainter->getStringWidth (nullptr, str.getPlatformString (), true);
+	return measure (str);
 #else
 	if (pc)
-	{
-		UTF8String str (std::string (1, pc));
-		auto pcWidth = fontPainter->getStringWidth (nullptr, str.getPlatformString (), true);
-		str += std::string (1, c);
-		auto tcWidth = fontPainter->getStringWidth (nullptr, str.getPlatformString (), true);
-		return tcWidth - pcWidth;
-	}
-
-	UTF8String str (std::string (1, c));
-	return fontPainter->getStringWidth (nullptr, str.getPlatformString (), true);
+		return measure ({pc, c}) - measure (std::string (1, pc));
+	return measure (std::string (1, c));
 #endif
 }
 
@@ -582,18 +604,19 @@ void STBTextEditView::fillCharWidthCache ()
 {
 	if (!charWidthCache.empty ())
 		return;
-#if VSTGUI_STB_TEXTEDIT_USE_UNICODE
-	auto num = uString.size ();
-	charWidthCache.resize (num);
-	for (auto i = 0u; i < num; ++i)
-		charWidthCache[i] = getCharWidth (uString[i], i == 0 ? 0 : uString[i - 1]);
-#else
-	auto num = getText ().length ();
-	charWidthCache.resize (num);
-	const auto& str = getText ().getString ();
-	for (auto i = 0u; i < num; ++i)
-		charWidthCache[i] = getCharWidth (str[i], i == 0 ? 0 : str[i - 1]);
-#endif
+	charWidthCache.resize (static_cast<size_t> (getLength (this)));
+	updateCharWidthCache (0, charWidthCache.size ());
+}
+
+//-----------------------------------------------------------------------------
+void STBTextEditView::updateCharWidthCache (size_t start, size_t end)
+{
+	end = std::min (end, charWidthCache.size ());
+	for (auto i = start; i < end; ++i)
+	{
+		auto index = static_cast<int> (i);
+		charWidthCache[i] = getCharWidth (getChar (this, index), i == 0 ? 0 : getChar (this, index - 1));
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -691,18 +714,22 @@ void STBTextEditView::onTextChange ()
 //-----------------------------------------------------------------------------
 int STBTextEditView::deleteChars (STBTextEditView* self, size_t pos, size_t num)
 {
+	// only the widths of the removed characters and of the character following them change
+	auto& cache = self->charWidthCache;
+	if (!cache.empty ())
+		cache.erase (cache.begin () + pos, cache.begin () + std::min (pos + num, cache.size ()));
 #if VSTGUI_STB_TEXTEDIT_USE_UNICODE
 	self->uString.erase (pos, num);
-	self->setText (StringConvert{}.to_bytes (self->uString));
-	self->onTextChange ();
-	return true;
+	self->setTextInternal (StringConvert{}.to_bytes (self->uString));
 #else
 	auto str = self->text.getString ();
 	str.erase (pos, num);
-	self->setText (str.data ());
+	self->setTextInternal (str.data ());
+#endif
+	if (!cache.empty ())
+		self->updateCharWidthCache (pos, pos + 1);
 	self->onTextChange ();
 	return true; // success
-#endif
 }
 
 //-----------------------------------------------------------------------------
@@ -711,18 +738,22 @@ int STBTextEditView::insertChars (STBTextEditView* self,
 								  const STB_CharT* text,
 								  size_t num)
 {
+	// only the widths of the inserted characters and of the character following them change
+	auto& cache = self->charWidthCache;
+	if (!cache.empty ())
+		cache.insert (cache.begin () + std::min (pos, cache.size ()), num, 0.);
 #if VSTGUI_STB_TEXTEDIT_USE_UNICODE
 	self->uString.insert (pos, text, num);
-	self->setText (StringConvert{}.to_bytes (self->uString));
-	self->onTextChange ();
-	return true;
+	self->setTextInternal (StringConvert{}.to_bytes (self->uString));
 #else
 	auto str = self->text.getString ();
 	str.insert (pos, text, num);
-	self->setText (str.data ());
+	self->setTextInternal (str.data ());
+#endif
+	if (!cache.empty ())
+		self->updateCharWidthCache (pos, pos + num + 1);
 	self->onTextChange ();
 	return true; // success
-#endif
 }
 
 //-----------------------------------------------------------------------------
@@ -754,7 +785,7 @@ void STBTextEditView::layout (StbTexteditRow* row, STBTextEditView* self, int st
 	auto textWidth = static_cast<float> (
 		std::accumulate (self->charWidthCache.begin (), self->charWidthCache.end (), 0.));
 
-	row->num_chars = static_cast<int> (self->getText ().length ());
+	row->num_chars = getLength (self);
 	row->baseline_y_delta = 1.25;
 	row->ymin = 0.f;
 	row->ymax = static_cast<float> (self->getFont ()->getSize ());
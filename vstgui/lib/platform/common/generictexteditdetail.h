@@ -0,0 +1,82 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#pragma once
+
+#include "../../cfont.h"
+
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+//-----------------------------------------------------------------------------
+namespace VSTGUI {
+namespace GenericTextEditDetail {
+
+//-----------------------------------------------------------------------------
+/** Advance of a character when it follows another character (including kerning).
+ *
+ *	The table is shared by all text edits using a font with the same name, size and style, so
+ *	every character pair is only measured once. Only the most recently used tables are cached,
+ *	a text edit keeps its table alive as long as it uses the font. A table forgets all advances
+ *	when it would exceed maxAdvances character pairs.
+ */
+class CharAdvanceTable
+{
+public:
+	using CharT = char16_t;
+
+	static constexpr size_t maxCachedTables = 8;
+	static constexpr size_t maxAdvances = 1 << 16;
+
+	static std::shared_ptr<CharAdvanceTable> get (const CFontDesc* font)
+	{
+		using Entry = std::pair<std::string, std::shared_ptr<CharAdvanceTable>>;
+		// the most recently used table is at the front
+		static std::list<Entry> tables;
+
+		std::string key (font->getName ().getString ());
+		key += '|';
+		key += std::to_string (font->getSize ());
+		key += '|';
+		key += std::to_string (font->getStyle ());
+		auto it = std::find_if (tables.begin (), tables.end (),
+		                        [&] (const Entry& entry) { return entry.first == key; });
+		if (it != tables.end ())
+		{
+			tables.splice (tables.begin (), tables, it);
+			return tables.front ().second;
+		}
+		tables.emplace_front (std::move (key), std::make_shared<CharAdvanceTable> ());
+		if (tables.size () > maxCachedTables)
+			tables.pop_back ();
+		return tables.front ().second;
+	}
+
+	template<typename Proc>
+	CCoord getAdvance (CharT c, CharT pc, Proc measure)
+	{
+		auto key = (static_cast<uint32_t> (static_cast<uint16_t> (pc)) << 16) |
+		           static_cast<uint16_t> (c);
+		auto it = advances.find (key);
+		if (it != advances.end ())
+			return it->second;
+		if (advances.size () >= maxAdvances)
+			advances.clear ();
+		auto advance = measure (c, pc);
+		advances.emplace (key, advance);
+		return advance;
+	}
+
+	size_t getNumAdvances () const { return advances.size (); }
+
+private:
+	std::unordered_map<uint32_t, CCoord> advances;
+};
+
+//-----------------------------------------------------------------------------
+} // GenericTextEditDetail
+} // VSTGUI
@@ -0,0 +1,93 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "mappedfileresourceinputstream.h"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//-----------------------------------------------------------------------------
+namespace VSTGUI {
+
+//-----------------------------------------------------------------------------
+auto MappedFileResourceInputStream::create (const std::string& path) -> Ptr
+{
+	auto fd = ::open (path.data (), O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return nullptr;
+	void* mapping = MAP_FAILED;
+	struct stat fileStat;
+	if (fstat (fd, &fileStat) == 0 && S_ISREG (fileStat.st_mode) && fileStat.st_size > 0)
+		mapping = mmap (nullptr, static_cast<size_t> (fileStat.st_size), PROT_READ, MAP_PRIVATE,
+		                fd, 0);
+	// the mapping stays valid after the file is closed
+	::close (fd);
+	if (mapping == MAP_FAILED)
+		return nullptr;
+	auto size = static_cast<uint64_t> (fileStat.st_size);
+	madvise (mapping, static_cast<size_t> (size), MADV_SEQUENTIAL);
+	return Ptr (new MappedFileResourceInputStream (static_cast<const uint8_t*> (mapping), size));
+}
+
+//-----------------------------------------------------------------------------
+MappedFileResourceInputStream::MappedFileResourceInputStream (const uint8_t* data, uint64_t size)
+: data (data), dataSize (size)
+{
+}
+
+//-----------------------------------------------------------------------------
+MappedFileResourceInputStream::~MappedFileResourceInputStream () noexcept
+{
+	munmap (const_cast<uint8_t*> (data), static_cast<size_t> (dataSize));
+}
+
+//-----------------------------------------------------------------------------
+uint32_t MappedFileResourceInputStream::readRaw (void* buffer, uint32_t size)
+{
+	auto numBytes = static_cast<uint32_t> (std::min<uint64_t> (size, dataSize - position));
+	std::memcpy (buffer, data + position, numBytes);
+	position += numBytes;
+	return numBytes;
+}
+
+//-----------------------------------------------------------------------------
+int64_t MappedFileResourceInputStream::seek (int64_t pos, SeekMode mode)
+{
+	int64_t newPosition;
+	switch (mode)
+	{
+		case SeekMode::Set:
+			newPosition = pos;
+			break;
+		case SeekMode::Current:
+			newPosition = static_cast<int64_t> (position) + pos;
+			break;
+		case SeekMode::End:
+			newPosition = static_cast<int64_t> (dataSize) + pos;
+			break;
+	}
+	if (newPosition < 0 || static_cast<uint64_t> (newPosition) > dataSize)
+		return kStreamSeekError;
+	position = static_cast<uint64_t> (newPosition);
+	return newPosition;
+}
+
+//-----------------------------------------------------------------------------
+int64_t MappedFileResourceInputStream::tell ()
+{
+	return static_cast<int64_t> (position);
+}
+
+//-----------------------------------------------------------------------------
+const void* MappedFileResourceInputStream::getMemory (uint64_t& size) const
+{
+	size = dataSize;
+	return data;
+}
+
+//-----------------------------------------------------------------------------
+} // VSTGUI
@@ -0,0 +1,42 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#pragma once
+
+#include "../iplatformresourceinputstream.h"
+#include <string>
+
+//-----------------------------------------------------------------------------
+namespace VSTGUI {
+
+//-----------------------------------------------------------------------------
+/** read only resource input stream of a file which is mapped into memory
+ *
+ *	The file must not be truncated while it is mapped, reading the pages behind the new end of
+ *	the file raises SIGBUS. This is acceptable for resources, as they are read only files inside
+ *	of the bundle of the plug-in or application, which are only replaced when it is reinstalled.
+ *	Files which may be changed by others, like user presets, must be read with a CFileStream.
+ */
+class MappedFileResourceInputStream : public IPlatformResourceInputStream
+{
+public:
+	/** returns nullptr if the file cannot be mapped, i.e. if it is empty */
+	static Ptr create (const std::string& path);
+
+private:
+	MappedFileResourceInputStream (const uint8_t* data, uint64_t size);
+	~MappedFileResourceInputStream () noexcept override;
+
+	uint32_t readRaw (void* buffer, uint32_t size) override;
+	int64_t seek (int64_t pos, SeekMode mode) override;
+	int64_t tell () override;
+	const void* getMemory (uint64_t& size) const override;
+
+	const uint8_t* data;
+	uint64_t dataSize;
+	uint64_t position {0};
+};
+
+//-----------------------------------------------------------------------------
+} // VSTGUI
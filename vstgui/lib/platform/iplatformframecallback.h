@@ -22,6 +22,7 @@ enum PlatformType {
 	kHWNDTopLevel,	// Windows HWDN Top Level (non child)
 	kX11EmbedWindowID,	// X11 XID
 	kGdkWindow, // GdkWindow
+	kHeadless,	// no window, the frame is rendered offscreen (only supported on Linux, see X11::HeadlessFrameConfig)
 
 	kDefaultNative = -1
 };
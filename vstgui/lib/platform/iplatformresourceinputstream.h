@@ -20,6 +20,10 @@ public:
 	virtual uint32_t readRaw (void* buffer, uint32_t size) = 0;
 	virtual int64_t seek (int64_t pos, SeekMode mode) = 0;
 	virtual int64_t tell () = 0;
+	/** returns the whole content if it is available in memory (i.e. memory mapped) or nullptr.
+	 *	The memory is valid as long as the stream exists.
+	 */
+	virtual const void* getMemory (uint64_t& size) const { return nullptr; }
 
 	using Ptr = std::unique_ptr<IPlatformResourceInputStream>;
 	static Ptr create (const CResourceDescription& desc);
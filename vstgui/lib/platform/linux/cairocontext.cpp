@@ -287,7 +287,6 @@ void Context::drawLines (const CDrawContext::LineList& lines)
 				CPoint end = pixelAlign (getCurrentTransform (), line.second);
 				cairo_move_to (cr, start.x + 0.5, start.y + 0.5);
 				cairo_line_to (cr, end.x + 0.5, end.y + 0.5);
-				cairo_stroke (cr);
 			}
 		}
 		else
@@ -296,10 +295,12 @@ void Context::drawLines (const CDrawContext::LineList& lines)
 			{
 				cairo_move_to (cr, line.first.x, line.first.y);
 				cairo_line_to (cr, line.second.x, line.second.y);
-				cairo_stroke (cr);
 			}
 		}
+		// all lines are stroked at once
+		cairo_stroke (cr);
 	}
+	checkCairoStatus (cr);
 }
 
 //-----------------------------------------------------------------------------
@@ -320,20 +321,40 @@ void Context::drawPolygon (const CDrawContext::PointList& polygonPointList,
 	}
 }
 
+//-----------------------------------------------------------------------------
+void Context::addRectToPath (const CRect& rect)
+{
+	CRect r (rect);
+	if (needPixelAlignment (getDrawMode ()))
+	{
+		r = pixelAlign (getCurrentTransform (), r);
+		cairo_rectangle (cr, r.left + 0.5, r.top + 0.5, r.getWidth (), r.getHeight ());
+	}
+	else
+		cairo_rectangle (cr, r.left + 0.5, r.top + 0.5, r.getWidth () - 0.5,
+						 r.getHeight () - 0.5);
+}
+
 //-----------------------------------------------------------------------------
 void Context::drawRect (const CRect& rect, const CDrawStyle drawStyle)
 {
 	if (auto cd = DrawBlock::begin (*this))
 	{
-		CRect r (rect);
-		if (needPixelAlignment (getDrawMode ()))
-		{
-			r = pixelAlign (getCurrentTransform (), r);
-			cairo_rectangle (cr, r.left + 0.5, r.top + 0.5, r.getWidth (), r.getHeight ());
-		}
-		else
-			cairo_rectangle (cr, r.left + 0.5, r.top + 0.5, r.getWidth () - 0.5,
-							 r.getHeight () - 0.5);
+		addRectToPath (rect);
+		draw (drawStyle);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void Context::drawRects (const RectList& rects, const CDrawStyle drawStyle)
+{
+	if (rects.empty ())
+		return;
+	if (auto cd = DrawBlock::begin (*this))
+	{
+		// one path for all rects, so that they are filled and stroked at once
+		for (const auto& rect : rects)
+			addRectToPath (rect);
 		draw (drawStyle);
 	}
 }
@@ -377,56 +398,158 @@ void Context::drawPoint (const CPoint& point, const CColor& color)
 	checkCairoStatus (cr);
 }
 
+//-----------------------------------------------------------------------------
+SharedPointer<Bitmap> Context::getBestBitmap (CBitmap* bitmap) const
+{
+	double transformedScaleFactor = getScaleFactor ();
+	CGraphicsTransform t = getCurrentTransform ();
+	if (t.m11 == t.m22 && t.m12 == 0 && t.m21 == 0)
+		transformedScaleFactor *= t.m11;
+	return bitmap->getBestPlatformBitmapForScaleFactor (transformedScaleFactor).cast<Bitmap> ();
+}
+
 //-----------------------------------------------------------------------------
 void Context::drawBitmap (CBitmap* bitmap, const CRect& dest, const CPoint& offset, float alpha)
 {
+	auto cairoBitmap = getBestBitmap (bitmap);
+	if (!cairoBitmap)
+	{
+		// bitmaps without own pixels like CAtlasBitmap know how to draw themselves
+		if (auto atlasBitmap = dynamic_cast<CAtlasBitmap*> (bitmap))
+			atlasBitmap->draw (this, dest, offset, alpha);
+		return;
+	}
 	if (auto cd = DrawBlock::begin (*this))
 	{
-		double transformedScaleFactor = getScaleFactor();
-		CGraphicsTransform t = getCurrentTransform ();
-		if (t.m11 == t.m22 && t.m12 == 0 && t.m21 == 0)
-			transformedScaleFactor *= t.m11;
-                auto cairoBitmap = bitmap->getBestPlatformBitmapForScaleFactor (transformedScaleFactor).cast<Bitmap> ();
-		if (cairoBitmap)
+		cairo_translate (cr, dest.left, dest.top);
+		cairo_rectangle (cr, 0, 0, dest.getWidth (), dest.getHeight ());
+		cairo_clip (cr);
+
+		// Setup a pattern for scaling bitmaps and take it as source afterwards.
+		auto pattern = cairo_pattern_create_for_surface (cairoBitmap->getSurface());
+		cairo_matrix_t matrix;
+		cairo_pattern_get_matrix (pattern, &matrix);
+		cairo_matrix_init_scale (&matrix, cairoBitmap->getScaleFactor (), cairoBitmap->getScaleFactor ());
+		cairo_matrix_translate (&matrix, offset.x, offset.y);
+		cairo_pattern_set_matrix (pattern, &matrix);
+		cairo_set_source (cr, pattern);
+
+		cairo_rectangle (cr, -offset.x, -offset.y, dest.getWidth () + offset.x, dest.getHeight () + offset.y);
+		alpha *= getGlobalAlpha ();
+		if (alpha != 1.f)
 		{
-			cairo_translate (cr, dest.left, dest.top);
-			cairo_rectangle (cr, 0, 0, dest.getWidth (), dest.getHeight ());
-			cairo_clip (cr);
+			cairo_paint_with_alpha (cr, alpha);
+		}
+		else
+		{
+			cairo_fill (cr);
+		}
+
+		cairo_pattern_destroy (pattern);
+	}
+	checkCairoStatus (cr);
+}
+
+//-----------------------------------------------------------------------------
+void Context::clearRect (const CRect& rect)
+{
+	if (auto cd = DrawBlock::begin (*this))
+	{
+		cairo_set_operator (cr, CAIRO_OPERATOR_CLEAR);
+		cairo_rectangle (cr, rect.left, rect.top, rect.getWidth (), rect.getHeight ());
+		cairo_fill (cr);
+	}
+	checkCairoStatus (cr);
+}
+
+//-----------------------------------------------------------------------------
+void Context::drawBitmapSprites (CBitmap* bitmap, const BitmapSpriteList& sprites, float alpha)
+{
+	if (sprites.empty ())
+		return;
+	auto cairoBitmap = getBestBitmap (bitmap);
+	if (!cairoBitmap)
+	{
+		// bitmaps without own pixels like CAtlasBitmap know how to draw themselves
+		CDrawContext::drawBitmapSprites (bitmap, sprites, alpha);
+		return;
+	}
+	if (auto cd = DrawBlock::begin (*this))
+	{
+		auto pattern = cairo_pattern_create_for_surface (cairoBitmap->getSurface ());
+		auto scaleFactor = cairoBitmap->getScaleFactor ();
+		alpha *= getGlobalAlpha ();
 
-			// Setup a pattern for scaling bitmaps and take it as source afterwards.
-			auto pattern = cairo_pattern_create_for_surface (cairoBitmap->getSurface());
+		// sprites which map to the same bitmap position share one pattern fill
+		auto fill = [&] (const CPoint& patternOffset) {
 			cairo_matrix_t matrix;
-			cairo_pattern_get_matrix (pattern, &matrix);
-			cairo_matrix_init_scale (&matrix, cairoBitmap->getScaleFactor (), cairoBitmap->getScaleFactor ());
-			cairo_matrix_translate (&matrix, offset.x, offset.y);
+			cairo_matrix_init_scale (&matrix, scaleFactor, scaleFactor);
+			cairo_matrix_translate (&matrix, patternOffset.x, patternOffset.y);
 			cairo_pattern_set_matrix (pattern, &matrix);
 			cairo_set_source (cr, pattern);
-
-			cairo_rectangle (cr, -offset.x, -offset.y, dest.getWidth () + offset.x, dest.getHeight () + offset.y);
-			alpha *= getGlobalAlpha ();
 			if (alpha != 1.f)
 			{
+				cairo_save (cr);
+				cairo_clip (cr);
 				cairo_paint_with_alpha (cr, alpha);
+				cairo_restore (cr);
 			}
 			else
 			{
 				cairo_fill (cr);
 			}
+		};
 
-			cairo_pattern_destroy (pattern);
+		auto patternOffset = sprites.front ().offset - sprites.front ().dest.getTopLeft ();
+		for (const auto& sprite : sprites)
+		{
+			auto spriteOffset = sprite.offset - sprite.dest.getTopLeft ();
+			if (spriteOffset != patternOffset)
+			{
+				fill (patternOffset);
+				patternOffset = spriteOffset;
+			}
+			cairo_rectangle (cr, sprite.dest.left, sprite.dest.top, sprite.dest.getWidth (),
+							 sprite.dest.getHeight ());
 		}
+		fill (patternOffset);
+
+		cairo_pattern_destroy (pattern);
 	}
 	checkCairoStatus (cr);
 }
 
 //-----------------------------------------------------------------------------
-void Context::clearRect (const CRect& rect)
+void Context::drawPolylines (const PolylineList& polylines)
 {
+	if (polylines.empty ())
+		return;
 	if (auto cd = DrawBlock::begin (*this))
 	{
-		cairo_set_operator (cr, CAIRO_OPERATOR_CLEAR);
-		cairo_rectangle (cr, rect.left, rect.top, rect.getWidth (), rect.getHeight ());
-		cairo_fill (cr);
+		setupCurrentStroke ();
+		setSourceColor (getFrameColor ());
+		const bool integral = getDrawMode ().integralMode ();
+		for (const auto& polyline : polylines)
+		{
+			if (polyline.size () < 2)
+				continue;
+			auto first = true;
+			for (const auto& point : polyline)
+			{
+				CPoint p (point);
+				if (integral)
+				{
+					p = pixelAlign (getCurrentTransform (), p);
+					p.offset (0.5, 0.5);
+				}
+				if (first)
+					cairo_move_to (cr, p.x, p.y);
+				else
+					cairo_line_to (cr, p.x, p.y);
+				first = false;
+			}
+		}
+		cairo_stroke (cr);
 	}
 	checkCairoStatus (cr);
 }
@@ -493,9 +616,9 @@ void Context::drawGraphicsPath (CGraphicsPath* path, CDrawContext::PathDrawMode
 }
 
 //-----------------------------------------------------------------------------
-void Context::fillLinearGradient (CGraphicsPath* path, const CGradient& gradient,
-								  const CPoint& startPoint, const CPoint& endPoint, bool evenOdd,
-								  CGraphicsTransform* transformation)
+void Context::fillGradient (CGraphicsPath* path, const CGradient& gradient, bool evenOdd,
+							CGraphicsTransform* transformation,
+							const std::function<const PatternHandle&(const Gradient&)>& getPattern)
 {
 	if (auto cairoPath = dynamic_cast<Path*> (path))
 	{
@@ -503,21 +626,39 @@ void Context::fillLinearGradient (CGraphicsPath* path, const CGradient& gradient
 		{
 			if (auto cd = DrawBlock::begin (*this))
 			{
+				if (transformation)
+				{
+					cairo_matrix_t currentMatrix;
+					cairo_matrix_t resultMatrix;
+					auto matrix = convert (*transformation);
+					cairo_get_matrix (cr, &currentMatrix);
+					cairo_matrix_multiply (&resultMatrix, &currentMatrix, &matrix);
+					cairo_set_matrix (cr, &resultMatrix);
+				}
+				auto& pattern = getPattern (*cairoGradient);
+				if (!pattern)
+					return;
 				auto p = cairoPath->getPath (cr);
 				cairo_append_path (cr, p);
-				cairo_set_source (cr, cairoGradient->getLinearGradient (startPoint, endPoint));
+				cairo_set_source (cr, pattern);
 				if (evenOdd)
-				{
 					cairo_set_fill_rule (cr, CAIRO_FILL_RULE_EVEN_ODD);
-					cairo_fill (cr);
-				}
-				else
-				{
-					cairo_fill (cr);
-				}
+				cairo_fill (cr);
 			}
 		}
 	}
+	checkCairoStatus (cr);
+}
+
+//-----------------------------------------------------------------------------
+void Context::fillLinearGradient (CGraphicsPath* path, const CGradient& gradient,
+								  const CPoint& startPoint, const CPoint& endPoint, bool evenOdd,
+								  CGraphicsTransform* transformation)
+{
+	fillGradient (path, gradient, evenOdd, transformation,
+				  [&] (const Gradient& g) -> const PatternHandle& {
+					  return g.getLinearGradient (startPoint, endPoint);
+				  });
 }
 
 //-----------------------------------------------------------------------------
@@ -525,11 +666,10 @@ void Context::fillRadialGradient (CGraphicsPath* path, const CGradient& gradient
 								  const CPoint& center, CCoord radius, const CPoint& originOffset,
 								  bool evenOdd, CGraphicsTransform* transformation)
 {
-#warning TODO: Implementation
-	auto cd = DrawBlock::begin (*this);
-	if (cd)
-	{
-	}
+	fillGradient (path, gradient, evenOdd, transformation,
+				  [&] (const Gradient& g) -> const PatternHandle& {
+					  return g.getRadialGradient (center, radius, originOffset);
+				  });
 }
 
 //-----------------------------------------------------------------------------
@@ -7,12 +7,14 @@
 #include "cairoutils.h"
 
 #include "../../coffscreencontext.h"
+#include <functional>
 
 //------------------------------------------------------------------------
 namespace VSTGUI {
 namespace Cairo {
 
 class Bitmap;
+class Gradient;
 
 //------------------------------------------------------------------------
 class Context : public COffscreenContext
@@ -41,6 +43,10 @@ public:
 	void drawBitmap (CBitmap* bitmap, const CRect& dest, const CPoint& offset,
 	                 float alpha) override;
 	void clearRect (const CRect& rect) override;
+	void drawRects (const RectList& rects, const CDrawStyle drawStyle) override;
+	void drawBitmapSprites (CBitmap* bitmap, const BitmapSpriteList& sprites,
+	                        float alpha) override;
+	void drawPolylines (const PolylineList& polylines) override;
 	CGraphicsPath* createGraphicsPath () override;
 	CGraphicsPath* createTextPath (const CFontRef font, UTF8StringPtr text) override;
 	void drawGraphicsPath (CGraphicsPath* path, PathDrawMode mode,
@@ -63,6 +69,11 @@ private:
 	void setSourceColor (CColor color);
 	void setupCurrentStroke ();
 	void draw (CDrawStyle drawstyle);
+	void addRectToPath (const CRect& rect);
+	void fillGradient (CGraphicsPath* path, const CGradient& gradient, bool evenOdd,
+					   CGraphicsTransform* transformation,
+					   const std::function<const PatternHandle&(const Gradient&)>& getPattern);
+	SharedPointer<Bitmap> getBestBitmap (CBitmap* bitmap) const;
 
 	SurfaceHandle surface;
 	ContextHandle cr;
@@ -35,35 +35,57 @@ void Gradient::destroy () const
 }
 
 //------------------------------------------------------------------------
-const PatternHandle& Gradient::getLinearGradient (CPoint start, CPoint end) const
+void Gradient::addColorStops (const PatternHandle& pattern) const
 {
-	if (!linearGradient || start != linearGradientStart || end != linearGradientEnd)
+	for (auto& it : this->colorStops)
+		cairo_pattern_add_color_stop_rgba (pattern, it.first, it.second.red / 255.,
+										   it.second.green / 255., it.second.blue / 255.,
+										   it.second.alpha / 255.);
+}
+
+//------------------------------------------------------------------------
+const PatternHandle& Gradient::position (const PatternHandle& pattern, const CPoint& origin,
+										 const CPoint& xAxis)
+{
+	// the pattern matrix maps from user space to pattern space, so we setup the matrix which
+	// maps the unit vectors of the pattern to user space and invert it
+	cairo_matrix_t matrix;
+	cairo_matrix_init (&matrix, xAxis.x, xAxis.y, -xAxis.y, xAxis.x, origin.x, origin.y);
+	cairo_matrix_invert (&matrix);
+	cairo_pattern_set_matrix (pattern, &matrix);
+	return pattern;
+}
+
+//------------------------------------------------------------------------
+const PatternHandle& Gradient::getLinearGradient (const CPoint& start, const CPoint& end) const
+{
+	static const PatternHandle invalid;
+	if (start == end)
+		return invalid;
+	if (!linearGradient)
 	{
-		destroy ();
-		linearGradientStart = start;
-		linearGradientEnd = end;
-		linearGradient =
-			PatternHandle (cairo_pattern_create_linear (start.x, start.y, end.x, end.y));
-		for (auto& it : this->colorStops)
-			cairo_pattern_add_color_stop_rgba (linearGradient, it.first, it.second.red / 255.,
-											   it.second.green / 255., it.second.blue / 255.,
-											   it.second.alpha);
+		linearGradient = PatternHandle (cairo_pattern_create_linear (0, 0, 1, 0));
+		addColorStops (linearGradient);
 	}
-	return linearGradient;
+	return position (linearGradient, start, end - start);
 }
 
 //------------------------------------------------------------------------
-const PatternHandle& Gradient::getRadialGradient () const
+const PatternHandle& Gradient::getRadialGradient (const CPoint& center, CCoord radius,
+												  const CPoint& originOffset) const
 {
-	if (!radialGradient)
+	static const PatternHandle invalid;
+	if (radius <= 0.)
+		return invalid;
+	CPoint origin (originOffset.x / radius, originOffset.y / radius);
+	if (!radialGradient || origin != radialGradientOrigin)
 	{
-		radialGradient = PatternHandle (cairo_pattern_create_radial (0, 0, 1, 0, 0, 1));
-		for (auto& it : this->colorStops)
-			cairo_pattern_add_color_stop_rgba (radialGradient, it.first, it.second.red / 255.,
-											   it.second.green / 255., it.second.blue / 255.,
-											   it.second.alpha);
+		radialGradientOrigin = origin;
+		radialGradient =
+			PatternHandle (cairo_pattern_create_radial (origin.x, origin.y, 0, 0, 0, 1));
+		addColorStops (radialGradient);
 	}
-	return radialGradient;
+	return position (radialGradient, center, CPoint (radius, 0));
 }
 
 //------------------------------------------------------------------------
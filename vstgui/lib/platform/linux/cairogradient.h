@@ -34,18 +34,35 @@ public:
 	}
 #endif
 
-	const PatternHandle& getLinearGradient (CPoint start, CPoint end) const;
-	const PatternHandle& getRadialGradient () const;
+	/** get the linear gradient pattern positioned from start to end.
+	 *
+	 *	the pattern is only build once in unit space and positioned via its pattern matrix, so
+	 *	the returned pattern is only valid until the next call.
+	 *	@return nullptr if start and end are equal
+	 */
+	const PatternHandle& getLinearGradient (const CPoint& start, const CPoint& end) const;
+	/** get the radial gradient pattern positioned at center with radius.
+	 *
+	 *	same as getLinearGradient, the pattern is only rebuild when the origin offset relative
+	 *	to the radius changes.
+	 *	@return nullptr if the radius is not positive
+	 */
+	const PatternHandle& getRadialGradient (const CPoint& center, CCoord radius,
+											const CPoint& originOffset) const;
 
 private:
 	void destroy () const;
+	void addColorStops (const PatternHandle& pattern) const;
 
-	/* we want to calculate a normalized linear and radial gradiant */
+	static const PatternHandle& position (const PatternHandle& pattern, const CPoint& origin,
+										  const CPoint& xAxis);
+
+	/* the linear gradient goes from (0, 0) to (1, 0), the radial gradient is centered at
+	 * (0, 0) with a radius of 1 */
 	mutable PatternHandle linearGradient;
 	mutable PatternHandle radialGradient;
 
-	mutable CPoint linearGradientStart;
-	mutable CPoint linearGradientEnd;
+	mutable CPoint radialGradientOrigin;
 };
 
 //------------------------------------------------------------------------
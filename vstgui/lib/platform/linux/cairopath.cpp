@@ -6,6 +6,7 @@
 #include "../../cgradient.h"
 #include "../../cgraphicstransform.h"
 #include "cairocontext.h"
+#include <algorithm>
 
 //------------------------------------------------------------------------
 namespace VSTGUI {
@@ -32,44 +33,25 @@ CGradient* Path::createGradient (double color1Start, double color2Start,
 //------------------------------------------------------------------------
 bool Path::hitTest (const CPoint& p, bool evenOddFilled, CGraphicsTransform* transform)
 {
-#warning TODO: Implementation (use cairo_in_fill)
-	(void)p;
-	(void)evenOddFilled;
-	(void)transform;
-	return false;
+	CPoint where (p);
+	if (transform)
+		transform->inverse ().transform (where);
+	const auto& geo = getGeometry ();
+	if (!geo.bounds.pointInside (where))
+		return false;
+	return polygonsContain (geo.polygons, where, evenOddFilled);
 }
 
 //------------------------------------------------------------------------
 CPoint Path::getCurrentPosition ()
 {
-	CPoint p;
-	if (auto cPath = getPath (cr))
-	{
-		cairo_save (cr);
-		cairo_new_path (cr);
-		cairo_append_path (cr, cPath);
-		cairo_get_current_point (cr, &p.x, &p.y);
-		cairo_restore (cr);
-	}
-	return p;
+	return getGeometry ().currentPosition;
 }
 
 //------------------------------------------------------------------------
 CRect Path::getBoundingBox ()
 {
-	CRect r;
-	if (auto cPath = getPath (cr))
-	{
-		cairo_save (cr);
-		cairo_new_path (cr);
-		cairo_append_path (cr, cPath);
-		CPoint p1, p2;
-		cairo_path_extents (cr, &p1.x, &p1.y, &p2.x, &p2.y);
-		cairo_restore (cr);
-		r.setTopLeft (p1);
-		r.setBottomRight (p2);
-	}
-	return r;
+	return getGeometry ().bounds;
 }
 
 //------------------------------------------------------------------------
@@ -80,118 +62,237 @@ void Path::dirty ()
 		cairo_path_destroy (path);
 		path = nullptr;
 	}
+	if (alignedPath)
+	{
+		cairo_path_destroy (alignedPath);
+		alignedPath = nullptr;
+	}
+	geometryValid = false;
+}
+
+//------------------------------------------------------------------------
+auto Path::getGeometry () -> const Geometry&
+{
+	if (geometryValid)
+		return geometry;
+	geometry = {};
+	geometryValid = true;
+	if (!cr)
+		return geometry;
+
+	// flatten in path coordinates, so that the tolerance does not depend on the current transform
+	cairo_save (cr);
+	cairo_identity_matrix (cr);
+	cairo_new_path (cr);
+	addElements (cr, nullptr);
+	if (cairo_has_current_point (cr))
+		cairo_get_current_point (cr, &geometry.currentPosition.x, &geometry.currentPosition.y);
+	auto flatPath = cairo_copy_path_flat (cr);
+	cairo_new_path (cr);
+	cairo_restore (cr);
+	if (!flatPath)
+		return geometry;
+
+	bool empty = true;
+	for (auto i = 0; i < flatPath->num_data; i += flatPath->data[i].header.length)
+	{
+		const auto& header = flatPath->data[i].header;
+		if (header.type == CAIRO_PATH_CLOSE_PATH)
+			continue;
+		CPoint point (flatPath->data[i + 1].point.x, flatPath->data[i + 1].point.y);
+		if (header.type == CAIRO_PATH_MOVE_TO || geometry.polygons.empty ())
+			geometry.polygons.emplace_back ();
+		geometry.polygons.back ().push_back (point);
+		if (empty)
+		{
+			geometry.bounds = CRect (point.x, point.y, point.x, point.y);
+			empty = false;
+		}
+		else
+		{
+			geometry.bounds.left = std::min (geometry.bounds.left, point.x);
+			geometry.bounds.top = std::min (geometry.bounds.top, point.y);
+			geometry.bounds.right = std::max (geometry.bounds.right, point.x);
+			geometry.bounds.bottom = std::max (geometry.bounds.bottom, point.y);
+		}
+	}
+	cairo_path_destroy (flatPath);
+	return geometry;
+}
+
+//------------------------------------------------------------------------
+bool Path::polygonsContain (const PolygonList& polygons, const CPoint& p, bool evenOdd)
+{
+	// every polygon is implicitly closed, like when filling
+	int32_t winding = 0;
+	uint32_t crossings = 0;
+	for (const auto& polygon : polygons)
+	{
+		if (polygon.size () < 3)
+			continue;
+		auto prev = polygon.back ();
+		for (const auto& cur : polygon)
+		{
+			if ((prev.y <= p.y) != (cur.y <= p.y))
+			{
+				auto x = prev.x + (p.y - prev.y) * (cur.x - prev.x) / (cur.y - prev.y);
+				if (x > p.x)
+				{
+					++crossings;
+					winding += cur.y > prev.y ? 1 : -1;
+				}
+			}
+			prev = cur;
+		}
+	}
+	return evenOdd ? (crossings % 2) == 1 : winding != 0;
 }
 
 //------------------------------------------------------------------------
 cairo_path_t* Path::getPath (const ContextHandle& handle, const CGraphicsTransform* alignTm)
 {
 	if (alignTm)
-		dirty ();
+	{
+		// the pixel aligned variant depends on the transform
+		if (alignedPath && alignedPathTransform != *alignTm)
+		{
+			cairo_path_destroy (alignedPath);
+			alignedPath = nullptr;
+		}
+		if (!alignedPath)
+		{
+			cairo_new_path (handle);
+			addElements (handle, alignTm);
+			alignedPath = cairo_copy_path (handle);
+			alignedPathTransform = *alignTm;
+			cairo_new_path (handle); // clear path
+		}
+		return alignedPath;
+	}
 	if (!path)
 	{
 		cairo_new_path (handle);
-		for (auto& e : elements)
+		addElements (handle, nullptr);
+		path = cairo_copy_path (handle);
+		cairo_new_path (handle); // clear path
+	}
+	return path;
+}
+
+//------------------------------------------------------------------------
+void Path::addElements (const ContextHandle& handle, const CGraphicsTransform* alignTm) const
+{
+	for (auto& e : elements)
+	{
+		switch (e.type)
 		{
-			switch (e.type)
+			case Element::Type::kBeginSubpath:
 			{
-				case Element::Type::kBeginSubpath:
+				cairo_new_sub_path (handle);
+				if (alignTm)
 				{
-					cairo_new_sub_path (handle);
-					if (alignTm)
-					{
-						auto p = pixelAlign (*alignTm,
-											 CPoint {e.instruction.point.x, e.instruction.point.y});
-						cairo_move_to (handle, p.x - 0.5, p.y - 0.5);
-					}
-					else
-						cairo_move_to (handle, e.instruction.point.x, e.instruction.point.y);
-					break;
+					auto p = pixelAlign (*alignTm,
+										 CPoint {e.instruction.point.x, e.instruction.point.y});
+					cairo_move_to (handle, p.x - 0.5, p.y - 0.5);
 				}
-				case Element::Type::kCloseSubpath:
+				else
+					cairo_move_to (handle, e.instruction.point.x, e.instruction.point.y);
+				break;
+			}
+			case Element::Type::kCloseSubpath:
+			{
+				cairo_close_path (handle);
+				break;
+			}
+			case Element::Type::kLine:
+			{
+				if (alignTm)
 				{
-					cairo_close_path (handle);
-					break;
+					auto p = pixelAlign (*alignTm,
+										 CPoint {e.instruction.point.x, e.instruction.point.y});
+					cairo_line_to (handle, p.x - 0.5, p.y - 0.5);
 				}
-				case Element::Type::kLine:
+				else
+					cairo_line_to (handle, e.instruction.point.x, e.instruction.point.y);
+				break;
+			}
+			case Element::Type::kBezierCurve:
+			{
+				cairo_curve_to (handle, e.instruction.curve.control1.x,
+								e.instruction.curve.control1.y, e.instruction.curve.control2.x,
+								e.instruction.curve.control2.y, e.instruction.curve.end.x,
+								e.instruction.curve.end.y);
+				break;
+			}
+			case Element::Type::kRect:
+			{
+				if (alignTm)
 				{
-					if (alignTm)
-					{
-						auto p = pixelAlign (*alignTm,
-											 CPoint {e.instruction.point.x, e.instruction.point.y});
-						cairo_line_to (handle, p.x - 0.5, p.y - 0.5);
-					}
-					else
-						cairo_line_to (handle, e.instruction.point.x, e.instruction.point.y);
-					break;
+					auto r = pixelAlign (
+						*alignTm, CRect {e.instruction.rect.left, e.instruction.rect.top,
+										 e.instruction.rect.right, e.instruction.rect.bottom});
+					cairo_rectangle (handle, r.left - 0.5, r.top - 0.5, r.getWidth (),
+									 r.getHeight ());
 				}
-				case Element::Type::kBezierCurve:
+				else
 				{
-					cairo_curve_to (handle, e.instruction.curve.control1.x,
-									e.instruction.curve.control1.y, e.instruction.curve.control2.x,
-									e.instruction.curve.control2.y, e.instruction.curve.end.x,
-									e.instruction.curve.end.y);
-					break;
+					cairo_rectangle (handle, e.instruction.rect.left, e.instruction.rect.top,
+									 e.instruction.rect.right - e.instruction.rect.left,
+									 e.instruction.rect.bottom - e.instruction.rect.top);
 				}
-				case Element::Type::kRect:
-				{
-					if (alignTm)
-					{
-						auto r = pixelAlign (
-							*alignTm, CRect {e.instruction.rect.left, e.instruction.rect.top,
-											 e.instruction.rect.right, e.instruction.rect.bottom});
-						cairo_rectangle (handle, r.left - 0.5, r.top - 0.5, r.getWidth (),
-										 r.getHeight ());
-					}
-					else
-					{
-						cairo_rectangle (handle, e.instruction.rect.left, e.instruction.rect.top,
-										 e.instruction.rect.right - e.instruction.rect.left,
-										 e.instruction.rect.bottom - e.instruction.rect.top);
-					}
+				break;
+			}
+			case Element::Type::kEllipse:
+			{
+				const auto& r = e.instruction.rect;
+				auto radiusX = (r.right - r.left) / 2.;
+				auto radiusY = (r.bottom - r.top) / 2.;
+				if (radiusX <= 0. || radiusY <= 0.)
 					break;
+				cairo_matrix_t matrix;
+				cairo_get_matrix (handle, &matrix);
+				cairo_new_sub_path (handle);
+				cairo_translate (handle, r.left + radiusX, r.top + radiusY);
+				cairo_scale (handle, radiusX, radiusY);
+				cairo_arc (handle, 0, 0, 1, 0, 2 * M_PI);
+				cairo_set_matrix (handle, &matrix);
+				cairo_close_path (handle);
+				break;
+			}
+			case Element::Type::kArc:
+			{
+				auto radiusX =
+					(e.instruction.arc.rect.right - e.instruction.arc.rect.left) / 2.;
+				auto radiusY =
+					(e.instruction.arc.rect.bottom - e.instruction.arc.rect.top) / 2.;
+
+				auto centerX = static_cast<double> (e.instruction.arc.rect.left + radiusX);
+				auto centerY = static_cast<double> (e.instruction.arc.rect.top + radiusY);
+
+				double startAngle = radians (e.instruction.arc.startAngle);
+				double endAngle = radians (e.instruction.arc.endAngle);
+				if (radiusX != radiusY)
+				{
+					startAngle = atan2 (sin (startAngle) * radiusX, cos (startAngle) * radiusY);
+					endAngle = atan2 (sin (endAngle) * radiusX, cos (endAngle) * radiusY);
 				}
-				case Element::Type::kEllipse: {
-#warning TODO: Implementation Element::Type::kEllipse
-					break;
+				cairo_matrix_t matrix;
+				cairo_get_matrix (handle, &matrix);
+				cairo_translate (handle, centerX, centerY);
+				cairo_scale (handle, radiusX, radiusY);
+				if (e.instruction.arc.clockwise)
+				{
+					cairo_arc (handle, 0, 0, 1, startAngle, endAngle);
 				}
-				case Element::Type::kArc:
+				else
 				{
-					auto radiusX =
-						(e.instruction.arc.rect.right - e.instruction.arc.rect.left) / 2.;
-					auto radiusY =
-						(e.instruction.arc.rect.bottom - e.instruction.arc.rect.top) / 2.;
-
-					auto centerX = static_cast<double> (e.instruction.arc.rect.left + radiusX);
-					auto centerY = static_cast<double> (e.instruction.arc.rect.top + radiusY);
-
-					double startAngle = radians (e.instruction.arc.startAngle);
-					double endAngle = radians (e.instruction.arc.endAngle);
-					if (radiusX != radiusY)
-					{
-						startAngle = atan2 (sin (startAngle) * radiusX, cos (startAngle) * radiusY);
-						endAngle = atan2 (sin (endAngle) * radiusX, cos (endAngle) * radiusY);
-					}
-					cairo_matrix_t matrix;
-					cairo_get_matrix (handle, &matrix);
-					cairo_translate (handle, centerX, centerY);
-					cairo_scale (handle, radiusX, radiusY);
-					if (e.instruction.arc.clockwise)
-					{
-						cairo_arc (handle, 0, 0, 1, startAngle, endAngle);
-					}
-					else
-					{
-						cairo_arc_negative (handle, 0, 0, 1, startAngle, endAngle);
-					}
-					cairo_set_matrix (handle, &matrix);
-					break;
+					cairo_arc_negative (handle, 0, 0, 1, startAngle, endAngle);
 				}
+				cairo_set_matrix (handle, &matrix);
+				break;
 			}
 		}
-		path = cairo_copy_path (handle);
-		cairo_new_path (handle); // clear path
 	}
-	return path;
 }
 
 //------------------------------------------------------------------------
@@ -5,7 +5,9 @@
 #pragma once
 
 #include "../../cgraphicspath.h"
+#include "../../cgraphicstransform.h"
 #include "cairoutils.h"
+#include <vector>
 
 //------------------------------------------------------------------------
 namespace VSTGUI {
@@ -31,10 +33,30 @@ public:
 
 	void dirty () override;
 
+	using Polygon = std::vector<CPoint>;
+	using PolygonList = std::vector<Polygon>;
+
+	/** the flattened geometry of the path, cached until the path changes */
+	struct Geometry
+	{
+		PolygonList polygons;
+		CRect bounds;
+		CPoint currentPosition;
+	};
+	const Geometry& getGeometry ();
+
+	static bool polygonsContain (const PolygonList& polygons, const CPoint& p, bool evenOdd);
+
 //------------------------------------------------------------------------
 private:
+	void addElements (const ContextHandle& handle, const CGraphicsTransform* alignTm) const;
+
 	ContextHandle cr;
 	cairo_path_t* path {nullptr};
+	cairo_path_t* alignedPath {nullptr};
+	CGraphicsTransform alignedPathTransform;
+	Geometry geometry;
+	bool geometryValid {false};
 };
 
 //------------------------------------------------------------------------
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "../../crect.h"
 #include <cairo/cairo.h>
 #include <utility>
 
@@ -76,6 +77,60 @@ using ScaledFontHandle = Handle<cairo_scaled_font_t*, decltype (&cairo_scaled_fo
 								cairo_scaled_font_reference, decltype (&cairo_scaled_font_destroy),
 								cairo_scaled_font_destroy>;
 
+//-----------------------------------------------------------------------------
+/** move the pixels of src inside the surface by distance */
+inline void scrollSurface (cairo_surface_t* surface, const CRect& src, const CPoint& distance)
+{
+	CRect dest (src);
+	dest.offset (distance.x, distance.y);
+	ContextHandle context (cairo_create (surface));
+	cairo_rectangle (context, dest.left, dest.top, dest.getWidth (), dest.getHeight ());
+	cairo_clip (context);
+	// source and destination overlap, so copy via an intermediate group surface
+	cairo_push_group (context);
+	cairo_set_source_surface (context, surface, distance.x, distance.y);
+	cairo_paint (context);
+	cairo_pop_group_to_source (context);
+	cairo_set_operator (context, CAIRO_OPERATOR_SOURCE);
+	cairo_paint (context);
+	cairo_surface_flush (surface);
+}
+
+//-----------------------------------------------------------------------------
+/** add the rects which need a redraw after src was scrolled by distance to dirtyRects.
+ *
+ *	These are the strip exposed by the scroll and the parts of not yet drawn dirty rects which
+ *	were moved with the scrolled pixels.
+ */
+template<typename RectList>
+inline void addScrollDirtyRects (RectList& dirtyRects, const CRect& src, const CPoint& distance)
+{
+	CRect dest (src);
+	dest.offset (distance.x, distance.y);
+	auto numDirtyRects = dirtyRects.size ();
+	for (auto i = 0u; i < numDirtyRects; ++i)
+	{
+		CRect r (dirtyRects[i]);
+		r.bound (src);
+		if (r.isEmpty ())
+			continue;
+		r.offset (distance.x, distance.y);
+		r.bound (dest);
+		if (!r.isEmpty ())
+			dirtyRects.push_back (r);
+	}
+	CRect strip (src);
+	if (distance.x > 0)
+		dirtyRects.push_back (strip.setWidth (distance.x));
+	else if (distance.x < 0)
+		dirtyRects.push_back (strip.setWidth (-distance.x).offset (src.getWidth () + distance.x, 0));
+	strip = src;
+	if (distance.y > 0)
+		dirtyRects.push_back (strip.setHeight (distance.y));
+	else if (distance.y < 0)
+		dirtyRects.push_back (strip.setHeight (-distance.y).offset (0, src.getHeight () + distance.y));
+}
+
 //-----------------------------------------------------------------------------
 } // Cairo
 } // VSTGUI
@@ -3,6 +3,7 @@
 // distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
 
 #include "x11frame.h"
+#include "x11headlessframe.h"
 #include "../../cbuttonstate.h"
 #include "../../cframe.h"
 #include "../../crect.h"
@@ -13,6 +14,7 @@
 #include "../iplatformtextedit.h"
 #include "../iplatformoptionmenu.h"
 #include "../common/fileresourceinputstream.h"
+#include "../common/mappedfileresourceinputstream.h"
 #include "../common/generictextedit.h"
 #include "../common/genericoptionmenu.h"
 #include "cairobitmap.h"
@@ -143,7 +145,8 @@ struct DrawHandler
 	template<typename RectList, typename Proc>
 	void draw (const RectList& dirtyRects, Proc proc)
 	{
-		CRect copyRect;
+		CRect copyRect (scrolledRect);
+		scrolledRect = {};
 		drawContext->beginDraw ();
 		for (auto rect : dirtyRects)
 		{
@@ -161,10 +164,23 @@ struct DrawHandler
 		xcb_flush (RunLoop::instance ().getXcbConnection ());
 	}
 
+	void scroll (const CRect& src, const CPoint& distance)
+	{
+		Cairo::scrollSurface (backBuffer, src, distance);
+		CRect dest (src);
+		dest.offset (distance.x, distance.y);
+		// the moved pixels are copied to the window with the next draw
+		if (scrolledRect.isEmpty ())
+			scrolledRect = dest;
+		else
+			scrolledRect.unite (dest);
+	}
+
 private:
 	Cairo::SurfaceHandle windowSurface;
 	Cairo::SurfaceHandle backBuffer;
 	SharedPointer<Cairo::Context> drawContext;
+	CRect scrolledRect;
 
 	void blitBackbufferToWindow (const CRect& rect)
 	{
@@ -315,6 +331,12 @@ struct Frame::Impl : IFrameEventHandler
 	void invalidRect (CRect r)
 	{
 		dirtyRects.emplace_back (r);
+		startRedrawTimer ();
+	}
+
+	//------------------------------------------------------------------------
+	void startRedrawTimer ()
+	{
 		if (redrawTimer)
 			return;
 		redrawTimer = makeOwned<RedrawTimerHandler> (16, [this]() {
@@ -324,6 +346,14 @@ struct Frame::Impl : IFrameEventHandler
 		});
 	}
 
+	//------------------------------------------------------------------------
+	void scrollRect (const CRect& src, const CPoint& distance)
+	{
+		drawHandler.scroll (src, distance);
+		Cairo::addScrollDirtyRects (dirtyRects, src, distance);
+		startRedrawTimer ();
+	}
+
 	//------------------------------------------------------------------------
 	void grabPointer ()
 	{
@@ -642,9 +672,10 @@ bool Frame::invalidRect (const CRect& rect)
 //------------------------------------------------------------------------
 bool Frame::scrollRect (const CRect& src, const CPoint& distance)
 {
-	(void)src;
-	(void)distance;
-	return false;
+	if (src.isEmpty () || (distance.x == 0 && distance.y == 0))
+		return false;
+	impl->scrollRect (src, distance);
+	return true;
 }
 
 //------------------------------------------------------------------------
@@ -766,6 +797,8 @@ Frame::CreateIResourceInputStreamFunc Frame::createResourceInputStreamFunc =
 	auto path = Platform::getInstance ().getPath ();
 	path += "/Contents/Resources/";
 	path += desc.u.name;
+	if (auto stream = MappedFileResourceInputStream::create (path))
+		return stream;
 	return FileResourceInputStream::create (path);
 };
 
@@ -781,8 +814,18 @@ IPlatformFrame* IPlatformFrame::createPlatformFrame (IPlatformFrameCallback* fra
 													 PlatformType parentType,
 													 IPlatformFrameConfig* config)
 {
+	if (parentType == kHeadless)
+	{
+		auto headlessConfig = dynamic_cast<X11::HeadlessFrameConfig*> (config);
+		if (!X11::RunLoop::accepts (headlessConfig ? headlessConfig->runLoop : nullptr, false))
+			return nullptr;
+		return new X11::HeadlessFrame (frame, size, headlessConfig);
+	}
 	if (parentType == kDefaultNative || parentType == kX11EmbedWindowID)
 	{
+		auto cfg = dynamic_cast<X11::FrameConfig*> (config);
+		if (cfg && !X11::RunLoop::accepts (cfg->runLoop, true))
+			return nullptr;
 		auto x11Parent = reinterpret_cast<XID> (parent);
 		return new X11::Frame (frame, size, x11Parent, config);
 	}
@@ -0,0 +1,407 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "x11headlessframe.h"
+#include "../../cframe.h"
+#include "../../dragging.h"
+#include "../iplatformopenglview.h"
+#include "../iplatformviewlayer.h"
+#include "../iplatformtextedit.h"
+#include "../iplatformoptionmenu.h"
+#include "../common/generictextedit.h"
+#include "../common/genericoptionmenu.h"
+#include "cairobitmap.h"
+#include "cairocontext.h"
+#include "x11platform.h"
+#include <algorithm>
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+namespace X11 {
+namespace {
+
+//------------------------------------------------------------------------
+inline bool rectContains (const CRect& outer, const CRect& inner)
+{
+	CRect r (outer);
+	return r.bound (inner) == inner;
+}
+
+//------------------------------------------------------------------------
+} // anonymous
+
+//------------------------------------------------------------------------
+bool HeadlessRunLoop::registerEventHandler (int fd, IEventHandler* handler)
+{
+	return false;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessRunLoop::unregisterEventHandler (IEventHandler* handler)
+{
+	return false;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessRunLoop::registerTimer (uint64_t interval, ITimerHandler* handler)
+{
+	auto it = std::find_if (timers.begin (), timers.end (),
+							[&] (const Timer& timer) { return timer.handler == handler; });
+	if (it != timers.end ())
+		return false;
+	timers.push_back ({handler, interval, currentTime + interval});
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessRunLoop::unregisterTimer (ITimerHandler* handler)
+{
+	auto it = std::find_if (timers.begin (), timers.end (),
+							[&] (const Timer& timer) { return timer.handler == handler; });
+	if (it == timers.end ())
+		return false;
+	timers.erase (it);
+	return true;
+}
+
+//------------------------------------------------------------------------
+uint32_t HeadlessRunLoop::processTimers (uint64_t elapsedMs)
+{
+	currentTime += elapsedMs;
+	// timers may register or unregister timers when they fire
+	std::vector<ITimerHandler*> dueTimers;
+	for (auto& timer : timers)
+	{
+		if (timer.nextFireTime > currentTime)
+			continue;
+		timer.nextFireTime = currentTime + timer.interval;
+		dueTimers.push_back (timer.handler);
+	}
+	uint32_t numFired = 0;
+	for (auto handler : dueTimers)
+	{
+		auto isRegistered =
+			std::any_of (timers.begin (), timers.end (),
+						 [&] (const Timer& timer) { return timer.handler == handler; });
+		if (!isRegistered)
+			continue;
+		handler->onTimer ();
+		++numFired;
+	}
+	return numFired;
+}
+
+//------------------------------------------------------------------------
+struct HeadlessFrame::Impl
+{
+	IPlatformFrameCallback* frame;
+	CRect size;
+	Cairo::SurfaceHandle surface;
+	SharedPointer<Cairo::Context> drawContext;
+	RectList dirtyRects;
+	RectList renderedRects;
+	SharedPointer<IDataPackage> clipboard;
+	CPoint mousePosition;
+	CButtonState mouseButtons;
+
+	//------------------------------------------------------------------------
+	Impl (IPlatformFrameCallback* frame, const CRect& inSize) : frame (frame), size (inSize)
+	{
+		createSurface ();
+	}
+
+	//------------------------------------------------------------------------
+	void createSurface ()
+	{
+		surface = Cairo::SurfaceHandle (cairo_image_surface_create (
+			CAIRO_FORMAT_ARGB32, static_cast<int> (size.getWidth ()),
+			static_cast<int> (size.getHeight ())));
+		CRect r;
+		r.setSize (size.getSize ());
+		drawContext = makeOwned<Cairo::Context> (r, surface);
+		dirtyRects.clear ();
+		dirtyRects.push_back (r);
+	}
+
+	//------------------------------------------------------------------------
+	void invalidRect (CRect r)
+	{
+		CRect bounds;
+		bounds.setSize (size.getSize ());
+		r.bound (bounds);
+		if (r.isEmpty ())
+			return;
+		for (auto it = dirtyRects.begin (); it != dirtyRects.end ();)
+		{
+			if (rectContains (*it, r))
+				return;
+			if (rectContains (r, *it))
+				it = dirtyRects.erase (it);
+			else
+				++it;
+		}
+		dirtyRects.push_back (r);
+	}
+
+	//------------------------------------------------------------------------
+	const RectList& render ()
+	{
+		renderedRects.clear ();
+		std::swap (renderedRects, dirtyRects);
+		if (renderedRects.empty ())
+			return renderedRects;
+		drawContext->beginDraw ();
+		for (const auto& rect : renderedRects)
+		{
+			drawContext->setClipRect (rect);
+			drawContext->saveGlobalState ();
+			frame->platformDrawRect (drawContext, rect);
+			drawContext->restoreGlobalState ();
+		}
+		drawContext->endDraw ();
+		cairo_surface_flush (surface);
+		return renderedRects;
+	}
+};
+
+//------------------------------------------------------------------------
+HeadlessFrame::HeadlessFrame (IPlatformFrameCallback* frame,
+							  const CRect& size,
+							  HeadlessFrameConfig* config)
+	: IPlatformFrame (frame)
+{
+	SharedPointer<IRunLoop> runLoop = config ? config->runLoop : nullptr;
+	// without a run loop of the config or an open frame, timers can be started but never fire
+	if (!runLoop && !RunLoop::get ())
+		runLoop = makeOwned<HeadlessRunLoop> ();
+	RunLoop::init (runLoop, false);
+	impl = std::unique_ptr<Impl> (new Impl (frame, size));
+
+	frame->platformOnActivate (true);
+}
+
+//------------------------------------------------------------------------
+HeadlessFrame::~HeadlessFrame ()
+{
+	impl.reset ();
+	RunLoop::exit ();
+}
+
+//------------------------------------------------------------------------
+auto HeadlessFrame::renderFrame () -> const RectList&
+{
+	return impl->render ();
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::needsRender () const
+{
+	return !impl->dirtyRects.empty ();
+}
+
+//------------------------------------------------------------------------
+void* HeadlessFrame::getCairoSurface () const
+{
+	return impl->surface;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::writeToPNG (UTF8StringPtr path) const
+{
+	return cairo_surface_write_to_png (impl->surface, path) == CAIRO_STATUS_SUCCESS;
+}
+
+//------------------------------------------------------------------------
+CMouseEventResult HeadlessFrame::onMouseDown (CPoint where, const CButtonState& buttons)
+{
+	impl->mousePosition = where;
+	impl->mouseButtons = buttons;
+	return frame->platformOnMouseDown (where, buttons);
+}
+
+//------------------------------------------------------------------------
+CMouseEventResult HeadlessFrame::onMouseMoved (CPoint where, const CButtonState& buttons)
+{
+	impl->mousePosition = where;
+	impl->mouseButtons = buttons;
+	return frame->platformOnMouseMoved (where, buttons);
+}
+
+//------------------------------------------------------------------------
+CMouseEventResult HeadlessFrame::onMouseUp (CPoint where, const CButtonState& buttons)
+{
+	impl->mousePosition = where;
+	impl->mouseButtons = 0;
+	return frame->platformOnMouseUp (where, buttons);
+}
+
+//------------------------------------------------------------------------
+void HeadlessFrame::onMouseExited ()
+{
+	CPoint where (impl->mousePosition);
+	frame->platformOnMouseExited (where, impl->mouseButtons);
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::getGlobalPosition (CPoint& pos) const
+{
+	return false;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::setSize (const CRect& newSize)
+{
+	impl->size = newSize;
+	impl->createSurface ();
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::getSize (CRect& size) const
+{
+	size = impl->size;
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::getCurrentMousePosition (CPoint& mousePosition) const
+{
+	mousePosition = impl->mousePosition;
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::getCurrentMouseButtons (CButtonState& buttons) const
+{
+	buttons = impl->mouseButtons;
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::setMouseCursor (CCursorType type)
+{
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::invalidRect (const CRect& rect)
+{
+	impl->invalidRect (rect);
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::scrollRect (const CRect& src, const CPoint& distance)
+{
+	if (src.isEmpty () || (distance.x == 0 && distance.y == 0))
+		return false;
+	Cairo::scrollSurface (impl->surface, src, distance);
+	Cairo::addScrollDirtyRects (impl->dirtyRects, src, distance);
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::showTooltip (const CRect& rect, const char* utf8Text)
+{
+	return false;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::hideTooltip ()
+{
+	return false;
+}
+
+//------------------------------------------------------------------------
+void* HeadlessFrame::getPlatformRepresentation () const
+{
+	return nullptr;
+}
+
+//------------------------------------------------------------------------
+SharedPointer<IPlatformTextEdit> HeadlessFrame::createPlatformTextEdit (
+	IPlatformTextEditCallback* textEdit)
+{
+	return makeOwned<GenericTextEdit> (textEdit);
+}
+
+//------------------------------------------------------------------------
+SharedPointer<IPlatformOptionMenu> HeadlessFrame::createPlatformOptionMenu ()
+{
+	return makeOwned<GenericOptionMenu> (dynamic_cast<CFrame*> (frame), 0);
+}
+
+#if VSTGUI_OPENGL_SUPPORT
+//------------------------------------------------------------------------
+SharedPointer<IPlatformOpenGLView> HeadlessFrame::createPlatformOpenGLView ()
+{
+	return nullptr;
+}
+#endif
+
+//------------------------------------------------------------------------
+SharedPointer<IPlatformViewLayer> HeadlessFrame::createPlatformViewLayer (
+	IPlatformViewLayerDelegate* drawDelegate, IPlatformViewLayer* parentLayer)
+{
+	// optional
+	return nullptr;
+}
+
+//------------------------------------------------------------------------
+SharedPointer<COffscreenContext> HeadlessFrame::createOffscreenContext (CCoord width,
+																		CCoord height,
+																		double scaleFactor)
+{
+	CPoint size (width * scaleFactor, height * scaleFactor);
+	auto bitmap = new Cairo::Bitmap (&size);
+	bitmap->setScaleFactor (scaleFactor);
+	auto context = owned (new Cairo::Context (bitmap));
+	bitmap->forget ();
+	if (context->valid ())
+		return context;
+	return nullptr;
+}
+
+#if VSTGUI_ENABLE_DEPRECATED_METHODS
+//------------------------------------------------------------------------
+DragResult HeadlessFrame::doDrag (IDataPackage* source, const CPoint& offset, CBitmap* dragBitmap)
+{
+	return kDragError;
+}
+#endif
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::doDrag (const DragDescription& dragDescription,
+							const SharedPointer<IDragCallback>& callback)
+{
+	return false;
+}
+
+//------------------------------------------------------------------------
+void HeadlessFrame::setClipboard (const SharedPointer<IDataPackage>& data)
+{
+	impl->clipboard = data;
+}
+
+//------------------------------------------------------------------------
+SharedPointer<IDataPackage> HeadlessFrame::getClipboard ()
+{
+	return impl->clipboard;
+}
+
+//------------------------------------------------------------------------
+PlatformType HeadlessFrame::getPlatformType () const
+{
+	return kDefaultNative;
+}
+
+//------------------------------------------------------------------------
+Optional<UTF8String> HeadlessFrame::convertCurrentKeyEventToText ()
+{
+	return {};
+}
+
+//------------------------------------------------------------------------
+} // X11
+} // VSTGUI
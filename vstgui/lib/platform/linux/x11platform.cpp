@@ -185,9 +185,24 @@ struct RunLoop::Impl : IEventHandler
 	VstKeyCode lastUnprocessedKeyEvent;
 	uint32_t lastUtf32KeyEventChar{0};
 
-	void init (const SharedPointer<IRunLoop>& inRunLoop)
+	bool accepts (const SharedPointer<IRunLoop>& inRunLoop, bool connectToServer) const
 	{
-		if (++useCount != 1)
+		if (!runLoop || !inRunLoop || runLoop == inRunLoop)
+			return true;
+		return connectToServer && xcbConnection;
+	}
+
+	void init (const SharedPointer<IRunLoop>& inRunLoop, bool connectToServer)
+	{
+		vstgui_assert (accepts (inRunLoop, connectToServer));
+		++useCount;
+		if (!connectToServer)
+		{
+			if (!runLoop)
+				runLoop = inRunLoop;
+			return;
+		}
+		if (xcbConnection)
 			return;
 		runLoop = inRunLoop;
 		int screenNo;
@@ -235,8 +250,15 @@ struct RunLoop::Impl : IEventHandler
 			}
 
 			xcb_disconnect (xcbConnection);
+			xcbConnection = nullptr;
+			cursorContext = nullptr;
+			cursors.fill (XCB_CURSOR_NONE);
+			xkbContext = nullptr;
+			xkbState = nullptr;
+			xkbUnprocessedState = nullptr;
+			xkbKeymap = nullptr;
+			runLoop->unregisterEventHandler (this);
 		}
-		runLoop->unregisterEventHandler (this);
 		runLoop = nullptr;
 	}
 
@@ -385,9 +407,15 @@ RunLoop& RunLoop::instance ()
 }
 
 //------------------------------------------------------------------------
-void RunLoop::init (const SharedPointer<IRunLoop>& runLoop)
+void RunLoop::init (const SharedPointer<IRunLoop>& runLoop, bool connectToServer)
+{
+	instance ().impl->init (runLoop, connectToServer);
+}
+
+//------------------------------------------------------------------------
+bool RunLoop::accepts (const SharedPointer<IRunLoop>& runLoop, bool connectToServer)
 {
-	instance ().impl->init (runLoop);
+	return instance ().impl->accepts (runLoop, connectToServer);
 }
 
 //------------------------------------------------------------------------
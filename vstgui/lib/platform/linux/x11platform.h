@@ -65,7 +65,15 @@ private:
 //------------------------------------------------------------------------
 struct RunLoop
 {
-	static void init (const SharedPointer<IRunLoop>& runLoop);
+	/** connectToServer is false for headless frames, which only need the run loop for timers */
+	static void init (const SharedPointer<IRunLoop>& runLoop, bool connectToServer = true);
+	/** check if a frame with the run loop can be opened
+	 *
+	 *	All timers use one run loop. A headless frame with another run loop than the open frames
+	 *	and a window opened while only headless frames with another run loop are open are refused,
+	 *	as their timers would never fire. Windows share the run loop of the first window.
+	 */
+	static bool accepts (const SharedPointer<IRunLoop>& runLoop, bool connectToServer);
 	static void exit ();
 	static const SharedPointer<IRunLoop> get ();
 
@@ -30,6 +30,8 @@ namespace VSTGUI {
 //-----------------------------------------------------------------------------
 IPlatformFrame* IPlatformFrame::createPlatformFrame (IPlatformFrameCallback* frame, const CRect& size, void* parent, PlatformType parentType, IPlatformFrameConfig* config)
 {
+	if (parentType == kHeadless)
+		return nullptr;
 	return new HIViewFrame (frame, size, (WindowRef)parent);
 }
 
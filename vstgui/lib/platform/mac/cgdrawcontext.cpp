@@ -562,7 +562,11 @@ void CGDrawContext::fillRectWithBitmap (CBitmap* bitmap, const CRect& srcRect, c
 
 	auto platformBitmap = bitmap->getBestPlatformBitmapForScaleFactor (scaleFactor);
 	if (!platformBitmap)
+	{
+		// bitmaps without own pixels like CAtlasBitmap are drawn part by part
+		CDrawContext::fillRectWithBitmap (bitmap, srcRect, dstRect, alpha);
 		return;
+	}
 	CPoint bitmapSize = platformBitmap->getSize ();
 	if (srcRect.right > bitmapSize.x || srcRect.bottom > bitmapSize.y)
 		return;
@@ -602,7 +606,12 @@ void CGDrawContext::drawBitmap (CBitmap* bitmap, const CRect& inRect, const CPoi
 		transformedScaleFactor *= t.m11;
 	auto platformBitmap = bitmap->getBestPlatformBitmapForScaleFactor (transformedScaleFactor);
 	if (!platformBitmap)
+	{
+		// bitmaps without own pixels like CAtlasBitmap know how to draw themselves
+		if (auto atlasBitmap = dynamic_cast<CAtlasBitmap*> (bitmap))
+			atlasBitmap->draw (this, inRect, inOffset, alpha);
 		return;
+	}
 	auto cgBitmap = platformBitmap.cast<CGBitmap> ();
 	if (CGImageRef image = cgBitmap ? cgBitmap->getCGImage () : nullptr)
 	{
@@ -1326,6 +1326,8 @@ void* NSViewFrame::makeTouchBar () const
 //-----------------------------------------------------------------------------
 IPlatformFrame* IPlatformFrame::createPlatformFrame (IPlatformFrameCallback* frame, const CRect& size, void* parent, PlatformType platformType, IPlatformFrameConfig* config)
 {
+	if (platformType == kHeadless)
+		return nullptr;
 	#if MAC_CARBON
 	if (platformType == kWindowRef || platformType == kDefaultNative)
 		return new HIViewFrame (frame, size, reinterpret_cast<WindowRef> (parent));
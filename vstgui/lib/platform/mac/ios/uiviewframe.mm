@@ -198,6 +198,8 @@ IPlatformFrame* IPlatformFrame::createPlatformFrame (IPlatformFrameCallback* fra
                                                      PlatformType platformType,
                                                      IPlatformFrameConfig* config)
 {
+	if (platformType == kHeadless)
+		return nullptr;
 	return new UIViewFrame (frame, size, (__bridge UIView*)parent);
 }
 
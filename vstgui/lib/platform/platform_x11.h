@@ -5,6 +5,9 @@
 #pragma once
 
 #include "iplatformframe.h"
+#include "../cbuttonstate.h"
+#include "../crect.h"
+#include <vector>
 
 //------------------------------------------------------------------------
 namespace VSTGUI {
@@ -49,6 +52,86 @@ public:
 	virtual uint32_t getX11WindowID () const = 0;
 };
 
+//------------------------------------------------------------------------
+/** Run loop for headless frames which is driven by the caller
+ *
+ *	Timers only fire when processTimers is called, event handlers are never called.
+ */
+class HeadlessRunLoop
+	: public IRunLoop
+	, public AtomicReferenceCounted
+{
+public:
+	bool registerEventHandler (int fd, IEventHandler* handler) override;
+	bool unregisterEventHandler (IEventHandler* handler) override;
+
+	bool registerTimer (uint64_t interval, ITimerHandler* handler) override;
+	bool unregisterTimer (ITimerHandler* handler) override;
+
+	/** advance the time of the run loop and fire every timer whose interval elapsed
+	 *
+	 *	A timer fires at most once per call, even if its interval elapsed more than once.
+	 *	@return the number of fired timers
+	 */
+	uint32_t processTimers (uint64_t elapsedMs);
+
+private:
+	struct Timer
+	{
+		ITimerHandler* handler;
+		uint64_t interval;
+		uint64_t nextFireTime;
+	};
+	std::vector<Timer> timers;
+	uint64_t currentTime {0};
+};
+
+//------------------------------------------------------------------------
+/** Config to open a CFrame without a window
+ *
+ *	A frame opened with frame->open (nullptr, kHeadless, &config) is rendered into an offscreen
+ *	image and only drawn when IHeadlessFrame::renderFrame is called. The config is optional.
+ *
+ *	The frame does not connect to the X server. Timers (and with them idle views and animations)
+ *	use the run loop of this config. If it is not set they use the run loop of the open frames,
+ *	without open frames they can be started but never fire. To drive them set a HeadlessRunLoop
+ *	and call HeadlessRunLoop::processTimers. All frames use one run loop for their timers, so
+ *	CFrame::open fails for a headless frame with another run loop than the open frames and for a
+ *	window while headless frames with another run loop are open.
+ */
+class HeadlessFrameConfig : public IPlatformFrameConfig
+{
+public:
+	SharedPointer<IRunLoop> runLoop;
+};
+
+//------------------------------------------------------------------------
+/** Extension of the platform frame of a CFrame opened with a HeadlessFrameConfig
+ *
+ *	Get it via dynamic_cast<IHeadlessFrame*> (frame->getPlatformFrame ())
+ */
+class IHeadlessFrame
+{
+public:
+	using RectList = std::vector<CRect>;
+
+	/** draw all invalidated rects into the image and return them */
+	virtual const RectList& renderFrame () = 0;
+	/** returns true if there are invalidated rects which will be drawn on the next renderFrame */
+	virtual bool needsRender () const = 0;
+
+	/** returns the image surface as cairo_surface_t* */
+	virtual void* getCairoSurface () const = 0;
+	/** write the image to a png file */
+	virtual bool writeToPNG (UTF8StringPtr path) const = 0;
+
+	/** inject mouse events */
+	virtual CMouseEventResult onMouseDown (CPoint where, const CButtonState& buttons) = 0;
+	virtual CMouseEventResult onMouseMoved (CPoint where, const CButtonState& buttons) = 0;
+	virtual CMouseEventResult onMouseUp (CPoint where, const CButtonState& buttons) = 0;
+	virtual void onMouseExited () = 0;
+};
+
 //------------------------------------------------------------------------
 } // X11
 } // VSTGUI
@@ -7,6 +7,7 @@
 #if WINDOWS
 
 #include "../win32support.h"
+#include "../../../cbitmap.h"
 #include "../../../cgradient.h"
 #include "d2dbitmap.h"
 #include "d2dgraphicspath.h"
@@ -393,17 +394,25 @@ void D2DDrawContext::drawBitmap (CBitmap* bitmap, const CRect& dest, const CPoin
 {
 	if (renderTarget == nullptr)
 		return;
-	ConcatClip concatClip (*this, dest);
-	D2DApplyClip ac (this);
-	if (ac.isEmpty ())
-		return;
-	
 	double transformedScaleFactor = getScaleFactor ();
 	CGraphicsTransform t = getCurrentTransform ();
 	if (t.m11 == t.m22 && t.m12 == 0 && t.m21 == 0)
 		transformedScaleFactor *= t.m11;
 	IPlatformBitmap* platformBitmap = bitmap->getBestPlatformBitmapForScaleFactor (transformedScaleFactor);
-	D2DBitmap* d2dBitmap = platformBitmap ? dynamic_cast<D2DBitmap*> (platformBitmap) : nullptr;
+	if (!platformBitmap)
+	{
+		// bitmaps without own pixels like CAtlasBitmap know how to draw themselves
+		if (auto atlasBitmap = dynamic_cast<CAtlasBitmap*> (bitmap))
+			atlasBitmap->draw (this, dest, offset, alpha);
+		return;
+	}
+
+	ConcatClip concatClip (*this, dest);
+	D2DApplyClip ac (this);
+	if (ac.isEmpty ())
+		return;
+	
+	D2DBitmap* d2dBitmap = dynamic_cast<D2DBitmap*> (platformBitmap);
 	if (d2dBitmap)
 	{
 		if (d2dBitmap->getSource ())
@@ -40,6 +40,8 @@ static bool bSwapped_mouse_buttons = false;
 //-----------------------------------------------------------------------------
 IPlatformFrame* IPlatformFrame::createPlatformFrame (IPlatformFrameCallback* frame, const CRect& size, void* parent, PlatformType parentType, IPlatformFrameConfig* config)
 {
+	if (parentType == kHeadless)
+		return nullptr;
 	return new Win32Frame (frame, size, (HWND)parent, parentType);
 }
 
@@ -163,9 +163,12 @@ class ITouchEvent;
 // classes
 class CBitmap;
 class CNinePartTiledBitmap;
+class CAtlasBitmap;
+class CBitmapCache;
 class CResourceDescription;
 class CLineStyle;
 class CDrawContext;
+class CDisplayList;
 class COffscreenContext;
 class CDropSource;
 class CFileExtension;
@@ -210,6 +213,8 @@ class CControl;
 class CFontChooser;
 class CKnob;
 class CAnimKnob;
+class CLevelMeter;
+class LevelMeterModel;
 class CMovieBitmap;
 class CMovieButton;
 class COptionMenu;
@@ -0,0 +1,148 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/cdatabrowser.h"
+#include "vstgui/lib/cdrawcontext.h"
+#include "vstgui/lib/cframe.h"
+#include "vstgui/lib/idatabrowserdelegate.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+#if MAC
+#include <CoreFoundation/CoreFoundation.h>
+namespace VSTGUI { void* gBundleRef = CFBundleGetMainBundle (); }
+#elif WINDOWS
+#include <windows.h>
+void* hInstance = nullptr;
+#elif LINUX
+namespace VSTGUI { void* soHandle = nullptr; }
+#endif
+
+using namespace VSTGUI;
+
+static constexpr auto numColumns = 4;
+static constexpr auto numFrames = 1000;
+static constexpr auto numLookups = 1000000;
+
+//------------------------------------------------------------------------
+class Delegate : public DataBrowserDelegateAdapter
+{
+public:
+	Delegate (int32_t numRows) : numRows (numRows) {}
+
+	int32_t dbGetNumRows (CDataBrowser* browser) override { return numRows; }
+	int32_t dbGetNumColumns (CDataBrowser* browser) override { return numColumns; }
+	CCoord dbGetRowHeight (CDataBrowser* browser) override { return 18; }
+	CCoord dbGetCurrentColumnWidth (int32_t index, CDataBrowser* browser) override { return 100; }
+	bool dbGetLineWidthAndColor (CCoord& width, CColor& color, CDataBrowser* browser) override
+	{
+		width = 1;
+		color = kGreyCColor;
+		return true;
+	}
+	void dbDrawCell (CDrawContext* context, const CRect& size, int32_t row, int32_t column,
+	                 int32_t flags, CDataBrowser* browser) override
+	{
+		++drawnCells;
+	}
+
+	int32_t numRows;
+	uint64_t drawnCells {0};
+};
+
+//------------------------------------------------------------------------
+class NoDrawContext : public CDrawContext
+{
+public:
+	NoDrawContext (const CRect& r) : CDrawContext (r) { setClipRect (r); }
+
+	void drawLine (const LinePair& line) override {}
+	void drawLines (const LineList& lines) override {}
+	void drawPolygon (const PointList& polygonPointList, const CDrawStyle drawStyle) override {}
+	void drawRect (const CRect& rect, const CDrawStyle drawStyle) override {}
+	void drawArc (const CRect& rect, const float startAngle1, const float endAngle2, const CDrawStyle drawStyle) override {}
+	void drawEllipse (const CRect& rect, const CDrawStyle drawStyle) override {}
+	void drawPoint (const CPoint& point, const CColor& color) override {}
+	void drawBitmap (CBitmap* bitmap, const CRect& dest, const CPoint& offset, float alpha) override {}
+	void clearRect (const CRect& rect) override {}
+	CGraphicsPath* createGraphicsPath () override { return nullptr; }
+	CGraphicsPath* createTextPath (const CFontRef font, UTF8StringPtr text) override { return nullptr; }
+	void drawGraphicsPath (CGraphicsPath* path, PathDrawMode mode, CGraphicsTransform* transformation) override {}
+	void fillLinearGradient (CGraphicsPath* path, const CGradient& gradient, const CPoint& startPoint, const CPoint& endPoint, bool evenOdd, CGraphicsTransform* transformation) override {}
+	void fillRadialGradient (CGraphicsPath* path, const CGradient& gradient, const CPoint& center, CCoord radius, const CPoint& originOffset, bool evenOdd, CGraphicsTransform* transformation) override {}
+};
+
+//------------------------------------------------------------------------
+using Clock = std::chrono::high_resolution_clock;
+
+template<typename Proc>
+static double measureMs (Proc proc)
+{
+	auto start = Clock::now ();
+	proc ();
+	return std::chrono::duration<double, std::milli> (Clock::now () - start).count ();
+}
+
+//------------------------------------------------------------------------
+static void runBenchmark (int32_t numRows)
+{
+	Delegate delegate (numRows);
+	CRect size (0, 0, 400, 600);
+	auto frame = new CFrame (size, nullptr);
+	auto browser = new CDataBrowser (size, &delegate,
+	                                 CDataBrowser::kDrawRowLines | CDataBrowser::kDrawColumnLines |
+	                                     CDataBrowser::kMultiSelectionStyle |
+	                                     CScrollView::kVerticalScrollbar,
+	                                 16);
+	frame->addView (browser);
+	frame->attached (frame);
+
+	auto context = owned (new NoDrawContext (size));
+	std::default_random_engine engine;
+	std::uniform_int_distribution<int32_t> randomRow (0, numRows - 1);
+
+	delegate.drawnCells = 0;
+	auto drawTime = measureMs ([&] () {
+		for (auto i = 0; i < numFrames; ++i)
+		{
+			browser->makeRowVisible (randomRow (engine));
+			browser->drawRect (context, size);
+		}
+	});
+
+	auto selectAllTime = measureMs ([&] () { browser->selectRows (0, numRows - 1); });
+	auto unselectTime = measureMs ([&] () {
+		for (auto row = 0; row < numRows; row += 2)
+			browser->unselectRow (row);
+	});
+	volatile uint32_t numSelected = 0;
+	auto lookupTime = measureMs ([&] () {
+		for (auto i = 0; i < numLookups; ++i)
+		{
+			if (browser->isRowSelected (randomRow (engine)))
+				numSelected = numSelected + 1;
+		}
+	});
+	auto unselectAllTime = measureMs ([&] () { browser->unselectAll (); });
+
+	printf ("%d rows\n", numRows);
+	printf ("  draw time per frame: %.4f ms, %.1f cells per frame\n", drawTime / numFrames,
+	        delegate.drawnCells / static_cast<double> (numFrames));
+	printf ("  select all rows: %.4f ms\n", selectAllTime);
+	printf ("  unselect every second row: %.4f ms\n", unselectTime);
+	printf ("  %d random isRowSelected: %.4f ms\n", numLookups, lookupTime);
+	printf ("  unselect all: %.4f ms\n", unselectAllTime);
+
+	frame->close ();
+}
+
+//------------------------------------------------------------------------
+int main ()
+{
+	for (auto numRows : {10000, 100000, 1000000})
+		runBenchmark (numRows);
+	return 0;
+}
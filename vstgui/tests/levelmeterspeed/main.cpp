@@ -0,0 +1,111 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/cframe.h"
+#include "vstgui/lib/controls/clevelmeter.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#if MAC
+#include <CoreFoundation/CoreFoundation.h>
+namespace VSTGUI { void* gBundleRef = CFBundleGetMainBundle (); }
+#elif WINDOWS
+#include <windows.h>
+void* hInstance = nullptr;
+#elif LINUX
+namespace VSTGUI { void* soHandle = nullptr; }
+#endif
+
+using namespace VSTGUI;
+
+static constexpr auto numMeters = 128;
+static constexpr auto numSegments = 40;
+static constexpr auto meterWidth = 8;
+static constexpr auto meterHeight = 200;
+static constexpr auto frameRate = 60;
+static constexpr auto numSeconds = 60;
+
+//------------------------------------------------------------------------
+class InvalidRectCounter : public CViewContainer
+{
+public:
+	InvalidRectCounter (const CRect& size) : CViewContainer (size) {}
+
+	void invalidRect (const CRect& rect) override { rects.push_back (rect); }
+
+	std::vector<CRect> rects;
+};
+
+//------------------------------------------------------------------------
+int main ()
+{
+	CRect frameSize (0, 0, numMeters * meterWidth, meterHeight);
+	auto frame = new CFrame (frameSize, nullptr);
+	auto container = new InvalidRectCounter (frameSize);
+	std::vector<CLevelMeter*> meters;
+	for (auto i = 0; i < numMeters; ++i)
+	{
+		CRect r (0, 0, meterWidth, meterHeight);
+		r.offset (i * meterWidth, 0);
+		auto meter = new CLevelMeter (r, numSegments, CLevelMeter::kVertical | CLevelMeter::kShowPeak | CLevelMeter::kShowRMS | CLevelMeter::kShowHold);
+		container->addView (meter);
+		meters.push_back (meter);
+	}
+	frame->addView (container);
+	frame->attached (frame);
+
+	std::default_random_engine engine;
+	std::uniform_real_distribution<float> noise (-0.1f, 0.1f);
+	std::uniform_real_distribution<float> phase (0.f, 6.2832f);
+	std::vector<float> phases;
+	for (auto i = 0; i < numMeters; ++i)
+		phases.push_back (phase (engine));
+
+	double segmentPixels = 0.;
+	double wholeViewPixels = 0.;
+	std::chrono::nanoseconds advanceTime {0};
+	constexpr auto frameDuration = 1000 / frameRate;
+	constexpr auto numFrames = numSeconds * frameRate;
+	for (auto frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+	{
+		auto t = frameIndex / static_cast<float> (frameRate);
+		for (auto i = 0; i < numMeters; ++i)
+		{
+			auto level = 0.5f + 0.4f * std::sin (2.f * t + phases[i]) + noise (engine);
+			meters[i]->setValue (level);
+		}
+		container->rects.clear ();
+		auto start = std::chrono::high_resolution_clock::now ();
+		for (auto& meter : meters)
+			meter->advance (frameDuration);
+		advanceTime += std::chrono::high_resolution_clock::now () - start;
+
+		for (auto& r : container->rects)
+			segmentPixels += r.getWidth () * r.getHeight ();
+		for (auto& meter : meters)
+		{
+			for (auto& r : container->rects)
+			{
+				if (r.rectOverlap (meter->getViewSize ()))
+				{
+					wholeViewPixels += meter->getWidth () * meter->getHeight ();
+					break;
+				}
+			}
+		}
+	}
+
+	auto advanceMs = std::chrono::duration_cast<std::chrono::microseconds> (advanceTime).count () / 1000.;
+	printf ("%d meters, %d segments, %d frames per second\n", numMeters, numSegments, frameRate);
+	printf ("invalidated pixels per second (changed segments): %.0f\n", segmentPixels / numSeconds);
+	printf ("invalidated pixels per second (whole meter)     : %.0f\n", wholeViewPixels / numSeconds);
+	printf ("advance time per frame: %.4f ms\n", advanceMs / numFrames);
+
+	frame->close ();
+	return 0;
+}
@@ -0,0 +1,210 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/dispatchlist.h"
+#include "vstgui/lib/idependency.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#if MAC
+#include <CoreFoundation/CoreFoundation.h>
+namespace VSTGUI { void* gBundleRef = CFBundleGetMainBundle (); }
+#elif WINDOWS
+#include <windows.h>
+void* hInstance = nullptr;
+#elif LINUX
+namespace VSTGUI { void* soHandle = nullptr; }
+#endif
+
+//------------------------------------------------------------------------
+static uint64_t numAllocations = 0;
+
+void* operator new (std::size_t size)
+{
+	++numAllocations;
+	if (auto ptr = std::malloc (size ? size : 1))
+		return ptr;
+	throw std::bad_alloc ();
+}
+
+void operator delete (void* ptr) noexcept { std::free (ptr); }
+void operator delete (void* ptr, std::size_t) noexcept { std::free (ptr); }
+
+using namespace VSTGUI;
+
+static constexpr auto numNotifications = 1000000;
+static constexpr auto numDeferedMessages = 8;
+
+//------------------------------------------------------------------------
+class Dependent : public CBaseObject
+{
+public:
+	CMessageResult notify (CBaseObject* sender, IdStringPtr message) override
+	{
+		++numNotifications;
+		return kMessageNotified;
+	}
+
+	uint64_t numNotifications {0};
+};
+
+//------------------------------------------------------------------------
+class Model : public CBaseObject, public IDependency
+{
+};
+
+//------------------------------------------------------------------------
+struct IListener
+{
+	virtual void onChange (int32_t value) = 0;
+};
+
+//------------------------------------------------------------------------
+struct Listener : IListener
+{
+	void onChange (int32_t value) override { sum += value; }
+
+	int64_t sum {0};
+};
+
+//------------------------------------------------------------------------
+using Clock = std::chrono::high_resolution_clock;
+
+template<typename Proc>
+static double measureMs (Proc proc)
+{
+	auto start = Clock::now ();
+	proc ();
+	return std::chrono::duration<double, std::milli> (Clock::now () - start).count ();
+}
+
+//------------------------------------------------------------------------
+static void printResult (const char* name, uint32_t numObservers, uint64_t notifications,
+                         double timeMs, uint64_t allocations, uint64_t numCalls)
+{
+	printf ("%-22s %2u observers: %8.2f M notifications/s, %.2f allocations per call\n", name,
+	        numObservers, notifications / timeMs / 1000., allocations / static_cast<double> (numCalls));
+}
+
+//------------------------------------------------------------------------
+static void benchmarkChanged (uint32_t numDependents)
+{
+	Model model;
+	std::vector<Dependent> dependents (numDependents);
+	for (auto& dependent : dependents)
+		model.addDependency (&dependent);
+
+	auto numCalls = numNotifications / numDependents;
+	model.changed ("warmup");
+	numAllocations = 0;
+	auto time = measureMs ([&] () {
+		for (auto i = 0u; i < numCalls; ++i)
+			model.changed ("Changed");
+	});
+	printResult ("IDependency::changed", numDependents, numCalls * numDependents, time,
+	             numAllocations, numCalls);
+
+	for (auto& dependent : dependents)
+		model.removeDependency (&dependent);
+}
+
+//------------------------------------------------------------------------
+static void benchmarkDeferedChanges (uint32_t numDependents)
+{
+	static const char* messages[numDeferedMessages] = {"1", "2", "3", "4", "5", "6", "7", "8"};
+
+	Model model;
+	std::vector<Dependent> dependents (numDependents);
+	for (auto& dependent : dependents)
+		model.addDependency (&dependent);
+
+	auto numCalls = numNotifications / numDependents / numDeferedMessages;
+	auto deferedChanges = [&] () {
+		IDependency::DeferChanges dc (&model);
+		// every message is send twice, but only notified once
+		for (auto round = 0; round < 2; ++round)
+		{
+			for (auto message : messages)
+				model.changed (message);
+		}
+	};
+	deferedChanges ();
+	numAllocations = 0;
+	auto time = measureMs ([&] () {
+		for (auto i = 0u; i < numCalls; ++i)
+			deferedChanges ();
+	});
+	printResult ("IDependency defered", numDependents,
+	             numCalls * numDependents * numDeferedMessages, time, numAllocations, numCalls);
+
+	for (auto& dependent : dependents)
+		model.removeDependency (&dependent);
+}
+
+//------------------------------------------------------------------------
+static void benchmarkDispatchList (uint32_t numListeners)
+{
+	DispatchList<IListener*> list;
+	std::vector<Listener> listeners (numListeners);
+	for (auto& listener : listeners)
+		list.add (&listener);
+
+	auto numCalls = numNotifications / numListeners;
+	numAllocations = 0;
+	auto time = measureMs ([&] () {
+		for (auto i = 0u; i < numCalls; ++i)
+			list.forEach ([&] (IListener* listener) { listener->onChange (i); });
+	});
+	printResult ("DispatchList::forEach", numListeners, numCalls * numListeners, time,
+	             numAllocations, numCalls);
+}
+
+//------------------------------------------------------------------------
+static void benchmarkDispatchListReentrant (uint32_t numListeners)
+{
+	// a listener which removes and adds itself while being notified, like a view which moves to
+	// another parent on a change
+	DispatchList<IListener*> list;
+	std::vector<Listener> listeners (numListeners);
+	for (auto& listener : listeners)
+		list.add (&listener);
+
+	auto numCalls = numNotifications / numListeners;
+	auto notify = [&] (int32_t value) {
+		list.forEach ([&] (IListener* listener) {
+			listener->onChange (value);
+			if (listener == &listeners.front ())
+			{
+				list.remove (listener);
+				list.add (listener);
+			}
+		});
+	};
+	notify (0);
+	numAllocations = 0;
+	auto time = measureMs ([&] () {
+		for (auto i = 0u; i < numCalls; ++i)
+			notify (i);
+	});
+	printResult ("DispatchList reentrant", numListeners, numCalls * numListeners, time,
+	             numAllocations, numCalls);
+}
+
+//------------------------------------------------------------------------
+int main ()
+{
+	for (auto numObservers : {1u, 4u, 16u})
+		benchmarkChanged (numObservers);
+	for (auto numObservers : {1u, 4u, 16u})
+		benchmarkDeferedChanges (numObservers);
+	for (auto numObservers : {1u, 4u, 16u})
+		benchmarkDispatchList (numObservers);
+	for (auto numObservers : {1u, 4u, 16u})
+		benchmarkDispatchListReentrant (numObservers);
+	return 0;
+}
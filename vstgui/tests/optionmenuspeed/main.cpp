@@ -0,0 +1,176 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/animation/animator.h"
+#include "vstgui/lib/cframe.h"
+#include "vstgui/lib/cstring.h"
+#include "vstgui/lib/controls/coptionmenu.h"
+#include "vstgui/lib/platform/platform_x11.h"
+#include "vstgui/lib/platform/linux/x11platform.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------
+namespace VSTGUI { void* soHandle = nullptr; }
+
+using namespace VSTGUI;
+
+static constexpr auto numNavigationKeys = 500;
+static constexpr auto submenuInterval = 1000;
+static constexpr auto numSubmenuItems = 20;
+
+//------------------------------------------------------------------------
+using Clock = std::chrono::high_resolution_clock;
+
+template<typename Proc>
+static double measureMs (Proc proc)
+{
+	auto start = Clock::now ();
+	proc ();
+	return std::chrono::duration<double, std::milli> (Clock::now () - start).count ();
+}
+
+//------------------------------------------------------------------------
+static void printAndTerminate (const char* msg)
+{
+	if (msg)
+		printf ("%s\n", msg);
+	exit (-1);
+}
+
+//------------------------------------------------------------------------
+static std::string makeTitle (int32_t index)
+{
+	static const char* adjectives[] = {"Bright", "Dark", "Warm", "Cold", "Soft", "Hard", "Wide", "Deep", "Thin", "Fat", "Clean", "Dirty"};
+	static const char* nouns[] = {"Pad", "Lead", "Bass", "Pluck", "Keys", "Strings", "Brass", "Choir", "Drone", "Arp", "Bell", "Noise", "Organ"};
+	constexpr auto numAdjectives = sizeof (adjectives) / sizeof (adjectives[0]);
+	constexpr auto numNouns = sizeof (nouns) / sizeof (nouns[0]);
+	std::string title (adjectives[index % numAdjectives]);
+	title += " ";
+	title += nouns[(index / numAdjectives) % numNouns];
+	title += " ";
+	title += std::to_string (index);
+	return title;
+}
+
+//------------------------------------------------------------------------
+static COptionMenu* createMenu (int32_t numItems)
+{
+	auto menu = new COptionMenu (CRect (10, 10, 210, 30), nullptr, 0, nullptr, nullptr,
+	                             COptionMenu::kCheckStyle);
+	for (auto i = 0; i < numItems; ++i)
+	{
+		if (i % submenuInterval == submenuInterval - 1)
+		{
+			auto submenu = makeOwned<COptionMenu> ();
+			for (auto j = 0; j < numSubmenuItems; ++j)
+				submenu->addEntry (makeTitle (j).data ());
+			menu->addEntry (submenu, makeTitle (i).data ());
+		}
+		else
+			menu->addEntry (makeTitle (i).data ());
+	}
+	return menu;
+}
+
+//------------------------------------------------------------------------
+static void finishAnimations (CFrame* frame)
+{
+	// there is no run loop in a headless frame, so we need to drive the animations ourself
+	std::this_thread::sleep_for (std::chrono::milliseconds (200));
+	frame->getAnimator ()->onTimer ();
+}
+
+//------------------------------------------------------------------------
+static VstKeyCode makeKeyCode (int32_t character, unsigned char virt)
+{
+	VstKeyCode keyCode {};
+	keyCode.character = character;
+	keyCode.virt = virt;
+	return keyCode;
+}
+
+//------------------------------------------------------------------------
+int main (int argv, char* argc[])
+{
+	int32_t numItems = 100000;
+	if (argv > 1)
+		numItems = static_cast<int32_t> (UTF8StringView (argc[1]).toInteger ());
+	if (numItems <= 0)
+		printAndTerminate ("usage: optionmenuspeed [number of items]");
+
+	X11::Platform::getInstance ();
+
+	auto frame = new CFrame (CRect (0, 0, 800, 600), nullptr);
+	if (!frame->open (nullptr, kHeadless))
+		printAndTerminate ("could not open frame");
+	auto headlessFrame = dynamic_cast<X11::IHeadlessFrame*> (frame->getPlatformFrame ());
+	if (!headlessFrame)
+		printAndTerminate ("not a headless frame");
+
+	COptionMenu* menu = nullptr;
+	auto createTime = measureMs ([&] () { menu = createMenu (numItems); });
+	frame->addView (menu);
+	menu->setValue (static_cast<float> (numItems / 2));
+	headlessFrame->renderFrame ();
+
+	bool closed = false;
+	auto popupTime = measureMs ([&] () {
+		menu->popup ([&] (COptionMenu*) { closed = true; });
+	});
+	finishAnimations (frame);
+	auto firstFrameTime = measureMs ([&] () { headlessFrame->renderFrame (); });
+
+	auto sendKey = [&] (const VstKeyCode& key) {
+		auto keyCode = key;
+		frame->onKeyDown (keyCode);
+		headlessFrame->renderFrame ();
+	};
+
+	auto navigationTime = measureMs ([&] () {
+		for (auto i = 0; i < numNavigationKeys; ++i)
+			sendKey (makeKeyCode (0, VKEY_DOWN));
+	});
+
+	std::string search ("warm keys 1");
+	std::vector<double> filterTimes;
+	for (auto c : search)
+	{
+		auto key = c == ' ' ? makeKeyCode (0, VKEY_SPACE) : makeKeyCode (c, 0);
+		filterTimes.push_back (measureMs ([&] () { sendKey (key); }));
+	}
+	auto filteredNavigationTime = measureMs ([&] () {
+		for (auto i = 0; i < numNavigationKeys; ++i)
+			sendKey (makeKeyCode (0, VKEY_DOWN));
+	});
+	std::vector<double> backspaceTimes;
+	for (auto i = 0u; i < search.size (); ++i)
+		backspaceTimes.push_back (measureMs ([&] () { sendKey (makeKeyCode (0, VKEY_BACK)); }));
+
+	sendKey (makeKeyCode (0, VKEY_ESCAPE));
+	finishAnimations (frame);
+	if (!closed)
+		printAndTerminate ("menu did not close");
+
+	printf ("%d items\n", numItems);
+	printf ("create menu: %.3f ms\n", createTime);
+	printf ("popup: %.3f ms, first frame: %.3f ms\n", popupTime, firstFrameTime);
+	printf ("navigate (key + frame): %.4f ms\n", navigationTime / numNavigationKeys);
+	printf ("filter \"%s\" (key + frame) in ms:", search.data ());
+	for (auto t : filterTimes)
+		printf (" %.3f", t);
+	printf ("\nnavigate filtered (key + frame): %.4f ms\n",
+	        filteredNavigationTime / numNavigationKeys);
+	printf ("backspace (key + frame) in ms:");
+	for (auto t : backspaceTimes)
+		printf (" %.3f", t);
+	printf ("\n");
+
+	frame->close ();
+	return 0;
+}
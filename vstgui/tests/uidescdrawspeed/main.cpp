@@ -0,0 +1,292 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/cframe.h"
+#include "vstgui/lib/cstring.h"
+#include "vstgui/lib/drawprofiler.h"
+#include "vstgui/lib/platform/platform_x11.h"
+#include "vstgui/lib/platform/common/fileresourceinputstream.h"
+#include "vstgui/lib/platform/linux/cairobitmap.h"
+#include "vstgui/lib/platform/linux/x11platform.h"
+#include "vstgui/uidescription/uidescription.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------
+namespace VSTGUI { void* soHandle = nullptr; }
+
+using namespace VSTGUI;
+
+//------------------------------------------------------------------------
+/*
+	Script commands, one per line:
+
+	invalid <x> <y> <width> <height>
+	invalidall
+	mousemove <x> <y>
+	mousedown <x> <y>
+	mouseup <x> <y>
+	idle
+	render
+
+	Every render command is one measured frame. Lines starting with # are ignored.
+*/
+struct Command
+{
+	enum class Type
+	{
+		Invalid,
+		InvalidAll,
+		MouseMove,
+		MouseDown,
+		MouseUp,
+		Idle,
+		Render
+	};
+
+	Type type;
+	CRect rect;
+};
+
+using Script = std::vector<Command>;
+
+//------------------------------------------------------------------------
+static bool parseScript (std::istream& stream, Script& script)
+{
+	std::string line;
+	while (std::getline (stream, line))
+	{
+		std::istringstream s (line);
+		std::string cmd;
+		if (!(s >> cmd) || cmd[0] == '#')
+			continue;
+		Command command;
+		CCoord x = 0, y = 0, w = 0, h = 0;
+		if (cmd == "invalid")
+		{
+			if (!(s >> x >> y >> w >> h))
+				return false;
+			command.type = Command::Type::Invalid;
+			command.rect = CRect (x, y, x + w, y + h);
+		}
+		else if (cmd == "invalidall")
+			command.type = Command::Type::InvalidAll;
+		else if (cmd == "mousemove" || cmd == "mousedown" || cmd == "mouseup")
+		{
+			if (!(s >> x >> y))
+				return false;
+			command.type = cmd == "mousemove" ?
+							   Command::Type::MouseMove :
+							   (cmd == "mousedown" ? Command::Type::MouseDown :
+													 Command::Type::MouseUp);
+			command.rect = CRect (x, y, x, y);
+		}
+		else if (cmd == "idle")
+			command.type = Command::Type::Idle;
+		else if (cmd == "render")
+			command.type = Command::Type::Render;
+		else
+			return false;
+		script.push_back (command);
+	}
+	return true;
+}
+
+//------------------------------------------------------------------------
+static Script createDefaultScript (const CRect& size)
+{
+	// a small invalidation and a mouse move sweeping diagonally over the view, one per frame
+	Script script;
+	constexpr auto numFrames = 100;
+	constexpr CCoord invalidSize = 32;
+	for (auto i = 0; i < numFrames; ++i)
+	{
+		auto pos = i / static_cast<CCoord> (numFrames);
+		CPoint p (size.getWidth () * pos, size.getHeight () * pos);
+		CRect r (p, CPoint (invalidSize, invalidSize));
+		script.push_back ({Command::Type::Invalid, r});
+		script.push_back ({Command::Type::MouseMove, CRect (p, CPoint ())});
+		script.push_back ({Command::Type::Idle, {}});
+		script.push_back ({Command::Type::Render, {}});
+	}
+	script.push_back ({Command::Type::InvalidAll, {}});
+	script.push_back ({Command::Type::Render, {}});
+	return script;
+}
+
+//------------------------------------------------------------------------
+static void printAndTerminate (const char* msg)
+{
+	if (msg)
+		printf ("%s\n", msg);
+	exit (-1);
+}
+
+//------------------------------------------------------------------------
+int main (int argv, char* argc[])
+{
+	std::string uidescPath;
+	std::string templateName;
+	std::string scriptPath;
+	std::string pngPath;
+	uint32_t repeat = 10;
+	for (auto i = 1; i < argv; ++i)
+	{
+		UTF8StringView arg (argc[i]);
+		if (arg == "-t")
+		{
+			if (++i >= argv)
+				break;
+			templateName = argc[i];
+		}
+		else if (arg == "-s")
+		{
+			if (++i >= argv)
+				break;
+			scriptPath = argc[i];
+		}
+		else if (arg == "-r")
+		{
+			if (++i >= argv)
+				break;
+			repeat = static_cast<uint32_t> (UTF8StringView (argc[i]).toInteger ());
+		}
+		else if (arg == "-png")
+		{
+			if (++i >= argv)
+				break;
+			pngPath = argc[i];
+		}
+		else
+			uidescPath = argc[i];
+	}
+	if (uidescPath.empty () || templateName.empty ())
+		printAndTerminate ("usage: uidescdrawspeed file.uidesc -t template [-s script] [-r "
+						   "repeat] [-png output.png]");
+
+	// resources are loaded relative to the uidesc file
+	auto resourcePath = uidescPath;
+	auto pos = resourcePath.find_last_of ('/');
+	resourcePath = pos == std::string::npos ? "./" : resourcePath.substr (0, pos + 1);
+	X11::Platform::getInstance ();
+	Cairo::Bitmap::setGetResourcePathFunc ([resourcePath] () { return resourcePath; });
+	X11::Frame::createResourceInputStreamFunc = [resourcePath] (const CResourceDescription& desc) {
+		if (desc.type != CResourceDescription::kStringType)
+			return IPlatformResourceInputStream::Ptr ();
+		return FileResourceInputStream::create (resourcePath + desc.u.name);
+	};
+
+	auto description = makeOwned<UIDescription> (CResourceDescription (uidescPath.data ()));
+	if (!description->parse ())
+		printAndTerminate ("could not parse uidesc file");
+	auto view = description->createView (templateName.data (), nullptr);
+	if (!view)
+		printAndTerminate ("could not create template view");
+
+	CRect frameSize (0, 0, view->getWidth (), view->getHeight ());
+	auto frame = new CFrame (frameSize, nullptr);
+	frame->addView (view);
+	if (!frame->open (nullptr, kHeadless))
+		printAndTerminate ("could not open frame");
+	auto headlessFrame = dynamic_cast<X11::IHeadlessFrame*> (frame->getPlatformFrame ());
+	if (!headlessFrame)
+		printAndTerminate ("not a headless frame");
+
+	Script script;
+	if (scriptPath.empty ())
+		script = createDefaultScript (frameSize);
+	else
+	{
+		std::ifstream stream (scriptPath);
+		if (!stream || !parseScript (stream, script))
+			printAndTerminate ("could not parse script");
+	}
+
+	// initial full draw, not measured
+	headlessFrame->renderFrame ();
+
+#if VSTGUI_DRAW_PROFILER
+	// the profiler records the area drawn by every view, which gives the overdraw
+	DrawProfiler::clear ();
+	DrawProfiler::setEnabled (true);
+#endif
+
+	using Clock = std::chrono::high_resolution_clock;
+	std::vector<double> frameTimes;
+	uint64_t pixels = 0;
+	for (auto i = 0u; i < repeat; ++i)
+	{
+		for (const auto& command : script)
+		{
+			CPoint where (command.rect.getTopLeft ());
+			switch (command.type)
+			{
+				case Command::Type::Invalid: frame->invalidRect (command.rect); break;
+				case Command::Type::InvalidAll: frame->invalid (); break;
+				case Command::Type::MouseMove:
+					headlessFrame->onMouseMoved (where, 0);
+					break;
+				case Command::Type::MouseDown:
+					headlessFrame->onMouseDown (where, kLButton);
+					break;
+				case Command::Type::MouseUp: headlessFrame->onMouseUp (where, kLButton); break;
+				case Command::Type::Idle: frame->idle (); break;
+				case Command::Type::Render:
+				{
+					auto start = Clock::now ();
+					const auto& rects = headlessFrame->renderFrame ();
+					auto duration = std::chrono::duration<double, std::milli> (Clock::now () - start);
+					frameTimes.push_back (duration.count ());
+					for (const auto& r : rects)
+						pixels += static_cast<uint64_t> (r.getWidth () * r.getHeight ());
+					break;
+				}
+			}
+		}
+	}
+
+#if VSTGUI_DRAW_PROFILER
+	DrawProfiler::setEnabled (false);
+	// only the innermost views are counted, the children draw inside the area of their container
+	// and counting the containers too would count this area once per nesting level
+	double drawnPixels = 0.;
+	const auto& events = DrawProfiler::getEvents ();
+	for (auto i = 0u; i < events.size (); ++i)
+	{
+		auto isLeaf = i + 1 == events.size () || events[i + 1].depth <= events[i].depth;
+		if (events[i].depth > 0 && isLeaf)
+			drawnPixels += events[i].pixels;
+	}
+#endif
+
+	if (!pngPath.empty ())
+		headlessFrame->writeToPNG (pngPath.data ());
+
+	frame->close ();
+
+	if (frameTimes.empty ())
+		printAndTerminate ("script did not render any frame");
+	std::sort (frameTimes.begin (), frameTimes.end ());
+	auto percentile = [&] (double p) {
+		auto index = static_cast<size_t> (p * (frameTimes.size () - 1) + 0.5);
+		return frameTimes[index];
+	};
+	printf ("frames: %zu\n", frameTimes.size ());
+	printf ("draw time per frame (ms): p50 %.3f p90 %.3f p99 %.3f max %.3f\n", percentile (0.5),
+			percentile (0.9), percentile (0.99), frameTimes.back ());
+	printf ("pixels touched: %llu total, %.0f per frame\n", static_cast<unsigned long long> (pixels),
+			static_cast<double> (pixels) / frameTimes.size ());
+#if VSTGUI_DRAW_PROFILER
+	if (pixels)
+		printf ("overdraw: %.2f (pixels drawn by the innermost views / pixels touched)\n",
+				drawnPixels / static_cast<double> (pixels));
+#endif
+	return 0;
+}
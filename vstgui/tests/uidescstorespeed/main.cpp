@@ -0,0 +1,152 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/cview.h"
+#include "vstgui/lib/cviewcontainer.h"
+#include "vstgui/uidescription/cstream.h"
+#include "vstgui/uidescription/uidescription.h"
+#include "vstgui/uidescription/xmlparser.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <list>
+#include <string>
+
+#if MAC
+#include <CoreFoundation/CoreFoundation.h>
+namespace VSTGUI { void* gBundleRef = CFBundleGetMainBundle (); }
+#elif WINDOWS
+#include <windows.h>
+void* hInstance = nullptr;
+#elif LINUX
+namespace VSTGUI { void* soHandle = nullptr; }
+#endif
+
+using namespace VSTGUI;
+
+static constexpr auto numContainers = 100;
+static constexpr auto numViewsPerContainer = 100;
+static constexpr auto numRuns = 20;
+
+//------------------------------------------------------------------------
+class Description : public UIDescription
+{
+public:
+	using UIDescription::UIDescription;
+	using UIDescription::saveToStream;
+};
+
+//------------------------------------------------------------------------
+static std::string createUIDesc ()
+{
+	std::string xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+	xml += "<vstgui-ui-description version=\"1\">\n";
+	xml += "\t<template class=\"CViewContainer\" name=\"Template\" origin=\"0, 0\" size=\"1000, "
+	       "1000\">\n";
+	for (auto c = 0; c < numContainers; ++c)
+	{
+		auto x = std::to_string ((c % 10) * 100);
+		auto y = std::to_string ((c / 10) * 100);
+		xml += "\t\t<view class=\"CViewContainer\" origin=\"" + x + ", " + y +
+		       "\" size=\"100, 100\" transparent=\"true\">\n";
+		for (auto v = 0; v < numViewsPerContainer; ++v)
+		{
+			auto vx = std::to_string ((v % 10) * 10);
+			auto vy = std::to_string ((v / 10) * 10);
+			xml += "\t\t\t<view class=\"CView\" origin=\"" + vx + ", " + vy +
+			       "\" size=\"10, 10\" tooltip=\"view " + std::to_string (v) +
+			       "\" transparent=\"true\"/>\n";
+		}
+		xml += "\t\t</view>\n";
+	}
+	xml += "\t</template>\n";
+	xml += "</vstgui-ui-description>\n";
+	return xml;
+}
+
+//------------------------------------------------------------------------
+static void measure (const char* name, const std::function<uint32_t ()>& func)
+{
+	std::chrono::nanoseconds minTime = std::chrono::nanoseconds::max ();
+	std::chrono::nanoseconds totalTime {0};
+	uint32_t numBytes = 0;
+	for (auto run = 0; run < numRuns; ++run)
+	{
+		auto start = std::chrono::high_resolution_clock::now ();
+		numBytes = func ();
+		auto duration = std::chrono::high_resolution_clock::now () - start;
+		minTime = std::min<std::chrono::nanoseconds> (minTime, duration);
+		totalTime += duration;
+	}
+	auto toMs = [] (std::chrono::nanoseconds time) {
+		return std::chrono::duration_cast<std::chrono::microseconds> (time).count () / 1000.;
+	};
+	printf ("%-28s %10u bytes  min %8.3f ms  avg %8.3f ms\n", name, numBytes, toMs (minTime),
+	        toMs (totalTime) / numRuns);
+}
+
+//------------------------------------------------------------------------
+int main ()
+{
+	auto xml = createUIDesc ();
+	Xml::MemoryContentProvider provider (xml.data (), static_cast<uint32_t> (xml.size ()));
+	auto description = makeOwned<Description> (&provider);
+	if (!description->parse ())
+	{
+		printf ("could not parse the generated uidesc\n");
+		return -1;
+	}
+	auto view = owned (description->createView ("Template", nullptr));
+	if (!view)
+	{
+		printf ("could not create the template view\n");
+		return -1;
+	}
+
+	printf ("%d views, %d runs\n", numContainers * (numViewsPerContainer + 1), numRuns);
+	// the editor copies views into a memory stream with the default delta
+	measure ("storeViews (copy/paste)", [&] () {
+		CMemoryStream stream (1024, 1024, false);
+		if (!description->storeViews ({view}, stream))
+			return 0u;
+		return static_cast<uint32_t> (stream.tell ());
+	});
+	measure ("storeViews binary (drag)", [&] () {
+		CMemoryStream stream (1024, 1024, false);
+		if (!description->storeViews ({view}, stream, nullptr, UIDescription::kBinaryViewsFormat))
+			return 0u;
+		return static_cast<uint32_t> (stream.tell ());
+	});
+	// the editor pastes the children of a template, views need to be attached to be found in the
+	// description
+	auto parent = makeOwned<CViewContainer> (CRect (0, 0, 1000, 1000));
+	view->attached (parent);
+	std::list<CView*> children;
+	view->asViewContainer ()->forEachChild ([&] (CView* child) { children.emplace_back (child); });
+	for (auto format : {UIDescription::kXMLViewsFormat, UIDescription::kBinaryViewsFormat})
+	{
+		CMemoryStream stream (1024, 1024, false);
+		description->storeViews (children, stream, nullptr, format);
+		auto size = static_cast<uint32_t> (stream.tell ());
+		measure (format == UIDescription::kXMLViewsFormat ? "restoreViews (paste)"
+		                                                  : "restoreViews binary (paste)",
+		         [&] () {
+			         CMemoryStream input (stream.getBuffer (), size, false);
+			         std::list<SharedPointer<CView>> views;
+			         if (!description->restoreViews (input, views))
+				         return 0u;
+			         return size;
+		         });
+	}
+	view->removed (parent);
+	measure ("saveToStream (save)", [&] () {
+		CMemoryStream stream (1024, 1024, false);
+		if (!description->saveToStream (stream, 0))
+			return 0u;
+		return static_cast<uint32_t> (stream.tell ());
+	});
+	return 0;
+}
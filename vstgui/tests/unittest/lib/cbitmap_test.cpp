@@ -4,8 +4,10 @@
 
 #include "../../../lib/cbitmap.h"
 #include "../../../lib/ccolor.h"
+#include "../../../lib/cdrawcontext.h"
 #include "../../../lib/platform/iplatformbitmap.h"
 #include "../unittests.h"
+#include <vector>
 
 namespace VSTGUI {
 
@@ -86,4 +88,142 @@ TESTCASE(CBitmapTest,
 	);
 );
 
+namespace {
+
+//------------------------------------------------------------------------
+class AtlasTestBitmap : public CBitmap
+{
+public:
+	AtlasTestBitmap () = default;
+};
+
+//------------------------------------------------------------------------
+class BitmapLoggingContext : public CDrawContext
+{
+public:
+	BitmapLoggingContext (const CRect& r) : CDrawContext (r) { init (); }
+
+	void drawBitmap (CBitmap* bitmap, const CRect& dest, const CPoint& offset, float alpha) override
+	{
+		// resolve bitmaps without platform bitmap like the platform draw contexts do
+		if (!bitmap->getPlatformBitmap ())
+		{
+			if (auto atlasBitmap = dynamic_cast<CAtlasBitmap*> (bitmap))
+			{
+				atlasBitmap->draw (this, dest, offset, alpha);
+				return;
+			}
+		}
+		bitmaps.push_back (bitmap);
+		dests.push_back (dest);
+		offsets.push_back (offset);
+	}
+
+	void drawLine (const LinePair& line) override {}
+	void drawLines (const LineList& lines) override {}
+	void drawPolygon (const PointList& polygonPointList, const CDrawStyle drawStyle) override {}
+	void drawRect (const CRect& rect, const CDrawStyle drawStyle) override {}
+	void drawArc (const CRect& rect, const float startAngle1, const float endAngle2, const CDrawStyle drawStyle) override {}
+	void drawEllipse (const CRect& rect, const CDrawStyle drawStyle) override {}
+	void drawPoint (const CPoint& point, const CColor& color) override {}
+	void clearRect (const CRect& rect) override {}
+	CGraphicsPath* createGraphicsPath () override { return nullptr; }
+	CGraphicsPath* createTextPath (const CFontRef font, UTF8StringPtr text) override { return nullptr; }
+	void drawGraphicsPath (CGraphicsPath* path, PathDrawMode mode, CGraphicsTransform* transformation) override {}
+	void fillLinearGradient (CGraphicsPath* path, const CGradient& gradient, const CPoint& startPoint, const CPoint& endPoint, bool evenOdd, CGraphicsTransform* transformation) override {}
+	void fillRadialGradient (CGraphicsPath* path, const CGradient& gradient, const CPoint& center, CCoord radius, const CPoint& originOffset, bool evenOdd, CGraphicsTransform* transformation) override {}
+
+	std::vector<CBitmap*> bitmaps;
+	std::vector<CRect> dests;
+	std::vector<CPoint> offsets;
+};
+
+//------------------------------------------------------------------------
+static SharedPointer<CAtlasBitmap> makeAtlasBitmap (CBitmap* atlas)
+{
+	CAtlasBitmap::FrameList frames;
+	// first frame is not trimmed, the second one has a transparent border of 2 pixels
+	frames.emplace_back (CRect (0, 0, 10, 10));
+	frames.emplace_back (CRect (10, 0, 16, 6), CPoint (2, 2));
+	return makeOwned<CAtlasBitmap> (atlas, CPoint (10, 10), frames);
+}
+
+} // anonymous
+
+//------------------------------------------------------------------------
+TESTCASE(CAtlasBitmapTest,
+
+	TEST(size,
+		auto atlas = makeOwned<AtlasTestBitmap> ();
+		auto bitmap = makeAtlasBitmap (atlas);
+		EXPECT (bitmap->getWidth () == 10);
+		EXPECT (bitmap->getHeight () == 20);
+		EXPECT (bitmap->getAtlas () == atlas);
+	);
+
+	TEST(drawFrame,
+		auto atlas = makeOwned<AtlasTestBitmap> ();
+		auto bitmap = makeAtlasBitmap (atlas);
+		auto context = owned (new BitmapLoggingContext (CRect (0, 0, 100, 100)));
+		bitmap->draw (context, CRect (20, 20, 30, 30), CPoint (0, 0));
+		EXPECT (context->bitmaps.size () == 1);
+		EXPECT (context->bitmaps[0] == atlas);
+		EXPECT (context->dests[0] == CRect (20, 20, 30, 30));
+		EXPECT (context->offsets[0] == CPoint (0, 0));
+	);
+
+	TEST(drawTrimmedFrame,
+		auto atlas = makeOwned<AtlasTestBitmap> ();
+		auto bitmap = makeAtlasBitmap (atlas);
+		auto context = owned (new BitmapLoggingContext (CRect (0, 0, 100, 100)));
+		bitmap->draw (context, CRect (20, 20, 30, 30), CPoint (0, 10));
+		EXPECT (context->bitmaps.size () == 1);
+		EXPECT (context->dests[0] == CRect (22, 22, 28, 28));
+		EXPECT (context->offsets[0] == CPoint (10, 0));
+	);
+
+	TEST(drawAcrossFramesIsClipped,
+		auto atlas = makeOwned<AtlasTestBitmap> ();
+		auto bitmap = makeAtlasBitmap (atlas);
+		auto context = owned (new BitmapLoggingContext (CRect (0, 0, 100, 100)));
+		context->setClipRect (CRect (0, 0, 100, 29));
+		bitmap->draw (context, CRect (20, 20, 30, 30), CPoint (0, 5));
+		EXPECT (context->bitmaps.size () == 2);
+		EXPECT (context->dests[0] == CRect (20, 20, 30, 25));
+		EXPECT (context->offsets[0] == CPoint (0, 5));
+		EXPECT (context->dests[1] == CRect (22, 27, 28, 29));
+		EXPECT (context->offsets[1] == CPoint (10, 0));
+	);
+
+	TEST(isLoadedWhenAtlasIsLoaded,
+		auto atlas = makeOwned<CBitmap> (16., 10.);
+		EXPECT (atlas->isLoaded ());
+		EXPECT (makeAtlasBitmap (atlas)->isLoaded ());
+		EXPECT (makeAtlasBitmap (makeOwned<AtlasTestBitmap> ())->isLoaded () == false);
+	);
+
+	TEST(drawBitmapResolvesThroughAtlas,
+		auto atlas = makeOwned<CBitmap> (16., 10.);
+		auto bitmap = makeAtlasBitmap (atlas);
+		auto context = owned (new BitmapLoggingContext (CRect (0, 0, 100, 100)));
+		context->drawBitmap (bitmap, CRect (20, 20, 30, 30), CPoint (0, 10), 1.f);
+		EXPECT (context->bitmaps.size () == 1);
+		EXPECT (context->bitmaps[0] == atlas);
+		EXPECT (context->dests[0] == CRect (22, 22, 28, 28));
+		EXPECT (context->offsets[0] == CPoint (10, 0));
+	);
+
+	TEST(fillRectWithBitmapResolvesThroughAtlas,
+		auto atlas = makeOwned<CBitmap> (16., 10.);
+		auto bitmap = makeAtlasBitmap (atlas);
+		auto context = owned (new BitmapLoggingContext (CRect (0, 0, 100, 100)));
+		context->fillRectWithBitmap (bitmap, CRect (0, 0, 10, 10), CRect (0, 0, 20, 10), 1.f);
+		EXPECT (context->bitmaps.size () == 2);
+		EXPECT (context->bitmaps[0] == atlas);
+		EXPECT (context->bitmaps[1] == atlas);
+		EXPECT (context->dests[0] == CRect (0, 0, 10, 10));
+		EXPECT (context->dests[1] == CRect (10, 0, 20, 10));
+	);
+);
+
 } // VSTGUI
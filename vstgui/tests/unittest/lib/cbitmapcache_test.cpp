@@ -0,0 +1,336 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../lib/cbitmap.h"
+#include "../../../lib/cbitmapcache.h"
+#include "../../../lib/cframe.h"
+#include "../../../lib/platform/iplatformbitmap.h"
+#include "../unittests.h"
+#include <limits>
+
+namespace VSTGUI {
+
+namespace {
+
+//------------------------------------------------------------------------
+class TestPlatformBitmap : public IPlatformBitmap
+{
+public:
+	TestPlatformBitmap (const CPoint& size) : size (size) {}
+
+	bool load (const CResourceDescription& desc) override { return false; }
+	const CPoint& getSize () const override { return size; }
+	SharedPointer<IPlatformBitmapPixelAccess> lockPixels (bool alphaPremultiplied) override
+	{
+		return nullptr;
+	}
+	void setScaleFactor (double factor) override { scaleFactor = factor; }
+	double getScaleFactor () const override { return scaleFactor; }
+
+private:
+	CPoint size;
+	double scaleFactor {1.};
+};
+
+//------------------------------------------------------------------------
+static SharedPointer<CBitmap> makeReloadableBitmap (uint32_t& numReloads)
+{
+	auto bitmap = makeOwned<CBitmap> (makeOwned<TestPlatformBitmap> (CPoint (10, 10)));
+	bitmap->setReloadFunction ([&] () {
+		++numReloads;
+		return makeOwned<CBitmap> (makeOwned<TestPlatformBitmap> (CPoint (10, 10)));
+	});
+	return bitmap;
+}
+
+//------------------------------------------------------------------------
+struct CacheSetup
+{
+	CacheSetup ()
+	{
+		cache.setBudget (0);
+		cache.resetStatistics ();
+		residentBytes = cache.getStatistics ().residentBytes;
+	}
+	~CacheSetup () noexcept { cache.setBudget (0); }
+
+	uint64_t getResidentBytes () const { return cache.getStatistics ().residentBytes - residentBytes; }
+
+	CBitmapCache& cache {CBitmapCache::getInstance ()};
+	uint64_t residentBytes;
+};
+
+static constexpr uint64_t kBitmapBytes = 10 * 10 * 4;
+
+//------------------------------------------------------------------------
+struct ScaledCacheSetup
+{
+	ScaledCacheSetup () { cache.setScaledBitmapBudget (1024 * 1024); }
+	~ScaledCacheSetup () noexcept { cache.setScaledBitmapBudget (0); }
+
+	CBitmapCache& cache {CBitmapCache::getInstance ()};
+};
+
+//------------------------------------------------------------------------
+/** create a bitmap with a single platform bitmap where all bytes of a pixel have the same value */
+static SharedPointer<CBitmap> makeBitmap (CPoint size, double scaleFactor,
+                                          const std::vector<uint8_t>& values = {})
+{
+	auto platformBitmap = IPlatformBitmap::create (&size);
+	if (!platformBitmap)
+		return nullptr;
+	platformBitmap->setScaleFactor (scaleFactor);
+	if (auto access = platformBitmap->lockPixels (true))
+	{
+		auto width = static_cast<uint32_t> (size.x);
+		for (auto i = 0u; i < values.size (); ++i)
+		{
+			auto pixel = access->getAddress () + (i / width) * access->getBytesPerRow () +
+			             (i % width) * 4;
+			for (auto c = 0u; c < 4; ++c)
+				pixel[c] = values[i];
+		}
+	}
+	return makeOwned<CBitmap> (platformBitmap);
+}
+
+} // anonymous
+
+//------------------------------------------------------------------------
+TESTCASE(CBitmapCacheTest,
+
+	TEST(residentBytes,
+		CacheSetup setup;
+		uint32_t numReloads = 0;
+		{
+			auto bitmap = makeReloadableBitmap (numReloads);
+			EXPECT (setup.getResidentBytes () == kBitmapBytes);
+		}
+		EXPECT (setup.getResidentBytes () == 0);
+	);
+
+	TEST(budgetEvictsLeastRecentlyUsedBitmap,
+		CacheSetup setup;
+		uint32_t numReloads = 0;
+		auto bitmap1 = makeReloadableBitmap (numReloads);
+		auto bitmap2 = makeReloadableBitmap (numReloads);
+		setup.cache.setBudget (std::numeric_limits<uint64_t>::max ());
+		bitmap1->getPlatformBitmap ();
+		setup.cache.setBudget (setup.cache.getStatistics ().residentBytes - kBitmapBytes);
+		EXPECT (bitmap2->isEvicted ());
+		EXPECT (bitmap1->isEvicted () == false);
+		EXPECT (setup.cache.getStatistics ().numEvictions == 1);
+		EXPECT (setup.getResidentBytes () == kBitmapBytes);
+	);
+
+	TEST(evictedBitmapKeepsSizeAndReloadsOnDemand,
+		CacheSetup setup;
+		uint32_t numReloads = 0;
+		auto bitmap = makeReloadableBitmap (numReloads);
+		setup.cache.trim (setup.cache.getStatistics ().residentBytes - kBitmapBytes);
+		EXPECT (bitmap->isEvicted ());
+		EXPECT (bitmap->getWidth () == 10);
+		EXPECT (bitmap->getHeight () == 10);
+		EXPECT (numReloads == 0);
+		EXPECT (bitmap->getPlatformBitmap ());
+		EXPECT (bitmap->isEvicted () == false);
+		EXPECT (numReloads == 1);
+		EXPECT (setup.cache.getStatistics ().numReloads == 1);
+		EXPECT (setup.getResidentBytes () == kBitmapBytes);
+	);
+
+	TEST(reloadedBitmapEvictsOthersAfterTheFrame,
+		CacheSetup setup;
+		uint32_t numReloads = 0;
+		auto bitmap1 = makeReloadableBitmap (numReloads);
+		auto bitmap2 = makeReloadableBitmap (numReloads);
+		setup.cache.trim (setup.cache.getStatistics ().residentBytes - 2 * kBitmapBytes);
+		EXPECT (bitmap1->isEvicted () && bitmap2->isEvicted ());
+		setup.cache.setBudget (setup.cache.getStatistics ().residentBytes + kBitmapBytes);
+		bitmap1->getBestPlatformBitmapForScaleFactor (1.);
+		setup.cache.endFrame ();
+		bitmap2->getBestPlatformBitmapForScaleFactor (1.);
+		// nothing is evicted while drawing
+		EXPECT (bitmap1->isEvicted () == false);
+		EXPECT (bitmap2->isEvicted () == false);
+		setup.cache.endFrame ();
+		EXPECT (bitmap1->isEvicted ());
+		EXPECT (bitmap2->isEvicted () == false);
+		EXPECT (numReloads == 2);
+	);
+
+	TEST(bitmapsOfTheCurrentFrameAreNotEvicted,
+		CacheSetup setup;
+		uint32_t numReloads = 0;
+		auto bitmap1 = makeReloadableBitmap (numReloads);
+		auto bitmap2 = makeReloadableBitmap (numReloads);
+		setup.cache.trim (setup.cache.getStatistics ().residentBytes - 2 * kBitmapBytes);
+		EXPECT (bitmap1->isEvicted () && bitmap2->isEvicted ());
+		// both bitmaps are visible, but only one fits into the budget
+		setup.cache.setBudget (setup.cache.getStatistics ().residentBytes + kBitmapBytes);
+		for (auto frame = 0; frame < 3; ++frame)
+		{
+			bitmap1->getPlatformBitmap ();
+			bitmap2->getPlatformBitmap ();
+			setup.cache.endFrame ();
+		}
+		EXPECT (bitmap1->isEvicted () == false);
+		EXPECT (bitmap2->isEvicted () == false);
+		EXPECT (numReloads == 2);
+		// when one is not drawn anymore, it is evicted
+		bitmap2->getPlatformBitmap ();
+		setup.cache.endFrame ();
+		EXPECT (bitmap1->isEvicted ());
+		EXPECT (bitmap2->isEvicted () == false);
+	);
+
+	TEST(framesDoNotEvictTheBitmapsOfEachOther,
+		CacheSetup setup;
+		uint32_t numReloads = 0;
+		auto bitmap1 = makeReloadableBitmap (numReloads);
+		auto bitmap2 = makeReloadableBitmap (numReloads);
+		setup.cache.trim (setup.cache.getStatistics ().residentBytes - 2 * kBitmapBytes);
+		EXPECT (bitmap1->isEvicted () && bitmap2->isEvicted ());
+		// each frame shows one bitmap, but only one fits into the budget
+		setup.cache.setBudget (setup.cache.getStatistics ().residentBytes + kBitmapBytes);
+		auto frame1 = owned (new CFrame (CRect (0, 0, 10, 10), nullptr));
+		auto frame2 = owned (new CFrame (CRect (0, 0, 10, 10), nullptr));
+		for (auto draw = 0; draw < 3; ++draw)
+		{
+			setup.cache.beginFrame (frame1);
+			bitmap1->getPlatformBitmap ();
+			setup.cache.endFrame (frame1);
+			setup.cache.beginFrame (frame2);
+			bitmap2->getPlatformBitmap ();
+			setup.cache.endFrame (frame2);
+		}
+		EXPECT (bitmap1->isEvicted () == false);
+		EXPECT (bitmap2->isEvicted () == false);
+		EXPECT (numReloads == 2);
+		// the bitmaps of a destroyed frame are not in use anymore
+		frame2 = nullptr;
+		setup.cache.beginFrame (frame1);
+		bitmap1->getPlatformBitmap ();
+		setup.cache.endFrame (frame1);
+		EXPECT (bitmap1->isEvicted () == false);
+		EXPECT (bitmap2->isEvicted ());
+	);
+
+	TEST(noBudgetDoesNotTrackUse,
+		CacheSetup setup;
+		uint32_t numReloads = 0;
+		auto bitmap1 = makeReloadableBitmap (numReloads);
+		auto bitmap2 = makeReloadableBitmap (numReloads);
+		// bitmap2 was added last and stays the most recently used bitmap
+		bitmap1->getPlatformBitmap ();
+		setup.cache.setBudget (setup.cache.getStatistics ().residentBytes - kBitmapBytes);
+		EXPECT (bitmap1->isEvicted ());
+		EXPECT (bitmap2->isEvicted () == false);
+	);
+
+	TEST(isLoadedReflectsFailedReload,
+		CacheSetup setup;
+		bool reloadFails = false;
+		auto bitmap = makeOwned<CBitmap> (makeOwned<TestPlatformBitmap> (CPoint (10, 10)));
+		bitmap->setReloadFunction ([&] () -> SharedPointer<CBitmap> {
+			if (reloadFails)
+				return nullptr;
+			return makeOwned<CBitmap> (makeOwned<TestPlatformBitmap> (CPoint (10, 10)));
+		});
+		setup.cache.trim (setup.cache.getStatistics ().residentBytes - kBitmapBytes);
+		EXPECT (bitmap->isEvicted ());
+		EXPECT (bitmap->isLoaded ());
+		EXPECT (bitmap->isEvicted () == false);
+		setup.cache.trim (setup.cache.getStatistics ().residentBytes - kBitmapBytes);
+		reloadFails = true;
+		EXPECT (bitmap->isLoaded () == false);
+		bitmap->setReloadFunction (nullptr);
+	);
+
+	TEST(removingTheReloadFunctionReloads,
+		CacheSetup setup;
+		uint32_t numReloads = 0;
+		auto bitmap = makeReloadableBitmap (numReloads);
+		setup.cache.trim (setup.cache.getStatistics ().residentBytes - kBitmapBytes);
+		EXPECT (bitmap->isEvicted ());
+		bitmap->setReloadFunction (nullptr);
+		EXPECT (bitmap->isEvicted () == false);
+		EXPECT (bitmap->isReloadable () == false);
+		EXPECT (numReloads == 1);
+		EXPECT (setup.getResidentBytes () == 0);
+	);
+);
+
+//------------------------------------------------------------------------
+TESTCASE(CBitmapScaledBitmapTest,
+
+	TEST(scaledBitmapIsCreatedOnSecondRequest,
+		ScaledCacheSetup setup;
+		auto bitmap = makeBitmap (CPoint (20, 20), 2.);
+		auto source = bitmap->getPlatformBitmap ();
+		EXPECT (bitmap->getBestPlatformBitmapForScaleFactor (1.5) == source);
+		auto scaled = bitmap->getBestPlatformBitmapForScaleFactor (1.5);
+		EXPECT (scaled != source);
+		EXPECT (scaled->getScaleFactor () == 1.5);
+		EXPECT (scaled->getSize () == CPoint (15, 15));
+		EXPECT (bitmap->getBestPlatformBitmapForScaleFactor (1.5) == scaled);
+		EXPECT (setup.cache.getStatistics ().scaledBytes == 15 * 15 * 4);
+		EXPECT (setup.cache.getStatistics ().numScaledBitmaps == 1);
+		bitmap = nullptr;
+		EXPECT (setup.cache.getStatistics ().scaledBytes == 0);
+		EXPECT (setup.cache.getStatistics ().numScaledBitmaps == 0);
+	);
+
+	TEST(scaledBitmapAveragesPixels,
+		ScaledCacheSetup setup;
+		auto bitmap = makeBitmap (CPoint (2, 2), 2., {0, 100, 200, 252});
+		bitmap->getBestPlatformBitmapForScaleFactor (1.);
+		auto scaled = bitmap->getBestPlatformBitmapForScaleFactor (1.);
+		EXPECT (scaled->getSize () == CPoint (1, 1));
+		auto access = scaled->lockPixels (true);
+		EXPECT (access);
+		for (auto c = 0u; c < 4; ++c)
+			EXPECT (access->getAddress ()[c] == 138);
+	);
+
+	TEST(noUpsampledBitmaps,
+		ScaledCacheSetup setup;
+		auto bitmap = makeBitmap (CPoint (10, 10), 1.);
+		auto source = bitmap->getPlatformBitmap ();
+		EXPECT (bitmap->getBestPlatformBitmapForScaleFactor (1.5) == source);
+		EXPECT (bitmap->getBestPlatformBitmapForScaleFactor (1.5) == source);
+		EXPECT (setup.cache.getStatistics ().numScaledBitmaps == 0);
+	);
+
+	TEST(budgetRemovesLeastRecentlyUsedScaledBitmaps,
+		ScaledCacheSetup setup;
+		setup.cache.setScaledBitmapBudget (15 * 15 * 4);
+		auto bitmap1 = makeBitmap (CPoint (20, 20), 2.);
+		auto bitmap2 = makeBitmap (CPoint (20, 20), 2.);
+		bitmap1->getBestPlatformBitmapForScaleFactor (1.5);
+		auto scaled1 = bitmap1->getBestPlatformBitmapForScaleFactor (1.5);
+		bitmap2->getBestPlatformBitmapForScaleFactor (1.5);
+		auto scaled2 = bitmap2->getBestPlatformBitmapForScaleFactor (1.5);
+		EXPECT (setup.cache.getStatistics ().numScaledBitmaps == 1);
+		EXPECT (bitmap2->getBestPlatformBitmapForScaleFactor (1.5) == scaled2);
+		EXPECT (bitmap1->getBestPlatformBitmapForScaleFactor (1.5) != scaled1);
+		setup.cache.setScaledBitmapBudget (0);
+		EXPECT (setup.cache.getStatistics ().scaledBytes == 0);
+		EXPECT (bitmap2->getBestPlatformBitmapForScaleFactor (1.5) == bitmap2->getPlatformBitmap ());
+	);
+
+	TEST(changedPixelsRemoveScaledBitmaps,
+		ScaledCacheSetup setup;
+		auto bitmap = makeBitmap (CPoint (20, 20), 2.);
+		bitmap->getBestPlatformBitmapForScaleFactor (1.5);
+		bitmap->getBestPlatformBitmapForScaleFactor (1.5);
+		EXPECT (setup.cache.getStatistics ().numScaledBitmaps == 1);
+		auto access = owned (CBitmapPixelAccess::create (bitmap));
+		EXPECT (setup.cache.getStatistics ().numScaledBitmaps == 0);
+		bitmap->getBestPlatformBitmapForScaleFactor (1.5);
+		EXPECT (bitmap->getBestPlatformBitmapForScaleFactor (1.5) == bitmap->getPlatformBitmap ());
+	);
+);
+
+} // VSTGUI
@@ -0,0 +1,258 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../lib/cdatabrowser.h"
+#include "../../../lib/cdrawcontext.h"
+#include "../../../lib/cframe.h"
+#include "../../../lib/idatabrowserdelegate.h"
+#include "../unittests.h"
+#include <set>
+
+namespace VSTGUI {
+
+namespace {
+
+//------------------------------------------------------------------------
+class TestDelegate : public DataBrowserDelegateAdapter
+{
+public:
+	int32_t dbGetNumRows (CDataBrowser* browser) override { return numRows; }
+	int32_t dbGetNumColumns (CDataBrowser* browser) override { return 3; }
+	CCoord dbGetRowHeight (CDataBrowser* browser) override { return 10; }
+	CCoord dbGetCurrentColumnWidth (int32_t index, CDataBrowser* browser) override { return 40; }
+	void dbDrawCell (CDrawContext* context, const CRect& size, int32_t row, int32_t column,
+	                 int32_t flags, CDataBrowser* browser) override
+	{
+		drawnRows.insert (row);
+		drawnColumns.insert (column);
+		if (flags & kRowSelected)
+			drawnSelectedRows.insert (row);
+	}
+	void dbSelectionChanged (CDataBrowser* browser) override { ++selectionChangedCount; }
+
+	int32_t numRows {100000};
+	std::set<int32_t> drawnRows;
+	std::set<int32_t> drawnColumns;
+	std::set<int32_t> drawnSelectedRows;
+	uint32_t selectionChangedCount {0};
+};
+
+//------------------------------------------------------------------------
+class NoDrawContext : public CDrawContext
+{
+public:
+	NoDrawContext (const CRect& r) : CDrawContext (r) { setClipRect (r); }
+
+	void drawLine (const LinePair& line) override {}
+	void drawLines (const LineList& lines) override {}
+	void drawPolygon (const PointList& polygonPointList, const CDrawStyle drawStyle) override {}
+	void drawRect (const CRect& rect, const CDrawStyle drawStyle) override {}
+	void drawArc (const CRect& rect, const float startAngle1, const float endAngle2, const CDrawStyle drawStyle) override {}
+	void drawEllipse (const CRect& rect, const CDrawStyle drawStyle) override {}
+	void drawPoint (const CPoint& point, const CColor& color) override {}
+	void drawBitmap (CBitmap* bitmap, const CRect& dest, const CPoint& offset, float alpha) override {}
+	void clearRect (const CRect& rect) override {}
+	CGraphicsPath* createGraphicsPath () override { return nullptr; }
+	CGraphicsPath* createTextPath (const CFontRef font, UTF8StringPtr text) override { return nullptr; }
+	void drawGraphicsPath (CGraphicsPath* path, PathDrawMode mode, CGraphicsTransform* transformation) override {}
+	void fillLinearGradient (CGraphicsPath* path, const CGradient& gradient, const CPoint& startPoint, const CPoint& endPoint, bool evenOdd, CGraphicsTransform* transformation) override {}
+	void fillRadialGradient (CGraphicsPath* path, const CGradient& gradient, const CPoint& center, CCoord radius, const CPoint& originOffset, bool evenOdd, CGraphicsTransform* transformation) override {}
+};
+
+//------------------------------------------------------------------------
+struct DataBrowserInFrame
+{
+	DataBrowserInFrame (int32_t style = CDataBrowser::kMultiSelectionStyle)
+	{
+		frame = owned (new CFrame (CRect (0, 0, 100, 50), nullptr));
+		browser = new CDataBrowser (
+			CRect (0, 0, 100, 50), &delegate,
+			style | CScrollView::kVerticalScrollbar | CScrollView::kDontDrawFrame, 10);
+		frame->addView (browser);
+		frame->attached (frame);
+	}
+	~DataBrowserInFrame () { frame->close (); }
+
+	void draw ()
+	{
+		delegate.drawnRows.clear ();
+		delegate.drawnColumns.clear ();
+		delegate.drawnSelectedRows.clear ();
+		auto context = owned (new NoDrawContext (browser->getViewSize ()));
+		browser->drawRect (context, browser->getViewSize ());
+	}
+
+	TestDelegate delegate;
+	SharedPointer<CFrame> frame;
+	CDataBrowser* browser;
+};
+
+} // anonymous
+
+//------------------------------------------------------------------------
+TESTCASE(CDataBrowserRowSetTest,
+
+	TEST(addAndContains,
+		CDataBrowser::RowSet set;
+		EXPECT (set.empty ());
+		EXPECT (set.first () == CDataBrowser::kNoSelection);
+		set.add (5, 10);
+		set.add (20);
+		EXPECT (set.size () == 7);
+		EXPECT (set.getNumRanges () == 2);
+		EXPECT (set.first () == 5);
+		EXPECT (set.contains (5));
+		EXPECT (set.contains (10));
+		EXPECT (set.contains (20));
+		EXPECT (set.contains (4) == false);
+		EXPECT (set.contains (11) == false);
+		EXPECT (set.contains (21) == false);
+	);
+
+	TEST(addMergesAdjacentAndOverlappingRanges,
+		CDataBrowser::RowSet set;
+		set.add (0, 4);
+		set.add (10, 14);
+		set.add (5);
+		EXPECT (set.getNumRanges () == 2);
+		set.add (3, 12);
+		EXPECT (set.getNumRanges () == 1);
+		EXPECT (set.size () == 15);
+		set.add (2, 6);
+		EXPECT (set.size () == 15);
+	);
+
+	TEST(removeSplitsRanges,
+		CDataBrowser::RowSet set;
+		set.add (0, 99);
+		set.remove (10, 19);
+		EXPECT (set.getNumRanges () == 2);
+		EXPECT (set.size () == 90);
+		EXPECT (set.contains (9));
+		EXPECT (set.contains (10) == false);
+		EXPECT (set.contains (19) == false);
+		EXPECT (set.contains (20));
+		set.remove (5, 50);
+		EXPECT (set.size () == 54);
+		set.remove (0, 1000);
+		EXPECT (set.empty ());
+		EXPECT (set.size () == 0);
+	);
+
+	TEST(forEachRange,
+		CDataBrowser::RowSet set;
+		set.add (8);
+		set.add (1, 2);
+		std::vector<int32_t> ranges;
+		set.forEachRange ([&] (int32_t first, int32_t last) {
+			ranges.push_back (first);
+			ranges.push_back (last);
+		});
+		EXPECT (ranges == std::vector<int32_t> ({1, 2, 8, 8}));
+	);
+);
+
+//------------------------------------------------------------------------
+TESTCASE(CDataBrowserTest,
+
+	TEST(selectRows,
+		DataBrowserInFrame b;
+		b.browser->selectRows (10, 1009);
+		EXPECT (b.delegate.selectionChangedCount == 1);
+		EXPECT (b.browser->getSelectedRows ().size () == 1000);
+		EXPECT (b.browser->isRowSelected (10));
+		EXPECT (b.browser->isRowSelected (1009));
+		EXPECT (b.browser->isRowSelected (1010) == false);
+		EXPECT (b.browser->getSelectedRow () == 10);
+		b.browser->unselectRow (500);
+		EXPECT (b.browser->getSelectedRows ().size () == 999);
+		EXPECT (b.browser->getSelection ().size () == 999);
+		EXPECT (b.browser->getSelection ()[490] == 501);
+		b.browser->unselectAll ();
+		EXPECT (b.browser->getSelection ().empty ());
+	);
+
+	TEST(selectRowsNeedsMultiSelection,
+		DataBrowserInFrame b (0);
+		b.browser->selectRows (0, 10);
+		EXPECT (b.browser->getSelectedRows ().empty ());
+		b.browser->selectRow (3);
+		b.browser->selectRow (4);
+		EXPECT (b.browser->getSelection () == CDataBrowser::Selection {4});
+	);
+
+	TEST(setSelectedRow,
+		DataBrowserInFrame b;
+		b.browser->selectRows (0, 10);
+		b.browser->setSelectedRow (20);
+		EXPECT (b.browser->getSelection () == CDataBrowser::Selection {20});
+		EXPECT (b.browser->getLastSelectedRow () == 20);
+	);
+
+	TEST(selectionKeepsSelectionOrder,
+		DataBrowserInFrame b;
+		b.browser->selectRow (30);
+		b.browser->selectRow (10);
+		b.browser->selectRows (8, 12);
+		b.browser->selectRow (20);
+		EXPECT (b.browser->getSelectedRow () == 30);
+		CDataBrowser::Selection expected ({30, 10, 8, 9, 11, 12, 20});
+		EXPECT (b.browser->getSelection () == expected);
+		b.browser->unselectRow (30);
+		EXPECT (b.browser->getSelectedRow () == 10);
+		b.browser->unselectRow (9);
+		expected = CDataBrowser::Selection ({10, 8, 11, 12, 20});
+		EXPECT (b.browser->getSelection () == expected);
+	);
+
+	TEST(unselectRowMovesAnchor,
+		DataBrowserInFrame b;
+		b.browser->selectRow (5);
+		b.browser->selectRow (15);
+		b.browser->selectRow (10);
+		EXPECT (b.browser->getLastSelectedRow () == 10);
+		b.browser->unselectRow (10);
+		EXPECT (b.browser->getLastSelectedRow () == 15);
+		b.browser->unselectRow (5);
+		EXPECT (b.browser->getLastSelectedRow () == 15);
+		b.browser->unselectRow (15);
+		EXPECT (b.browser->getLastSelectedRow () == CDataBrowser::kNoSelection);
+	);
+
+	TEST(selectionIsValidatedOnLayout,
+		DataBrowserInFrame b;
+		b.browser->selectRows (5, 50);
+		b.delegate.numRows = 10;
+		b.browser->recalculateLayout (true);
+		EXPECT (b.browser->getSelectedRows ().size () == 5);
+		EXPECT (b.browser->isRowSelected (9));
+		EXPECT (b.browser->getSelection ().size () == 5);
+		EXPECT (b.browser->getSelection ().back () == 9);
+	);
+
+	TEST(drawOnlyVisibleRows,
+		DataBrowserInFrame b;
+		b.browser->selectRow (2);
+		b.draw ();
+		EXPECT (b.delegate.drawnRows.size () == 5);
+		EXPECT (*b.delegate.drawnRows.rbegin () == 4);
+		EXPECT (b.delegate.drawnColumns.size () == 3);
+		EXPECT (b.delegate.drawnSelectedRows.size () == 1);
+		EXPECT (b.delegate.drawnSelectedRows.count (2) == 1);
+		b.browser->makeRowVisible (50000);
+		b.draw ();
+		EXPECT (b.delegate.drawnRows.size () <= 6);
+		EXPECT (b.delegate.drawnRows.count (50000) == 1);
+	);
+
+	TEST(cellAt,
+		DataBrowserInFrame b;
+		auto cell = b.browser->getCellAt (CPoint (45, 25));
+		EXPECT (cell.row == 2);
+		EXPECT (cell.column == 1);
+		EXPECT (b.browser->getCellBounds (cell) == CRect (40, 20, 80, 30));
+	);
+);
+
+} // VSTGUI
@@ -0,0 +1,236 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../lib/cdisplaylist.h"
+#include "../../../lib/cdrawcontext.h"
+#include "../../../lib/cframe.h"
+#include "../unittests.h"
+#include <vector>
+
+namespace VSTGUI {
+
+namespace {
+
+//------------------------------------------------------------------------
+class LoggingContext : public CDrawContext
+{
+public:
+	LoggingContext (const CRect& r) : CDrawContext (r) { init (); }
+
+	void setFillColor (const CColor& color) override
+	{
+		++numFillColorChanges;
+		CDrawContext::setFillColor (color);
+	}
+	void drawRect (const CRect& rect, const CDrawStyle drawStyle) override
+	{
+		CRect r (rect);
+		getCurrentTransform ().transform (r);
+		drawnRects.push_back (r);
+		drawnFillColors.push_back (getFillColor ());
+		drawnAlphas.push_back (getGlobalAlpha ());
+		clips.push_back (getAbsoluteClipRect ());
+	}
+
+	void drawLine (const LinePair& line) override {}
+	void drawLines (const LineList& lines) override {}
+	void drawPolygon (const PointList& polygonPointList, const CDrawStyle drawStyle) override {}
+	void drawArc (const CRect& rect, const float startAngle1, const float endAngle2, const CDrawStyle drawStyle) override {}
+	void drawEllipse (const CRect& rect, const CDrawStyle drawStyle) override {}
+	void drawPoint (const CPoint& point, const CColor& color) override {}
+	void drawBitmap (CBitmap* bitmap, const CRect& dest, const CPoint& offset, float alpha) override {}
+	void clearRect (const CRect& rect) override {}
+	CGraphicsPath* createGraphicsPath () override { return nullptr; }
+	CGraphicsPath* createTextPath (const CFontRef font, UTF8StringPtr text) override { return nullptr; }
+	void drawGraphicsPath (CGraphicsPath* path, PathDrawMode mode, CGraphicsTransform* transformation) override {}
+	void fillLinearGradient (CGraphicsPath* path, const CGradient& gradient, const CPoint& startPoint, const CPoint& endPoint, bool evenOdd, CGraphicsTransform* transformation) override {}
+	void fillRadialGradient (CGraphicsPath* path, const CGradient& gradient, const CPoint& center, CCoord radius, const CPoint& originOffset, bool evenOdd, CGraphicsTransform* transformation) override {}
+
+	uint32_t numFillColorChanges {0};
+	std::vector<CRect> drawnRects;
+	std::vector<CColor> drawnFillColors;
+	std::vector<float> drawnAlphas;
+	std::vector<CRect> clips;
+};
+
+//------------------------------------------------------------------------
+class CachedView : public CView
+{
+public:
+	CachedView (const CRect& r) : CView (r) { setDisplayListCacheEnabled (true); }
+
+	void draw (CDrawContext* context) override
+	{
+		++numDrawCalls;
+		context->setFillColor (kRedCColor);
+		context->drawRect (getViewSize (), kDrawFilled);
+		setDirty (false);
+	}
+
+	uint32_t numDrawCalls {0};
+};
+
+//------------------------------------------------------------------------
+static void drawThreeRects (CDrawContext* context)
+{
+	for (auto i = 0; i < 3; ++i)
+	{
+		context->setFillColor (kRedCColor);
+		context->drawRect (CRect (0, 0, 10, 10).offset (i * 10, 0), kDrawFilled);
+	}
+}
+
+} // anonymous
+
+//------------------------------------------------------------------------
+TESTCASE(CDisplayListTest,
+
+	TEST(recordAndReplay,
+		auto displayList = CDisplayList::record (CRect (0, 0, 100, 100), 1., drawThreeRects);
+		EXPECT (displayList);
+		auto context = owned (new LoggingContext (CRect (0, 0, 100, 100)));
+		displayList->replay (context);
+		EXPECT (context->drawnRects.size () == 3);
+		EXPECT (context->drawnRects[2] == CRect (20, 0, 30, 10));
+		EXPECT (context->drawnFillColors[0] == kRedCColor);
+	);
+
+	TEST(unchangedStateIsRecordedOnce,
+		auto displayList = CDisplayList::record (CRect (0, 0, 100, 100), 1., drawThreeRects);
+		// clip, transform, draw mode, global alpha, fill color and the three rects
+		EXPECT (displayList->getNumCommands () == 8);
+	);
+
+	TEST(replaySkipsRedundantStateChanges,
+		auto displayList = CDisplayList::record (CRect (0, 0, 100, 100), 1., drawThreeRects);
+		auto context = owned (new LoggingContext (CRect (0, 0, 100, 100)));
+		context->setFillColor (kRedCColor);
+		context->numFillColorChanges = 0;
+		displayList->replay (context);
+		EXPECT (context->numFillColorChanges == 0);
+		context->setFillColor (kBlueCColor);
+		context->numFillColorChanges = 0;
+		displayList->replay (context);
+		EXPECT (context->numFillColorChanges == 1);
+		EXPECT (context->getFillColor () == kBlueCColor);
+	);
+
+	TEST(replayWithOffset,
+		auto displayList = CDisplayList::record (CRect (0, 0, 100, 100), 1., drawThreeRects);
+		auto context = owned (new LoggingContext (CRect (0, 0, 200, 200)));
+		displayList->replay (context, CPoint (50, 20));
+		EXPECT (context->drawnRects[0] == CRect (50, 20, 60, 30));
+		EXPECT (context->clips[0] == CRect (50, 20, 150, 120));
+	);
+
+	TEST(replayRespectsClipAndAlphaOfTarget,
+		auto displayList = CDisplayList::record (CRect (0, 0, 100, 100), 1., [] (CDrawContext* context) {
+			context->setGlobalAlpha (0.5f);
+			drawThreeRects (context);
+		});
+		auto context = owned (new LoggingContext (CRect (0, 0, 100, 100)));
+		context->setClipRect (CRect (5, 5, 15, 15));
+		context->setGlobalAlpha (0.5f);
+		displayList->replay (context);
+		EXPECT (context->clips[0] == CRect (5, 5, 15, 15));
+		EXPECT (context->drawnAlphas[0] == 0.25f);
+		EXPECT (context->getGlobalAlpha () == 0.5f);
+	);
+
+	TEST(transformIsRecorded,
+		auto displayList = CDisplayList::record (CRect (0, 0, 100, 100), 1., [] (CDrawContext* context) {
+			CDrawContext::Transform t (*context, CGraphicsTransform ().translate (5, 5));
+			context->drawRect (CRect (0, 0, 10, 10), kDrawFilled);
+		});
+		auto context = owned (new LoggingContext (CRect (0, 0, 100, 100)));
+		displayList->replay (context, CPoint (10, 0));
+		EXPECT (context->drawnRects[0] == CRect (15, 5, 25, 15));
+	);
+
+	TEST(recordingScaleFactor,
+		double scaleFactor = 0.;
+		CDisplayList::record (CRect (0, 0, 10, 10), 2., [&] (CDrawContext* context) {
+			scaleFactor = context->getScaleFactor ();
+		});
+		EXPECT (scaleFactor == 2.);
+	);
+
+	TEST(batchedRectsAreRecordedAsOneCommand,
+		auto displayList = CDisplayList::record (CRect (0, 0, 100, 100), 1., [] (CDrawContext* context) {
+			CDrawContext::RectList rects;
+			for (auto i = 0; i < 3; ++i)
+				rects.push_back (CRect (0, 0, 10, 10).offset (i * 10, 0));
+			context->drawRects (rects, kDrawFilled);
+		});
+		// clip, transform, draw mode, global alpha, fill color and the rect list
+		EXPECT (displayList->getNumCommands () == 6);
+		auto context = owned (new LoggingContext (CRect (0, 0, 100, 100)));
+		displayList->replay (context);
+		EXPECT (context->drawnRects.size () == 3);
+		EXPECT (context->drawnRects[1] == CRect (10, 0, 20, 10));
+	);
+
+	TEST(textPathsCannotBeRecorded,
+		auto displayList = CDisplayList::record (CRect (0, 0, 10, 10), 1., [] (CDrawContext* context) {
+			EXPECT (context->createTextPath (kSystemFont, "Text") == nullptr);
+		});
+		EXPECT (displayList == nullptr);
+	);
+);
+
+//------------------------------------------------------------------------
+TESTCASE(CViewDisplayListCacheTest,
+
+	TEST(cacheIsUsedUntilViewIsInvalidated,
+		CRect r (0, 0, 100, 100);
+		auto frame = owned (new CFrame (r, nullptr));
+		auto view = new CachedView (CRect (10, 10, 50, 50));
+		frame->addView (view);
+		frame->attached (frame);
+		auto context = owned (new LoggingContext (r));
+		view->drawRectCached (context, view->getViewSize ());
+		view->drawRectCached (context, view->getViewSize ());
+		EXPECT (view->numDrawCalls == 1);
+		EXPECT (context->drawnRects.size () == 2);
+		view->invalid ();
+		view->drawRectCached (context, view->getViewSize ());
+		EXPECT (view->numDrawCalls == 2);
+		view->setDirty (true);
+		view->drawRectCached (context, view->getViewSize ());
+		EXPECT (view->numDrawCalls == 3);
+		EXPECT (view->isDirty () == false);
+		frame->close ();
+	);
+
+	TEST(movedViewReplaysAtNewPosition,
+		CRect r (0, 0, 100, 100);
+		auto frame = owned (new CFrame (r, nullptr));
+		auto view = new CachedView (CRect (10, 10, 50, 50));
+		frame->addView (view);
+		frame->attached (frame);
+		auto context = owned (new LoggingContext (r));
+		view->drawRectCached (context, view->getViewSize ());
+		// moving without invalidating, like scroll views do
+		view->setViewSize (CRect (20, 10, 60, 50), false);
+		view->drawRectCached (context, view->getViewSize ());
+		EXPECT (view->numDrawCalls == 1);
+		EXPECT (context->drawnRects.back () == CRect (20, 10, 60, 50));
+		view->setViewSize (CRect (20, 10, 80, 50), false);
+		view->drawRectCached (context, view->getViewSize ());
+		EXPECT (view->numDrawCalls == 2);
+		EXPECT (context->drawnRects.back () == CRect (20, 10, 80, 50));
+		frame->close ();
+	);
+
+	TEST(disabledCacheDrawsDirectly,
+		auto view = owned (new CachedView (CRect (0, 0, 10, 10)));
+		view->setDisplayListCacheEnabled (false);
+		auto context = owned (new LoggingContext (CRect (0, 0, 10, 10)));
+		view->drawRectCached (context, view->getViewSize ());
+		view->drawRectCached (context, view->getViewSize ());
+		EXPECT (view->numDrawCalls == 2);
+	);
+);
+
+} // VSTGUI
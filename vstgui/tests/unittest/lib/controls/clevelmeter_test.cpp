@@ -0,0 +1,156 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../../lib/controls/clevelmeter.h"
+#include "../../../../lib/cframe.h"
+#include "../../unittests.h"
+#include <cmath>
+#include <vector>
+
+namespace VSTGUI {
+
+namespace {
+
+class CollectInvalidRectContainer : public CViewContainer
+{
+public:
+	std::vector<CRect> invalidRects;
+
+	CollectInvalidRectContainer () : CViewContainer (CRect (0, 0, 100, 100)) {}
+
+	void invalidRect (const CRect& rect) override { invalidRects.push_back (rect); }
+};
+
+bool isNear (float a, float b)
+{
+	return std::abs (a - b) < 0.0001f;
+}
+
+} // anonymous
+
+TESTCASE(LevelMeterModelTest,
+
+	TEST(peakAttackAndRelease,
+		LevelMeterModel model;
+		model.setInput (1.f);
+		model.advance (0);
+		EXPECT (model.getPeak () == 1.f);
+		model.setInput (0.f);
+		model.advance (100);
+		EXPECT (isNear (model.getPeak (), 0.85f));
+		model.advance (1000);
+		EXPECT (model.getPeak () == 0.f);
+	);
+
+	TEST(peakOfInputsBetweenAdvance,
+		LevelMeterModel model;
+		model.setInput (0.8f);
+		model.setInput (0.2f);
+		model.advance (10);
+		EXPECT (model.getPeak () == 0.8f);
+	);
+
+	TEST(rmsIntegration,
+		LevelMeterModel model;
+		model.setInput (1.f);
+		model.advance (300);
+		EXPECT (isNear (model.getRMS (), static_cast<float> (std::sqrt (1. - std::exp (-1.)))));
+		model.advance (10000);
+		EXPECT (isNear (model.getRMS (), 1.f));
+	);
+
+	TEST(peakHold,
+		LevelMeterModel model;
+		LevelMeterModel::Ballistics ballistics;
+		ballistics.holdTime = 500.;
+		ballistics.holdRelease = 1.;
+		model.setBallistics (ballistics);
+		model.setInput (1.f);
+		model.advance (0);
+		model.setInput (0.f);
+		model.advance (400);
+		EXPECT (model.getHold () == 1.f);
+		model.advance (200);
+		EXPECT (model.getHold () == 1.f);
+		model.advance (100);
+		EXPECT (isNear (model.getHold (), 0.9f));
+	);
+
+	TEST(reset,
+		LevelMeterModel model;
+		model.setInput (1.f);
+		model.advance (100);
+		model.reset ();
+		EXPECT (model.getPeak () == 0.f);
+		EXPECT (model.getRMS () == 0.f);
+		EXPECT (model.getHold () == 0.f);
+	);
+);
+
+TESTCASE(CLevelMeterTest,
+
+	TEST(segmentRects,
+		auto meter = owned (new CLevelMeter (CRect (0, 0, 10, 100), 10));
+		meter->setSegmentSpacing (0.);
+		EXPECT (meter->getSegmentRect (0) == CRect (0, 90, 10, 100));
+		EXPECT (meter->getSegmentRect (9) == CRect (0, 0, 10, 10));
+		meter->setStyle (CLevelMeter::kHorizontal | CLevelMeter::kShowPeak);
+		meter->setViewSize (CRect (0, 0, 100, 10));
+		EXPECT (meter->getSegmentRect (0) == CRect (0, 0, 10, 10));
+		EXPECT (meter->getSegmentRect (9) == CRect (90, 0, 100, 10));
+	);
+
+	TEST(segmentStates,
+		auto meter = owned (new CLevelMeter (CRect (0, 0, 10, 100), 10, CLevelMeter::kVertical | CLevelMeter::kShowPeak | CLevelMeter::kShowRMS | CLevelMeter::kShowHold));
+		LevelMeterModel::Ballistics ballistics;
+		ballistics.rmsWindow = 0.;
+		meter->getModel ().setBallistics (ballistics);
+		meter->setValue (0.5f);
+		meter->advance (0);
+		EXPECT (meter->getSegmentState (0) == CLevelMeter::SegmentState::kRMS);
+		EXPECT (meter->getSegmentState (4) == CLevelMeter::SegmentState::kRMS);
+		EXPECT (meter->getSegmentState (5) == CLevelMeter::SegmentState::kOff);
+		meter->setValue (0.f);
+		meter->advance (200);
+		EXPECT (meter->getSegmentState (0) == CLevelMeter::SegmentState::kPeak);
+		EXPECT (meter->getSegmentState (1) == CLevelMeter::SegmentState::kPeak);
+		EXPECT (meter->getSegmentState (2) == CLevelMeter::SegmentState::kOff);
+		EXPECT (meter->getSegmentState (4) == CLevelMeter::SegmentState::kHold);
+	);
+
+	TEST(valueChangeDoesNotDirtyView,
+		auto meter = owned (new CLevelMeter (CRect (0, 0, 10, 100), 10));
+		meter->setDirty (false);
+		meter->setValue (1.f);
+		EXPECT (meter->isDirty () == false);
+	);
+
+	TEST(invalidChangedSegmentsOnly,
+		auto frame = owned (new CFrame (CRect (0, 0, 100, 100), nullptr));
+		auto container = new CollectInvalidRectContainer ();
+		auto meter = new CLevelMeter (CRect (0, 0, 10, 100), 10);
+		meter->setSegmentSpacing (0.);
+		container->addView (meter);
+		frame->addView (container);
+		frame->attached (frame);
+
+		meter->setValue (0.5f);
+		meter->advance (0);
+		EXPECT (container->invalidRects.size () == 1);
+		EXPECT (container->invalidRects[0] == CRect (0, 50, 10, 100));
+		container->invalidRects.clear ();
+
+		meter->advance (10);
+		EXPECT (container->invalidRects.empty ());
+
+		meter->setValue (0.f);
+		meter->advance (200);
+		EXPECT (container->invalidRects.size () == 1);
+		EXPECT (container->invalidRects[0] == CRect (0, 60, 10, 80));
+
+		frame->close ();
+	);
+);
+
+} // VSTGUI
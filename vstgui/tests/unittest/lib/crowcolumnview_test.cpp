@@ -0,0 +1,165 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../lib/crowcolumnview.h"
+#include "../../../lib/cdisplaylist.h"
+#include "../../../lib/cframe.h"
+#include "../unittests.h"
+
+namespace VSTGUI {
+
+namespace {
+
+//------------------------------------------------------------------------
+class CountingRowColumnView : public CRowColumnView
+{
+public:
+	CountingRowColumnView (const CRect& size) : CRowColumnView (size) {}
+
+	void layoutViews () override
+	{
+		++numLayouts;
+		CRowColumnView::layoutViews ();
+	}
+
+	uint32_t numLayouts {0};
+};
+
+//------------------------------------------------------------------------
+struct RowColumnViewInFrame
+{
+	RowColumnViewInFrame ()
+	{
+		frame = owned (new CFrame (CRect (0, 0, 100, 100), nullptr));
+		rowColumnView = new CountingRowColumnView (CRect (0, 0, 100, 100));
+		frame->addView (rowColumnView);
+		frame->attached (frame);
+		rowColumnView->numLayouts = 0;
+	}
+	~RowColumnViewInFrame () { frame->close (); }
+
+	void addRows (CViewContainer* container, uint32_t numRows)
+	{
+		for (auto i = 0u; i < numRows; ++i)
+			container->addView (new CView (CRect (0, 0, 10, 10)));
+	}
+
+	void draw ()
+	{
+		CDisplayList::record (frame->getViewSize (), 1., [&] (CDrawContext* context) {
+			frame->drawRect (context, frame->getViewSize ());
+		});
+	}
+
+	SharedPointer<CFrame> frame;
+	CountingRowColumnView* rowColumnView;
+};
+
+} // anonymous
+
+//------------------------------------------------------------------------
+TESTCASE(CRowColumnViewTest,
+
+	TEST(layoutWhenAttached,
+		auto frame = owned (new CFrame (CRect (0, 0, 100, 100), nullptr));
+		auto rowColumnView = new CountingRowColumnView (CRect (0, 0, 100, 100));
+		for (auto i = 0; i < 3; ++i)
+			rowColumnView->addView (new CView (CRect (0, 0, 10, 10)));
+		EXPECT (rowColumnView->numLayouts == 0);
+		frame->addView (rowColumnView);
+		frame->attached (frame);
+		EXPECT (rowColumnView->numLayouts == 1);
+		EXPECT (rowColumnView->needsLayout () == false);
+		EXPECT (rowColumnView->getView (2)->getViewSize () == CRect (0, 20, 10, 30));
+		frame->close ();
+	);
+
+	TEST(changesAreLayoutedOnce,
+		RowColumnViewInFrame s;
+		s.addRows (s.rowColumnView, 64);
+		s.rowColumnView->setSpacing (2.);
+		s.rowColumnView->setMargin (CRect (1., 1., 1., 1.));
+		EXPECT (s.rowColumnView->numLayouts == 0);
+		EXPECT (s.rowColumnView->needsLayout ());
+		s.frame->performScheduledLayouts ();
+		EXPECT (s.rowColumnView->numLayouts == 1);
+		EXPECT (s.rowColumnView->needsLayout () == false);
+		EXPECT (s.rowColumnView->getView (1)->getViewSize () == CRect (1, 13, 11, 23));
+		EXPECT (s.frame->getLayoutStatistics ().numPasses == 1);
+		EXPECT (s.frame->getLayoutStatistics ().numLayoutsLastPass == 1);
+	);
+
+	TEST(childSizeChangeIsLayoutedOnce,
+		RowColumnViewInFrame s;
+		s.addRows (s.rowColumnView, 4);
+		s.frame->performScheduledLayouts ();
+		s.rowColumnView->numLayouts = 0;
+		s.rowColumnView->forEachChild ([] (CView* view) {
+			CRect r (view->getViewSize ());
+			r.setHeight (20);
+			view->setViewSize (r);
+		});
+		EXPECT (s.rowColumnView->numLayouts == 0);
+		s.frame->performScheduledLayouts ();
+		EXPECT (s.rowColumnView->numLayouts == 1);
+		EXPECT (s.rowColumnView->getView (3)->getViewSize () == CRect (0, 60, 10, 80));
+	);
+
+	TEST(layoutIfNeeded,
+		RowColumnViewInFrame s;
+		s.addRows (s.rowColumnView, 2);
+		EXPECT (s.rowColumnView->layoutIfNeeded ());
+		EXPECT (s.rowColumnView->getView (1)->getViewSize () == CRect (0, 10, 10, 20));
+		EXPECT (s.rowColumnView->layoutIfNeeded () == false);
+		s.frame->performScheduledLayouts ();
+		EXPECT (s.rowColumnView->numLayouts == 1);
+	);
+
+	TEST(nestedViewsAreLayoutedTopDown,
+		RowColumnViewInFrame s;
+		auto inner = new CountingRowColumnView (CRect (0, 0, 100, 50));
+		inner->setLayoutStyle (CRowColumnView::kStretchEqualy);
+		s.addRows (inner, 2);
+		s.rowColumnView->setLayoutStyle (CRowColumnView::kStretchEqualy);
+		s.rowColumnView->addView (inner);
+		s.frame->performScheduledLayouts ();
+		inner->numLayouts = 0;
+		s.rowColumnView->numLayouts = 0;
+		s.addRows (inner, 2);
+		s.rowColumnView->setMargin (CRect (10., 0., 10., 0.));
+		s.frame->performScheduledLayouts ();
+		EXPECT (s.rowColumnView->numLayouts == 1);
+		EXPECT (inner->numLayouts == 1);
+		EXPECT (inner->getView (3)->getViewSize () == CRect (0, 30, 80, 40));
+		EXPECT (s.frame->getLayoutStatistics ().numLayoutsLastPass == 2);
+	);
+
+	TEST(removedViewIsNotLayouted,
+		RowColumnViewInFrame s;
+		auto view = shared (s.rowColumnView);
+		s.addRows (s.rowColumnView, 2);
+		s.frame->removeView (view, false);
+		EXPECT (view->needsLayout () == false);
+		s.frame->performScheduledLayouts ();
+		EXPECT (view->numLayouts == 0);
+	);
+
+	TEST(drawPerformsScheduledLayouts,
+		RowColumnViewInFrame s;
+		s.addRows (s.rowColumnView, 2);
+		s.frame->performScheduledLayouts ();
+		s.rowColumnView->setSpacing (5.);
+		s.draw ();
+		EXPECT (s.rowColumnView->needsLayout () == false);
+		EXPECT (s.rowColumnView->getView (1)->getViewSize () == CRect (0, 15, 10, 25));
+		EXPECT (s.frame->getLayoutStatistics ().numPasses == 2);
+		EXPECT (s.frame->getLayoutStatistics ().numPassesLastFrame == 2);
+		s.draw ();
+		EXPECT (s.frame->getLayoutStatistics ().numPassesLastFrame == 0);
+		s.frame->resetLayoutStatistics ();
+		EXPECT (s.frame->getLayoutStatistics ().numPasses == 0);
+	);
+);
+
+} // VSTGUI
@@ -0,0 +1,166 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../lib/cscrollview.h"
+#include "../../../lib/cframe.h"
+#include "../../../lib/controls/cscrollbar.h"
+#include "../unittests.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace VSTGUI {
+
+namespace {
+
+//------------------------------------------------------------------------
+/** records the rects invalidated by its subviews, a blitted scroll invalidates the frame directly */
+struct InvalidRectRecorder : CViewContainer
+{
+	InvalidRectRecorder () : CViewContainer (CRect (0, 0, 100, 100)) {}
+
+	void invalidRect (const CRect& rect) override
+	{
+		invalidRects.emplace_back (rect);
+		CViewContainer::invalidRect (rect);
+	}
+
+	bool wasInvalidated (const CRect& rect) const
+	{
+		return std::any_of (invalidRects.begin (), invalidRects.end (),
+		                    [&] (CRect r) { return r.bound (rect) == rect; });
+	}
+
+	std::vector<CRect> invalidRects;
+};
+
+//------------------------------------------------------------------------
+struct ScrollViewInFrame
+{
+	ScrollViewInFrame (int32_t style)
+	{
+		frame = owned (new CFrame (CRect (0, 0, 100, 100), nullptr));
+		recorder = new InvalidRectRecorder ();
+		scrollView = new CScrollView (CRect (0, 0, 100, 100), CRect (0, 0, 100, 1000),
+		                              style | CScrollView::kDontDrawFrame);
+		view = new CView (CRect (0, 0, 100, 1000));
+		scrollView->addView (view);
+		recorder->addView (scrollView);
+		frame->addView (recorder);
+		frame->attached (frame);
+		container = view->getParentView ()->asViewContainer ();
+	}
+	~ScrollViewInFrame () { frame->close (); }
+
+	SharedPointer<CFrame> frame;
+	InvalidRectRecorder* recorder;
+	CScrollView* scrollView;
+	CViewContainer* container;
+	CView* view;
+};
+
+//------------------------------------------------------------------------
+void scrollToMiddle (CScrollView* scrollView)
+{
+	auto scrollbar = scrollView->getVerticalScrollbar ();
+	scrollbar->setValue (0.5f);
+	scrollView->valueChanged (scrollbar);
+}
+
+//------------------------------------------------------------------------
+void scrollDownBy10 (CScrollView* scrollView)
+{
+	auto scrollbar = scrollView->getVerticalScrollbar ();
+	auto range = scrollView->getContainerSize ().getHeight () - scrollView->getVerticalScrollbar ()->getHeight ();
+	scrollbar->setValue (static_cast<float> (10. / range));
+	scrollView->valueChanged (scrollbar);
+}
+
+} // anonymous
+
+//------------------------------------------------------------------------
+TESTCASE(CScrollViewTest,
+
+	TEST(scrollMovesSubviews,
+		ScrollViewInFrame s (CScrollView::kVerticalScrollbar);
+		scrollToMiddle (s.scrollView);
+		EXPECT (s.scrollView->getScrollOffset () == CPoint (0, 450));
+		EXPECT (s.view->getViewSize () == CRect (0, -450, 100, 550));
+		EXPECT (s.container->getTransform () == CGraphicsTransform ());
+	);
+
+	TEST(scrollByTransform,
+		ScrollViewInFrame s (CScrollView::kVerticalScrollbar | CScrollView::kScrollByTransform);
+		scrollToMiddle (s.scrollView);
+		EXPECT (s.scrollView->getScrollOffset () == CPoint (0, 450));
+		EXPECT (s.view->getViewSize () == CRect (0, 0, 100, 1000));
+		CPoint p (0, 450);
+		s.container->getTransform ().transform (p);
+		EXPECT (p == CPoint (0, 0));
+		EXPECT (s.view->getVisibleViewSize () == CRect (0, 450, s.container->getWidth (), 550));
+		EXPECT (s.frame->getViewAt (CPoint (50, 50), GetViewOptions ().deep ()) == s.view);
+	);
+
+	TEST(switchScrollByTransform,
+		ScrollViewInFrame s (CScrollView::kVerticalScrollbar);
+		scrollToMiddle (s.scrollView);
+		s.scrollView->setStyle (s.scrollView->getStyle () | CScrollView::kScrollByTransform);
+		EXPECT (s.view->getViewSize () == CRect (0, 0, 100, 1000));
+		EXPECT (s.container->getTransform () == CGraphicsTransform ().translate (0, -450));
+		s.scrollView->setStyle (s.scrollView->getStyle () & ~CScrollView::kScrollByTransform);
+		EXPECT (s.view->getViewSize () == CRect (0, -450, 100, 550));
+		EXPECT (s.container->getTransform () == CGraphicsTransform ());
+	);
+
+	TEST(fractionalContainerSizeScrollsByIntegralOffsets,
+		ScrollViewInFrame s (CScrollView::kVerticalScrollbar);
+		scrollToMiddle (s.scrollView);
+		s.scrollView->setContainerSize (CRect (0, 0, 100, 100.6));
+		auto offset = s.scrollView->getScrollOffset ();
+		EXPECT (offset.y == std::floor (offset.y));
+		EXPECT (s.view->getViewSize ().top == -offset.y);
+	);
+
+	TEST(fractionalContainerSizeScrollsByIntegralTransform,
+		ScrollViewInFrame s (CScrollView::kVerticalScrollbar | CScrollView::kScrollByTransform);
+		scrollToMiddle (s.scrollView);
+		s.scrollView->setContainerSize (CRect (0, 0, 100, 100.6));
+		auto offset = s.scrollView->getScrollOffset ();
+		EXPECT (offset.y == std::floor (offset.y));
+		EXPECT (s.container->getTransform () == CGraphicsTransform ().translate (0, -offset.y));
+	);
+
+	TEST(opaqueScrollViewIsBlitted,
+		ScrollViewInFrame s (CScrollView::kVerticalScrollbar);
+		scrollDownBy10 (s.scrollView);
+		EXPECT (s.scrollView->getScrollOffset () == CPoint (0, 10));
+		auto containerSize = s.container->getViewSize ();
+		EXPECT (s.recorder->wasInvalidated (containerSize) == false);
+	);
+
+	TEST(transparentScrollViewIsNotBlitted,
+		ScrollViewInFrame s (CScrollView::kVerticalScrollbar);
+		s.scrollView->setTransparency (true);
+		scrollDownBy10 (s.scrollView);
+		EXPECT (s.scrollView->getScrollOffset () == CPoint (0, 10));
+		EXPECT (s.recorder->wasInvalidated (s.container->getViewSize ()));
+	);
+
+	TEST(onlyOpaqueFlagMakesScrollViewOpaque,
+		ScrollViewInFrame s (CScrollView::kVerticalScrollbar);
+		EXPECT (s.scrollView->getBackgroundColor ().alpha == 255);
+		EXPECT (s.scrollView->isOpaque () == false);
+		s.scrollView->setOpaque (true);
+		EXPECT (s.scrollView->isOpaque ());
+	);
+
+	TEST(overlayScrollbarsAreNotBlitted,
+		ScrollViewInFrame s (CScrollView::kVerticalScrollbar | CScrollView::kOverlayScrollbars);
+		scrollDownBy10 (s.scrollView);
+		EXPECT (s.scrollView->getScrollOffset () == CPoint (0, 10));
+		EXPECT (s.recorder->wasInvalidated (s.container->getViewSize ()));
+	);
+);
+
+} // VSTGUI
@@ -6,7 +6,9 @@
 #include "../../../lib/iviewlistener.h"
 #include "../../../lib/ccolor.h"
 #include "../../../lib/dragging.h"
+#include "../../../lib/cdrawcontext.h"
 #include "../unittests.h"
+#include <map>
 #include <vector>
 
 namespace VSTGUI {
@@ -31,6 +33,41 @@ public:
 	bool transformChangedCalled {false};
 };
 
+class SizeChangeCounter : public ViewListenerAdapter
+{
+public:
+	void viewSizeChanged (CView* view, const CRect& oldSize) override
+	{
+		++numChanges[view];
+		oldSizes[view] = oldSize;
+	}
+
+	std::map<CView*, uint32_t> numChanges;
+	std::map<CView*, CRect> oldSizes;
+};
+
+class ParentSizeChangedView : public CView
+{
+public:
+	ParentSizeChangedView () : CView (CRect (0, 0, 10, 10)) {}
+	void parentSizeChanged () override { ++numParentSizeChanged; }
+
+	uint32_t numParentSizeChanged {0};
+};
+
+class InvalidRectContainer : public CViewContainer
+{
+public:
+	InvalidRectContainer () : CViewContainer (CRect (0, 0, 200, 200)) {}
+	void invalidRect (const CRect& rect) override
+	{
+		invalidRects.push_back (rect);
+		CViewContainer::invalidRect (rect);
+	}
+
+	std::vector<CRect> invalidRects;
+};
+
 class TestView1 : public CView
 {
 public:
@@ -107,6 +144,42 @@ public:
 	
  };
 
+class DrawRecordView : public CView
+{
+public:
+	DrawRecordView (const CRect& size) : CView (size) {}
+
+	void drawRect (CDrawContext* context, const CRect& updateRect) override
+	{
+		++drawCount;
+		lastUpdateRect = updateRect;
+	}
+
+	uint32_t drawCount {0};
+	CRect lastUpdateRect;
+};
+
+class NoDrawContext : public CDrawContext
+{
+public:
+	NoDrawContext (const CRect& r) : CDrawContext (r) { setClipRect (r); }
+
+	void drawLine (const LinePair& line) override {}
+	void drawLines (const LineList& lines) override {}
+	void drawPolygon (const PointList& polygonPointList, const CDrawStyle drawStyle) override {}
+	void drawRect (const CRect& rect, const CDrawStyle drawStyle) override {}
+	void drawArc (const CRect& rect, const float startAngle1, const float endAngle2, const CDrawStyle drawStyle) override {}
+	void drawEllipse (const CRect& rect, const CDrawStyle drawStyle) override {}
+	void drawPoint (const CPoint& point, const CColor& color) override {}
+	void drawBitmap (CBitmap* bitmap, const CRect& dest, const CPoint& offset, float alpha) override {}
+	void clearRect (const CRect& rect) override {}
+	CGraphicsPath* createGraphicsPath () override { return nullptr; }
+	CGraphicsPath* createTextPath (const CFontRef font, UTF8StringPtr text) override { return nullptr; }
+	void drawGraphicsPath (CGraphicsPath* path, PathDrawMode mode, CGraphicsTransform* transformation) override {}
+	void fillLinearGradient (CGraphicsPath* path, const CGradient& gradient, const CPoint& startPoint, const CPoint& endPoint, bool evenOdd, CGraphicsTransform* transformation) override {}
+	void fillRadialGradient (CGraphicsPath* path, const CGradient& gradient, const CPoint& center, CCoord radius, const CPoint& originOffset, bool evenOdd, CGraphicsTransform* transformation) override {}
+};
+
 } // anonymous
 
 TESTCASE(CViewContainerTest,
@@ -543,7 +616,163 @@ TESTCASE(CViewContainerTest,
 		res = container->getContainerAt (CPoint(0, 0), GetViewOptions (GetViewOptions::kDeep | GetViewOptions::kMouseEnabled));
 		EXPECT(res == c1);
 	);
-	
+
+	TEST(occludedViewIsNotDrawn,
+		auto back = new DrawRecordView (CRect (10, 10, 50, 50));
+		auto front = new DrawRecordView (CRect (0, 0, 100, 100));
+		front->setOpaque (true);
+		container->addView (back);
+		container->addView (front);
+		auto context = owned (new NoDrawContext (container->getViewSize ()));
+		container->drawRect (context, container->getViewSize ());
+		EXPECT (back->drawCount == 0);
+		EXPECT (front->drawCount == 1);
+		front->setOpaque (false);
+		container->drawRect (context, container->getViewSize ());
+		EXPECT (back->drawCount == 1);
+		front->setOpaque (true);
+		front->setAlphaValue (0.5f);
+		container->drawRect (context, container->getViewSize ());
+		EXPECT (back->drawCount == 2);
+	);
+
+	TEST(noCullingWhenDrawnTranslucent,
+		auto back = new DrawRecordView (CRect (10, 10, 50, 50));
+		auto front = new DrawRecordView (CRect (0, 0, 100, 100));
+		front->setOpaque (true);
+		container->addView (back);
+		container->addView (front);
+		auto context = owned (new NoDrawContext (container->getViewSize ()));
+		context->setGlobalAlpha (0.5f);
+		container->drawRect (context, container->getViewSize ());
+		EXPECT (back->drawCount == 1);
+		EXPECT (front->drawCount == 1);
+		context->setGlobalAlpha (1.f);
+		container->drawRect (context, container->getViewSize ());
+		EXPECT (back->drawCount == 1);
+		EXPECT (front->drawCount == 2);
+	);
+
+	TEST(numberOfOccludersIsLimited,
+		auto back = new DrawRecordView (CRect (0, 0, 100, 100));
+		container->addView (back);
+		// many opaque views which together cover the back view
+		for (auto i = 0; i < 20; ++i)
+		{
+			auto front = new DrawRecordView (CRect (i * 5, 0, (i + 1) * 5, 100));
+			front->setOpaque (true);
+			container->addView (front);
+		}
+		auto context = owned (new NoDrawContext (container->getViewSize ()));
+		container->drawRect (context, container->getViewSize ());
+		EXPECT (back->drawCount == 1);
+		auto cover = new DrawRecordView (CRect (0, 0, 100, 100));
+		cover->setOpaque (true);
+		container->addView (cover);
+		container->drawRect (context, container->getViewSize ());
+		EXPECT (back->drawCount == 1);
+	);
+
+	TEST(partiallyOccludedViewDrawsVisiblePart,
+		auto back = new DrawRecordView (CRect (0, 0, 100, 100));
+		auto front = new DrawRecordView (CRect (0, 50, 100, 100));
+		auto notCovering = new DrawRecordView (CRect (20, 0, 30, 10));
+		front->setOpaque (true);
+		notCovering->setOpaque (true);
+		container->addView (back);
+		container->addView (front);
+		container->addView (notCovering);
+		auto context = owned (new NoDrawContext (container->getViewSize ()));
+		container->drawRect (context, container->getViewSize ());
+		EXPECT (back->drawCount == 1);
+		EXPECT (back->lastUpdateRect == CRect (0, 0, 100, 50));
+		EXPECT (front->drawCount == 1);
+		EXPECT (notCovering->drawCount == 1);
+	);
+
+	TEST(opaqueContainer,
+		auto child = new CViewContainer (CRect (0, 0, 10, 10));
+		EXPECT (child->isOpaque ());
+		child->setTransparency (true);
+		EXPECT (child->isOpaque () == false);
+		child->setTransparency (false);
+		child->setBackgroundColor (CColor (0, 0, 0, 128));
+		EXPECT (child->isOpaque () == false);
+		child->setOpaque (true);
+		EXPECT (child->isOpaque ());
+		child->forget ();
+	);
+
+	TEST(autosizeNotifiesEveryViewOnce,
+		SizeChangeCounter counter;
+		auto root = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto middle = new CViewContainer (CRect (0, 0, 100, 100));
+		auto inner = new CViewContainer (CRect (0, 0, 100, 100));
+		auto leaf = new ParentSizeChangedView ();
+		for (auto view : std::vector<CView*> {middle, inner, leaf})
+			view->setAutosizeFlags (kAutosizeAll);
+		inner->addView (leaf);
+		middle->addView (inner);
+		root->addView (middle);
+		for (auto view : std::vector<CView*> {root, middle, inner, leaf})
+			view->registerViewListener (&counter);
+		root->setViewSize (CRect (0, 0, 150, 120));
+		for (auto view : std::vector<CView*> {root, middle, inner, leaf})
+		{
+			EXPECT (counter.numChanges[view] == 1);
+			view->unregisterViewListener (&counter);
+		}
+		EXPECT (counter.oldSizes[inner] == CRect (0, 0, 100, 100));
+		EXPECT (inner->getViewSize () == CRect (0, 0, 150, 120));
+		EXPECT (leaf->getViewSize () == CRect (0, 0, 60, 30));
+		EXPECT (leaf->numParentSizeChanged == 1);
+	);
+
+	TEST(resizeTransactionCoalescesSizeChanges,
+		SizeChangeCounter counter;
+		auto container = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto view1 = new TestView1 ();
+		auto view2 = new TestView2 ();
+		container->addView (view1);
+		container->addView (view2);
+		view1->registerViewListener (&counter);
+		view2->registerViewListener (&counter);
+		{
+			CView::ResizeTransaction transaction;
+			view1->setViewSize (CRect (0, 0, 20, 20));
+			view1->setViewSize (CRect (0, 0, 30, 30));
+			view2->setViewSize (CRect (10, 10, 40, 40));
+			view2->setViewSize (CRect (10, 10, 20, 20));
+			EXPECT (view1->getViewSize () == CRect (0, 0, 30, 30));
+			EXPECT (counter.numChanges.empty ());
+		}
+		EXPECT (counter.numChanges[view1] == 1);
+		EXPECT (counter.oldSizes[view1] == CRect (0, 0, 10, 10));
+		EXPECT (counter.numChanges[view2] == 0);
+		view1->unregisterViewListener (&counter);
+		view2->unregisterViewListener (&counter);
+	);
+
+	TEST(autosizeInvalidatesOnce,
+		auto frame = owned (new CFrame (CRect (0, 0, 200, 200), nullptr));
+		auto parent = new InvalidRectContainer ();
+		auto container = new CViewContainer (CRect (10, 10, 110, 110));
+		for (auto i = 0; i < 10; ++i)
+		{
+			auto view = new CView (CRect (0, i * 10, 100, i * 10 + 10));
+			view->setAutosizeFlags (kAutosizeLeft | kAutosizeRight | kAutosizeTop);
+			container->addView (view);
+		}
+		parent->addView (container);
+		frame->addView (parent);
+		frame->attached (frame);
+		parent->invalidRects.clear ();
+		container->setViewSize (CRect (10, 10, 150, 100));
+		EXPECT (parent->invalidRects.size () == 1);
+		EXPECT (parent->invalidRects[0] == CRect (10, 10, 150, 110));
+		frame->close ();
+	);
+
 ); // TESTCASE
 
 } // namespaces
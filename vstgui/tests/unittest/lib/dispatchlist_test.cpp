@@ -0,0 +1,166 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../lib/dispatchlist.h"
+#include "../../../lib/vstguibase.h"
+#include "../unittests.h"
+#include <functional>
+
+namespace VSTGUI {
+
+namespace {
+
+//------------------------------------------------------------------------
+struct Object : public NonAtomicReferenceCounted
+{
+	Object (int32_t& numDeleted) : numDeleted (numDeleted) {}
+	~Object () noexcept override { ++numDeleted; }
+
+	int32_t& numDeleted;
+};
+
+//------------------------------------------------------------------------
+struct CallbackObject : public NonAtomicReferenceCounted
+{
+	using Callback = std::function<void ()>;
+	CallbackObject (Callback&& onDelete) : onDelete (std::move (onDelete)) {}
+	~CallbackObject () noexcept override { onDelete (); }
+
+	Callback onDelete;
+};
+
+} // anonymous
+
+//------------------------------------------------------------------------
+TESTCASE(DispatchListTest,
+
+	TEST(forEach,
+		DispatchList<int32_t> list;
+		for (auto i = 0; i < 4; ++i)
+			list.add (i);
+		int32_t sum = 0;
+		list.forEach ([&] (int32_t value) { sum = sum * 10 + value; });
+		EXPECT (sum == 123);
+		sum = 0;
+		list.forEachReverse ([&] (int32_t value) { sum = sum * 10 + value; });
+		EXPECT (sum == 3210);
+	);
+
+	TEST(forEachWithCondition,
+		DispatchList<int32_t> list;
+		for (auto i = 0; i < 4; ++i)
+			list.add (i);
+		int32_t numCalls = 0;
+		list.forEach ([&] (int32_t value) { ++numCalls; return value; },
+		              [] (int32_t value) { return value == 1; });
+		EXPECT (numCalls == 2);
+		numCalls = 0;
+		list.forEachReverse ([&] (int32_t value) { ++numCalls; return value; },
+		                     [] (int32_t value) { return value == 1; });
+		EXPECT (numCalls == 3);
+	);
+
+	TEST(removeWhileIterating,
+		DispatchList<int32_t> list;
+		for (auto i = 0; i < 4; ++i)
+			list.add (i);
+		int32_t numCalls = 0;
+		list.forEach ([&] (int32_t value) {
+			++numCalls;
+			if (value == 0)
+				list.remove (2);
+			list.remove (value);
+		});
+		EXPECT (numCalls == 3);
+		EXPECT (list.empty ());
+	);
+
+	TEST(addWhileIterating,
+		DispatchList<int32_t> list;
+		for (auto i = 0; i < 3; ++i)
+			list.add (i);
+		int32_t numCalls = 0;
+		// objects added in place and after iterating are not visited and keep their order
+		list.forEach ([&] (int32_t value) {
+			++numCalls;
+			if (value == 0)
+			{
+				for (auto i = 3; i < 64; ++i)
+					list.add (i);
+			}
+		});
+		EXPECT (numCalls == 3);
+		int32_t expected = 0;
+		list.forEach ([&] (int32_t value) {
+			EXPECT (value == expected);
+			++expected;
+		});
+		EXPECT (expected == 64);
+	);
+
+	TEST(addWhileIteratingReverse,
+		DispatchList<int32_t> list;
+		list.add (0);
+		list.add (1);
+		int32_t numCalls = 0;
+		list.forEachReverse ([&] (int32_t value) {
+			++numCalls;
+			list.add (value + 2);
+		});
+		EXPECT (numCalls == 2);
+		int32_t sum = 0;
+		list.forEach ([&] (int32_t value) { sum = sum * 10 + value; });
+		EXPECT (sum == 132);
+	);
+
+	TEST(readdWhileIterating,
+		DispatchList<int32_t> list;
+		list.add (0);
+		list.add (1);
+		list.forEach ([&] (int32_t value) {
+			if (value == 0)
+			{
+				list.remove (0);
+				list.add (0);
+				list.remove (0);
+			}
+		});
+		int32_t sum = 0;
+		list.forEach ([&] (int32_t value) { sum += value + 1; });
+		EXPECT (sum == 2);
+	);
+
+	TEST(removedObjectsAreReleased,
+		int32_t numDeleted = 0;
+		DispatchList<SharedPointer<Object>> list;
+		auto obj = makeOwned<Object> (numDeleted);
+		list.add (obj);
+		list.add (makeOwned<Object> (numDeleted));
+		list.forEach ([&] (const SharedPointer<Object>& o) {
+			list.remove (o);
+		});
+		EXPECT (list.empty ());
+		EXPECT (numDeleted == 1);
+		obj = nullptr;
+		EXPECT (numDeleted == 2);
+	);
+
+	TEST(releasedObjectRemovesAnotherObject,
+		DispatchList<SharedPointer<CallbackObject>> list;
+		auto other = makeOwned<CallbackObject> ([] () {});
+		list.add (makeOwned<CallbackObject> ([&] () { list.remove (other); }));
+		list.add (makeOwned<CallbackObject> ([] () {}));
+		list.add (other);
+		auto numCalls = 0;
+		list.forEach ([&] (const SharedPointer<CallbackObject>& o) {
+			++numCalls;
+			if (o != other)
+				list.remove (o);
+		});
+		EXPECT (numCalls == 3);
+		EXPECT (list.empty ());
+	);
+);
+
+} // VSTGUI
@@ -0,0 +1,98 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../lib/drawprofiler.h"
+#include "../../../lib/cviewcontainer.h"
+#include "../unittests.h"
+
+namespace VSTGUI {
+
+TESTCASE(DrawProfilerTest,
+
+	TEST(disabledRecordsNothing,
+		DrawProfiler::clear ();
+		DrawProfiler::setEnabled (false);
+		auto view = owned (new CView (CRect (0, 0, 10, 10)));
+		{
+			DrawProfiler::Scope scope (view, view->getViewSize ());
+		}
+		EXPECT (DrawProfiler::getEvents ().empty ());
+	);
+
+	TEST(nestedScopes,
+		DrawProfiler::clear ();
+		DrawProfiler::setEnabled (true);
+		auto container = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto view = owned (new CView (CRect (0, 0, 10, 20)));
+		{
+			DrawProfiler::Scope scope (container, container->getViewSize ());
+			{
+				DrawProfiler::Scope scope2 (view, view->getViewSize ());
+			}
+		}
+		DrawProfiler::setEnabled (false);
+		const auto& events = DrawProfiler::getEvents ();
+		EXPECT (events.size () == 2);
+		EXPECT (events[0].depth == 0);
+		EXPECT (events[1].depth == 1);
+		EXPECT (events[0].pixels == 10000.);
+		EXPECT (events[1].pixels == 200.);
+		EXPECT (events[0].total >= events[1].total);
+		EXPECT (events[0].self <= events[0].total);
+		EXPECT (events[1].self == events[1].total);
+		EXPECT (events[1].start >= events[0].start);
+		DrawProfiler::clear ();
+		EXPECT (DrawProfiler::getEvents ().empty ());
+	);
+
+	TEST(pixelsAreTheAreaOfTheUpdateRect,
+		DrawProfiler::clear ();
+		DrawProfiler::setEnabled (true);
+		auto view = owned (new CView (CRect (0, 0, 100, 100)));
+		{
+			DrawProfiler::Scope scope (view, CRect (10, 10, 20, 30));
+		}
+		DrawProfiler::setEnabled (false);
+		const auto& events = DrawProfiler::getEvents ();
+		EXPECT (events.size () == 1);
+		EXPECT (events[0].viewRect == CRect (0, 0, 100, 100));
+		EXPECT (events[0].updateRect == CRect (10, 10, 20, 30));
+		EXPECT (events[0].pixels == 200.);
+		DrawProfiler::clear ();
+	);
+
+	TEST(viewNameIsTheClassNameOfTheViewFactory,
+		DrawProfiler::clear ();
+		DrawProfiler::setEnabled (true);
+		auto view = owned (new CView (CRect (0, 0, 10, 10)));
+		IdStringPtr className = "TestView";
+		view->setAttribute (kCViewClassNameAttribute, className);
+		{
+			DrawProfiler::Scope scope (view, view->getViewSize ());
+		}
+		DrawProfiler::setEnabled (false);
+		EXPECT (DrawProfiler::getEvents ()[0].name == "TestView");
+		DrawProfiler::clear ();
+	);
+
+	TEST(chromeTraceAndReport,
+		DrawProfiler::clear ();
+		DrawProfiler::setEnabled (true);
+		auto view = owned (new CView (CRect (0, 0, 10, 10)));
+		{
+			DrawProfiler::Scope scope (view, view->getViewSize ());
+		}
+		DrawProfiler::setEnabled (false);
+		auto trace = DrawProfiler::createChromeTrace ();
+		EXPECT (trace.find ("\"traceEvents\"") != std::string::npos);
+		EXPECT (trace.find ("\"ph\":\"X\"") != std::string::npos);
+		EXPECT (trace.find ("\"pixels\":100") != std::string::npos);
+		EXPECT (trace.find ("\"updateRect\":\"0, 0, 10, 10\"") != std::string::npos);
+		auto report = DrawProfiler::createReport (10);
+		EXPECT (report.find (DrawProfiler::getEvents ()[0].name) != std::string::npos);
+		DrawProfiler::clear ();
+	);
+);
+
+} // VSTGUI
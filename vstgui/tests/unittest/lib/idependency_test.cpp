@@ -4,6 +4,7 @@
 
 #include "../unittests.h"
 #include "../../../lib/idependency.h"
+#include <functional>
 
 namespace VSTGUI {
 
@@ -35,6 +36,22 @@ public:
 
 };
 
+class CallbackDependentObject : public DependentObject
+{
+public:
+	using Callback = std::function<void ()>;
+
+	CallbackDependentObject (Callback&& callback) : callback (std::move (callback)) {}
+
+	CMessageResult notify (CBaseObject* sender, IdStringPtr message) override
+	{
+		callback ();
+		return DependentObject::notify (sender, message);
+	}
+
+	Callback callback;
+};
+
 TESTCASE(IDependencyTest,
 
 	TEST(simpleDependency,
@@ -46,6 +63,18 @@ TESTCASE(IDependencyTest,
 		tObj.removeDependency(&dObj);
 	);
 
+	TEST(removeDependencyRemovesAllOccurrences,
+		DependentObject dObj;
+		TestObject tObj;
+		tObj.addDependency (&dObj);
+		tObj.addDependency (&dObj);
+		tObj.changed ("Test");
+		EXPECT(dObj.notifyCalledCount == 2)
+		tObj.removeDependency (&dObj);
+		tObj.changed ("Test");
+		EXPECT(dObj.notifyCalledCount == 2)
+	);
+
 	TEST(simpleDeferedDependency,
 		DependentObject dObj;
 		TestObject tObj;
@@ -71,6 +100,98 @@ TESTCASE(IDependencyTest,
 		EXPECT(dObj.notifyCalledCount == 1)
 		tObj.removeDependency (&dObj);
 	);
+
+	TEST(removeDependencyWhileNotifying,
+		DependentObject dObj2;
+		TestObject tObj;
+		CallbackDependentObject dObj1 ([&] () { tObj.removeDependency (&dObj2); });
+		tObj.addDependency (&dObj1);
+		tObj.addDependency (&dObj2);
+		tObj.changed ("Test");
+		EXPECT(dObj1.notifyCalledCount == 1)
+		EXPECT(dObj2.notifyCalledCount == 0)
+		tObj.changed ("Test");
+		EXPECT(dObj1.notifyCalledCount == 2)
+		tObj.removeDependency (&dObj1);
+	);
+
+	TEST(addDependencyWhileNotifying,
+		DependentObject dObj2;
+		TestObject tObj;
+		bool added = false;
+		CallbackDependentObject dObj1 ([&] () {
+			if (!added)
+				tObj.addDependency (&dObj2);
+			added = true;
+		});
+		tObj.addDependency (&dObj1);
+		tObj.changed ("Test");
+		EXPECT(dObj2.notifyCalledCount == 0)
+		tObj.changed ("Test");
+		EXPECT(dObj2.notifyCalledCount == 1)
+		tObj.removeDependency (&dObj1);
+		tObj.removeDependency (&dObj2);
+	);
+
+	TEST(changedWhileNotifying,
+		TestObject tObj;
+		int32_t depth = 0;
+		CallbackDependentObject dObj ([&] () {
+			auto level = ++depth;
+			if (level < 3)
+				tObj.changed ("Test");
+			if (level == 2)
+				tObj.removeDependency (&dObj);
+		});
+		tObj.addDependency (&dObj);
+		tObj.changed ("Test");
+		EXPECT(dObj.notifyCalledCount == 3)
+		tObj.changed ("Test");
+		EXPECT(dObj.notifyCalledCount == 3)
+	);
+
+	TEST(senderReleasedWhileNotifying,
+		auto tObj = new TestObject;
+		CallbackDependentObject dObj ([&] () {
+			tObj->removeDependency (&dObj);
+			tObj->forget ();
+		});
+		tObj->addDependency (&dObj);
+		tObj->changed ("Test");
+		EXPECT(dObj.notifyCalledCount == 1)
+	);
+
+	TEST(deferedChangesKeepOrder,
+		std::vector<IdStringPtr> messages;
+		TestObject tObj;
+		struct Recorder : public CBaseObject
+		{
+			Recorder (std::vector<IdStringPtr>& messages) : messages (messages) {}
+			CMessageResult notify (CBaseObject* sender, IdStringPtr message) override
+			{
+				messages.emplace_back (message);
+				return kMessageNotified;
+			}
+			std::vector<IdStringPtr>& messages;
+		} recorder (messages);
+		tObj.addDependency (&recorder);
+		IdStringPtr msg1 = "1";
+		IdStringPtr msg2 = "2";
+		{
+			IDependency::DeferChanges df (&tObj);
+			tObj.changed (msg2);
+			{
+				IDependency::DeferChanges df2 (&tObj);
+				tObj.changed (msg1);
+			}
+			tObj.changed (msg2);
+			EXPECT(messages.empty ())
+		}
+		EXPECT(messages.size () == 2)
+		EXPECT(messages[0] == msg2)
+		EXPECT(messages[1] == msg1)
+		tObj.removeDependency (&recorder);
+	);
 );
 
 } // namespace
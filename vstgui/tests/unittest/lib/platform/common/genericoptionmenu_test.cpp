@@ -0,0 +1,209 @@
+// This file is part of VSTGUI. It is subject to the license terms 
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../../../lib/platform/common/genericoptionmenudetail.h"
+#include "../../../unittests.h"
+
+namespace VSTGUI {
+namespace GenericOptionMenuDetail {
+
+namespace {
+
+//------------------------------------------------------------------------
+struct GlyphMeasure
+{
+	/** every glyph is 1 wide, except the ones in wideGlyphs */
+	std::vector<std::pair<std::string, CCoord>> wideGlyphs;
+	mutable uint32_t numCalls {0};
+
+	CCoord operator() (const UTF8String& str) const
+	{
+		++numCalls;
+		const auto& s = str.getString ();
+		CCoord width = 0.;
+		for (size_t pos = 0; pos < s.size ();)
+		{
+			auto it = std::find_if (wideGlyphs.begin (), wideGlyphs.end (),
+			                        [&] (const std::pair<std::string, CCoord>& glyph) {
+				                        return s.compare (pos, glyph.first.size (), glyph.first) == 0;
+			                        });
+			if (it != wideGlyphs.end ())
+			{
+				width += it->second;
+				pos += it->first.size ();
+			}
+			else
+			{
+				width += 1.;
+				++pos;
+			}
+		}
+		return width;
+	}
+};
+
+//------------------------------------------------------------------------
+struct TestItems
+{
+	std::vector<SharedPointer<CMenuItem>> owner;
+	std::vector<CMenuItem*> items;
+
+	void add (const UTF8String& title, uint32_t count = 1)
+	{
+		for (auto i = 0u; i < count; ++i)
+		{
+			owner.emplace_back (makeOwned<CMenuItem> (title));
+			items.emplace_back (owner.back ());
+		}
+	}
+};
+
+//------------------------------------------------------------------------
+static CCoord measureAll (const std::vector<CMenuItem*>& items, const GlyphMeasure& measure)
+{
+	CCoord maxWidth = 0.;
+	for (auto item : items)
+		maxWidth = std::max (maxWidth, measure (item->getTitle ()));
+	return maxWidth;
+}
+
+//------------------------------------------------------------------------
+static SharedPointer<COptionMenu> makeMenu (const std::vector<UTF8String>& titles)
+{
+	auto menu = makeOwned<COptionMenu> ();
+	for (const auto& title : titles)
+		menu->addEntry (title);
+	return menu;
+}
+
+} // anonymous
+
+//------------------------------------------------------------------------
+TESTCASE(GenericOptionMenuMaxTitleWidthTest,
+
+	TEST(emptyMenu,
+		GlyphMeasure measure;
+		EXPECT (calculateMaxTitleWidth (std::vector<CMenuItem*> (), measure) == 0.);
+	);
+
+	TEST(smallMenuMeasuresEveryTitle,
+		TestItems t;
+		t.add ("Short");
+		t.add ("A bit longer");
+		GlyphMeasure measure;
+		EXPECT (calculateMaxTitleWidth (t.items, measure) == 12.);
+		EXPECT (measure.numCalls == 2);
+	);
+
+	TEST(hugeMenuSkipsShortTitles,
+		TestItems t;
+		t.add ("The longest title", 1);
+		t.add ("short", 1000);
+		GlyphMeasure measure;
+		EXPECT (calculateMaxTitleWidth (t.items, measure) == 17.);
+		EXPECT (measure.numCalls < 200);
+	);
+
+	TEST(shortTitleWithWideASCIIGlyphsIsMeasured,
+		TestItems t;
+		t.add ("______");
+		t.add ("a long title with narrow glyphs", 200);
+		GlyphMeasure measure;
+		measure.wideGlyphs.emplace_back ("_", 20.);
+		EXPECT (calculateMaxTitleWidth (t.items, measure) == 120.);
+		EXPECT (calculateMaxTitleWidth (t.items, measure) == measureAll (t.items, measure));
+	);
+
+	TEST(nonASCIITitlesAreAlwaysMeasured,
+		TestItems t;
+		// U+FDFD is a single glyph of three bytes which is much wider than three 'W'
+		t.add ("\xEF\xB7\xBD");
+		t.add ("a rather long ASCII title", 200);
+		GlyphMeasure measure;
+		measure.wideGlyphs.emplace_back ("\xEF\xB7\xBD", 100.);
+		measure.wideGlyphs.emplace_back ("W", 2.);
+		EXPECT (calculateMaxTitleWidth (t.items, measure) == 100.);
+	);
+);
+
+//------------------------------------------------------------------------
+TESTCASE(GenericOptionMenuItemFilterTest,
+
+	TEST(inactiveByDefault,
+		auto menu = makeMenu ({"One", "Two"});
+		ItemFilter filter (menu);
+		EXPECT (filter.isActive () == false);
+		EXPECT (filter.getNumRows () == 2);
+		EXPECT (filter.getItemIndex (1) == 1);
+		EXPECT (filter.getBestRow () == CDataBrowser::kNoSelection);
+	);
+
+	TEST(matchesSubstringCaseInsensitive,
+		auto menu = makeMenu ({"Alpha", "Beta", "alphabet", "Gamma"});
+		ItemFilter filter (menu);
+		filter.setSearchString ("PHA");
+		EXPECT (filter.getNumRows () == 2);
+		EXPECT (filter.getItemIndex (0) == 0);
+		EXPECT (filter.getItemIndex (1) == 2);
+		EXPECT (filter.getItemIndex (2) == -1);
+	);
+
+	TEST(bestRowStartsWithSearchString,
+		auto menu = makeMenu ({"Beta", "Alphabet", "Bet"});
+		ItemFilter filter (menu);
+		filter.setSearchString ("bet");
+		EXPECT (filter.getNumRows () == 3);
+		EXPECT (filter.getBestRow () == 0);
+		filter.setSearchString ("al");
+		EXPECT (filter.getBestRow () == 0);
+		filter.setSearchString ("ab");
+		EXPECT (filter.getNumRows () == 1);
+		EXPECT (filter.getBestRow () == 0);
+		filter.setSearchString ("xyz");
+		EXPECT (filter.getNumRows () == 0);
+		EXPECT (filter.getBestRow () == CDataBrowser::kNoSelection);
+	);
+
+	TEST(removingCharactersRestoresMatches,
+		auto menu = makeMenu ({"Red", "Green", "Grey"});
+		ItemFilter filter (menu);
+		filter.setSearchString ("gre");
+		EXPECT (filter.getNumRows () == 2);
+		filter.setSearchString ("gree");
+		EXPECT (filter.getNumRows () == 1);
+		filter.setSearchString ("gr");
+		EXPECT (filter.getNumRows () == 2);
+		filter.setSearchString ("re");
+		EXPECT (filter.getNumRows () == 3);
+		filter.setSearchString ("");
+		EXPECT (filter.isActive () == false);
+		EXPECT (filter.getNumRows () == 3);
+	);
+
+	TEST(separatorsTitlesAndDisabledItemsNeverMatch,
+		auto menu = makeMenu ({"Item", "-", "Item disabled"});
+		menu->addEntry ("Item title", -1, CMenuItem::kTitle);
+		menu->getEntry (2)->setEnabled (false);
+		ItemFilter filter (menu);
+		filter.setSearchString ("item");
+		EXPECT (filter.getNumRows () == 1);
+		EXPECT (filter.getItemIndex (0) == 0);
+	);
+
+	TEST(caseFoldingIsASCIIOnly,
+		auto menu = makeMenu ({"\xC3\x84pfel", "\xC3\xA4pfel"});
+		ItemFilter filter (menu);
+		// "Ä" only matches itself
+		filter.setSearchString ("\xC3\x84");
+		EXPECT (filter.getNumRows () == 1);
+		EXPECT (filter.getItemIndex (0) == 0);
+		// the ASCII part of the title is still folded
+		filter.setSearchString ("\xC3\xA4PFEL");
+		EXPECT (filter.getNumRows () == 1);
+		EXPECT (filter.getItemIndex (0) == 1);
+	);
+);
+
+} // GenericOptionMenuDetail
+} // VSTGUI
@@ -0,0 +1,91 @@
+// This file is part of VSTGUI. It is subject to the license terms 
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../../../lib/platform/common/generictexteditdetail.h"
+#include "../../../unittests.h"
+
+namespace VSTGUI {
+namespace GenericTextEditDetail {
+
+namespace {
+
+//------------------------------------------------------------------------
+static SharedPointer<CFontDesc> makeFont (const UTF8String& name, CCoord size = 12.)
+{
+	return makeOwned<CFontDesc> (name, size);
+}
+
+} // anonymous
+
+//------------------------------------------------------------------------
+TESTCASE(CharAdvanceTableTest,
+
+	TEST(sameFontSharesTable,
+		auto font1 = makeFont ("CharAdvanceTableTestFont");
+		auto font2 = makeFont ("CharAdvanceTableTestFont");
+		EXPECT (CharAdvanceTable::get (font1) == CharAdvanceTable::get (font2));
+		font2->setSize (13.);
+		EXPECT (CharAdvanceTable::get (font1) != CharAdvanceTable::get (font2));
+		font2->setSize (12.);
+		font2->setStyle (kBoldFace);
+		EXPECT (CharAdvanceTable::get (font1) != CharAdvanceTable::get (font2));
+	);
+
+	TEST(pairIsMeasuredOnce,
+		auto table = CharAdvanceTable::get (makeFont ("CharAdvanceTableTestMeasure"));
+		uint32_t numMeasures = 0;
+		auto measure = [&] (CharAdvanceTable::CharT c, CharAdvanceTable::CharT pc) {
+			++numMeasures;
+			return static_cast<CCoord> (c) + (pc ? 0.5 : 0.);
+		};
+		EXPECT (table->getAdvance ('a', 0, measure) == 'a');
+		EXPECT (table->getAdvance ('a', 'b', measure) == 'a' + 0.5);
+		EXPECT (table->getAdvance ('a', 0, measure) == 'a');
+		EXPECT (table->getAdvance ('a', 'b', measure) == 'a' + 0.5);
+		EXPECT (numMeasures == 2);
+		EXPECT (table->getNumAdvances () == 2);
+	);
+
+	TEST(onlyRecentlyUsedTablesAreCached,
+		auto font = makeFont ("CharAdvanceTableTestLRU");
+		std::weak_ptr<CharAdvanceTable> table = CharAdvanceTable::get (font);
+		EXPECT (table.lock () == CharAdvanceTable::get (font));
+		for (auto i = 0u; i < CharAdvanceTable::maxCachedTables - 1; ++i)
+			CharAdvanceTable::get (makeFont ("CharAdvanceTableTestLRU", 20. + i));
+		// still cached, using it makes it the most recently used table again
+		EXPECT (table.lock () == CharAdvanceTable::get (font));
+		for (auto i = 0u; i < CharAdvanceTable::maxCachedTables - 1; ++i)
+			CharAdvanceTable::get (makeFont ("CharAdvanceTableTestLRU", 40. + i));
+		EXPECT (table.expired () == false);
+		CharAdvanceTable::get (makeFont ("CharAdvanceTableTestLRU", 60.));
+		EXPECT (table.expired ());
+	);
+
+	TEST(usedTableStaysAliveWhenEvicted,
+		auto font = makeFont ("CharAdvanceTableTestInUse");
+		auto table = CharAdvanceTable::get (font);
+		table->getAdvance ('x', 0, [] (CharAdvanceTable::CharT, CharAdvanceTable::CharT) { return 7.; });
+		for (auto i = 0u; i < CharAdvanceTable::maxCachedTables; ++i)
+			CharAdvanceTable::get (makeFont ("CharAdvanceTableTestInUse", 20. + i));
+		EXPECT (table->getNumAdvances () == 1);
+		EXPECT (table != CharAdvanceTable::get (font));
+	);
+
+	TEST(numberOfAdvancesIsBounded,
+		auto table = CharAdvanceTable::get (makeFont ("CharAdvanceTableTestBounded"));
+		auto measure = [] (CharAdvanceTable::CharT, CharAdvanceTable::CharT) { return 1.; };
+		for (uint32_t i = 0; i < CharAdvanceTable::maxAdvances; ++i)
+		{
+			auto c = static_cast<CharAdvanceTable::CharT> (i & 0xffff);
+			auto pc = static_cast<CharAdvanceTable::CharT> (i >> 16);
+			table->getAdvance (c, pc, measure);
+		}
+		EXPECT (table->getNumAdvances () == CharAdvanceTable::maxAdvances);
+		table->getAdvance ('a', 'a', measure);
+		EXPECT (table->getNumAdvances () == 1);
+	);
+);
+
+} // GenericTextEditDetail
+} // VSTGUI
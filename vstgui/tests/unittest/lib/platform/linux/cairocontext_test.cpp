@@ -0,0 +1,173 @@
+// This file is part of VSTGUI. It is subject to the license terms 
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../../../lib/platform/linux/cairocontext.h"
+#include "../../../../../lib/platform/linux/cairobitmap.h"
+#include "../../../../../lib/platform/linux/cairoutils.h"
+#include "../../../../../lib/cbitmap.h"
+#include "../../../../../lib/cgradient.h"
+#include "../../../../../lib/cgraphicspath.h"
+#include "../../../unittests.h"
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+namespace VSTGUI {
+namespace Cairo {
+
+namespace {
+
+//------------------------------------------------------------------------
+struct DrawResult
+{
+	SharedPointer<CBitmap> bitmap;
+
+	CColor getColor (uint32_t x, uint32_t y) const
+	{
+		CColor color;
+		if (auto accessor = owned (CBitmapPixelAccess::create (bitmap, false)))
+		{
+			if (accessor->setPosition (x, y))
+				accessor->getColor (color);
+		}
+		return color;
+	}
+};
+
+//------------------------------------------------------------------------
+static DrawResult draw (CPoint size, const std::function<void (CDrawContext&)>& func)
+{
+	auto platformBitmap = makeOwned<Bitmap> (&size);
+	auto context = owned (new Context (platformBitmap));
+	context->beginDraw ();
+	func (*context);
+	context->endDraw ();
+	return {context->getBitmap ()};
+}
+
+//------------------------------------------------------------------------
+static void fillRadial (CDrawContext& context, const CGradient& gradient, const CPoint& center,
+                        CCoord radius, const CPoint& originOffset = CPoint ())
+{
+	auto path = owned (context.createGraphicsPath ());
+	path->addRect (CRect (0, 0, 20, 20));
+	context.fillRadialGradient (path, gradient, center, radius, originOffset);
+}
+
+//------------------------------------------------------------------------
+static bool isNear (uint8_t value, uint8_t expected, int tolerance = 3)
+{
+	return std::abs (static_cast<int> (value) - static_cast<int> (expected)) <= tolerance;
+}
+
+//------------------------------------------------------------------------
+static bool isNear (const CColor& c1, const CColor& c2, int tolerance = 3)
+{
+	return isNear (c1.red, c2.red, tolerance) && isNear (c1.green, c2.green, tolerance) &&
+	       isNear (c1.blue, c2.blue, tolerance) && isNear (c1.alpha, c2.alpha, tolerance);
+}
+
+} // anonymous
+
+//------------------------------------------------------------------------
+TESTCASE(CairoContextTest,
+
+	TEST(radialGradientIsCircular,
+		auto gradient = owned (CGradient::create (0., 1., kRedCColor, kBlueCColor));
+		auto result = draw (CPoint (20, 20), [&] (CDrawContext& context) {
+			fillRadial (context, *gradient, CPoint (10, 10), 8);
+		});
+		// pixel centers are at .5, so these pixels have the same distance to the center
+		auto center = result.getColor (10, 10);
+		EXPECT (center.red > 220 && center.blue < 35);
+		auto right = result.getColor (14, 10);
+		EXPECT (right.red > 64 && right.blue > 64);
+		EXPECT (isNear (right, result.getColor (10, 14)));
+		EXPECT (isNear (right, result.getColor (5, 10)));
+		EXPECT (isNear (right, result.getColor (10, 5)));
+	);
+
+	TEST(radialGradientIsPlacedAtCenterAndScaledByRadius,
+		auto gradient = owned (CGradient::create (0., 1., kRedCColor, kBlueCColor));
+		auto result = draw (CPoint (20, 20), [&] (CDrawContext& context) {
+			fillRadial (context, *gradient, CPoint (5, 5), 4);
+		});
+		auto center = result.getColor (5, 5);
+		EXPECT (center.red > 190 && center.blue < 65);
+		auto inside = result.getColor (8, 5);
+		EXPECT (inside.blue > inside.red);
+		EXPECT (result.getColor (15, 15).red < 15);
+	);
+
+	TEST(radialGradientOriginOffset,
+		auto gradient = owned (CGradient::create (0., 1., kRedCColor, kBlueCColor));
+		auto result = draw (CPoint (20, 20), [&] (CDrawContext& context) {
+			fillRadial (context, *gradient, CPoint (10, 10), 8, CPoint (4, 0));
+		});
+		auto origin = result.getColor (14, 10);
+		EXPECT (origin.red > 220 && origin.blue < 35);
+		EXPECT (result.getColor (6, 10).blue > origin.blue);
+		EXPECT (isNear (result.getColor (14, 7), result.getColor (14, 12)));
+	);
+
+	TEST(radialGradientColorStopAlpha,
+		CColor color (255, 0, 0, 128);
+		auto gradient = owned (CGradient::create (0., 1., color, color));
+		auto result = draw (CPoint (20, 20), [&] (CDrawContext& context) {
+			fillRadial (context, *gradient, CPoint (10, 10), 8);
+		});
+		EXPECT (isNear (result.getColor (10, 10), color));
+		EXPECT (isNear (result.getColor (12, 10), color));
+	);
+
+	TEST(linearGradientColorStopAlpha,
+		CColor color (0, 0, 255, 64);
+		auto gradient = owned (CGradient::create (0., 1., color, color));
+		auto result = draw (CPoint (20, 20), [&] (CDrawContext& context) {
+			auto path = owned (context.createGraphicsPath ());
+			path->addRect (CRect (0, 0, 20, 20));
+			context.fillLinearGradient (path, *gradient, CPoint (0, 0), CPoint (20, 0));
+		});
+		EXPECT (isNear (result.getColor (10, 10), color));
+	);
+);
+
+//------------------------------------------------------------------------
+TESTCASE(CairoScrollDirtyRectsTest,
+
+	TEST(exposedStripIsDirty,
+		std::vector<CRect> dirtyRects;
+		addScrollDirtyRects (dirtyRects, CRect (0, 0, 100, 100), CPoint (0, -10));
+		EXPECT (dirtyRects.size () == 1);
+		EXPECT (dirtyRects[0] == CRect (0, 90, 100, 100));
+		dirtyRects.clear ();
+		addScrollDirtyRects (dirtyRects, CRect (0, 0, 100, 100), CPoint (10, 0));
+		EXPECT (dirtyRects.size () == 1);
+		EXPECT (dirtyRects[0] == CRect (0, 0, 10, 100));
+	);
+
+	TEST(dirtyRectsAreMovedWithThePixels,
+		std::vector<CRect> dirtyRects;
+		dirtyRects.emplace_back (CRect (10, 50, 20, 60));
+		dirtyRects.emplace_back (CRect (200, 200, 210, 210));
+		addScrollDirtyRects (dirtyRects, CRect (0, 0, 100, 100), CPoint (0, -10));
+		EXPECT (dirtyRects.size () == 4);
+		EXPECT (dirtyRects[0] == CRect (10, 50, 20, 60));
+		EXPECT (dirtyRects[1] == CRect (200, 200, 210, 210));
+		EXPECT (dirtyRects[2] == CRect (10, 40, 20, 50));
+		EXPECT (dirtyRects[3] == CRect (0, 90, 100, 100));
+	);
+
+	TEST(dirtyRectsAreClippedToTheScrolledRect,
+		std::vector<CRect> dirtyRects;
+		dirtyRects.emplace_back (CRect (-10, 0, 10, 20));
+		addScrollDirtyRects (dirtyRects, CRect (0, 0, 100, 100), CPoint (0, 10));
+		EXPECT (dirtyRects.size () == 3);
+		EXPECT (dirtyRects[1] == CRect (0, 10, 10, 30));
+		EXPECT (dirtyRects[2] == CRect (0, 0, 100, 10));
+	);
+);
+
+} // Cairo
+} // VSTGUI
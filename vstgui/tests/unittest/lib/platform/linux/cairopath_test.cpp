@@ -0,0 +1,137 @@
+// This file is part of VSTGUI. It is subject to the license terms 
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../../../lib/platform/linux/cairopath.h"
+#include "../../../../../lib/platform/linux/cairocontext.h"
+#include "../../../../../lib/platform/linux/cairobitmap.h"
+#include "../../../unittests.h"
+
+namespace VSTGUI {
+namespace Cairo {
+
+namespace {
+
+using Polygon = Path::Polygon;
+using PolygonList = Path::PolygonList;
+
+//------------------------------------------------------------------------
+static Polygon makeRect (CCoord left, CCoord top, CCoord right, CCoord bottom, bool clockwise = true)
+{
+	if (clockwise)
+		return Polygon ({CPoint (left, top), CPoint (right, top), CPoint (right, bottom), CPoint (left, bottom)});
+	return Polygon ({CPoint (left, top), CPoint (left, bottom), CPoint (right, bottom), CPoint (right, top)});
+}
+
+//------------------------------------------------------------------------
+static Polygon makePentagram ()
+{
+	// every second vertex of a regular pentagon around (50, 50) with a radius of 40, the
+	// center is surrounded twice
+	return Polygon ({CPoint (50., 10.), CPoint (73.51, 82.36), CPoint (11.96, 37.64),
+					 CPoint (88.04, 37.64), CPoint (26.49, 82.36)});
+}
+
+//------------------------------------------------------------------------
+static bool containsWithBothRules (const PolygonList& polygons, const CPoint& p)
+{
+	return Path::polygonsContain (polygons, p, true) && Path::polygonsContain (polygons, p, false);
+}
+
+//------------------------------------------------------------------------
+static bool containsWithNoRule (const PolygonList& polygons, const CPoint& p)
+{
+	return !Path::polygonsContain (polygons, p, true) && !Path::polygonsContain (polygons, p, false);
+}
+
+} // anonymous
+
+//------------------------------------------------------------------------
+TESTCASE(CairoPathTest,
+
+	TEST(rect,
+		PolygonList polygons (1, makeRect (10, 10, 50, 50));
+		EXPECT (containsWithBothRules (polygons, CPoint (30, 30)));
+		EXPECT (containsWithBothRules (polygons, CPoint (11, 49)));
+		EXPECT (containsWithNoRule (polygons, CPoint (5, 30)));
+		EXPECT (containsWithNoRule (polygons, CPoint (55, 30)));
+		EXPECT (containsWithNoRule (polygons, CPoint (30, 5)));
+		EXPECT (containsWithNoRule (polygons, CPoint (30, 55)));
+	);
+
+	TEST(openPolygonIsImplicitlyClosed,
+		PolygonList polygons (1, Polygon ({CPoint (0, 0), CPoint (40, 0), CPoint (0, 40)}));
+		EXPECT (containsWithBothRules (polygons, CPoint (10, 10)));
+		EXPECT (containsWithNoRule (polygons, CPoint (30, 30)));
+	);
+
+	TEST(degeneratePolygonsAreIgnored,
+		PolygonList polygons;
+		polygons.emplace_back (Polygon ({CPoint (0, 0), CPoint (100, 100)}));
+		polygons.emplace_back (Polygon (1, CPoint (50, 50)));
+		polygons.emplace_back (Polygon ());
+		EXPECT (containsWithNoRule (polygons, CPoint (50, 50)));
+		EXPECT (containsWithNoRule (polygons, CPoint (20, 30)));
+		EXPECT (containsWithNoRule (PolygonList (), CPoint (0, 0)));
+	);
+
+	TEST(nestedRectsWithSameDirection,
+		PolygonList polygons;
+		polygons.emplace_back (makeRect (0, 0, 100, 100));
+		polygons.emplace_back (makeRect (25, 25, 75, 75));
+		// the hole is only a hole for the even-odd rule
+		EXPECT (Path::polygonsContain (polygons, CPoint (50, 50), false) == true);
+		EXPECT (Path::polygonsContain (polygons, CPoint (50, 50), true) == false);
+		EXPECT (containsWithBothRules (polygons, CPoint (10, 50)));
+		EXPECT (containsWithNoRule (polygons, CPoint (150, 50)));
+	);
+
+	TEST(nestedRectsWithOppositeDirection,
+		PolygonList polygons;
+		polygons.emplace_back (makeRect (0, 0, 100, 100));
+		polygons.emplace_back (makeRect (25, 25, 75, 75, false));
+		EXPECT (containsWithNoRule (polygons, CPoint (50, 50)));
+		EXPECT (containsWithBothRules (polygons, CPoint (10, 50)));
+		EXPECT (containsWithBothRules (polygons, CPoint (90, 90)));
+	);
+
+	TEST(overlappingRects,
+		PolygonList polygons;
+		polygons.emplace_back (makeRect (0, 0, 60, 60));
+		polygons.emplace_back (makeRect (40, 40, 100, 100));
+		EXPECT (Path::polygonsContain (polygons, CPoint (50, 50), false) == true);
+		EXPECT (Path::polygonsContain (polygons, CPoint (50, 50), true) == false);
+		EXPECT (containsWithBothRules (polygons, CPoint (20, 20)));
+		EXPECT (containsWithBothRules (polygons, CPoint (80, 80)));
+		EXPECT (containsWithNoRule (polygons, CPoint (80, 20)));
+	);
+
+	TEST(selfIntersectingPolygon,
+		PolygonList polygons (1, makePentagram ());
+		// the center is surrounded twice
+		EXPECT (Path::polygonsContain (polygons, CPoint (50, 50), false) == true);
+		EXPECT (Path::polygonsContain (polygons, CPoint (50, 50), true) == false);
+		// the tips are surrounded once
+		EXPECT (containsWithBothRules (polygons, CPoint (50, 20)));
+		EXPECT (containsWithBothRules (polygons, CPoint (75, 40)));
+		EXPECT (containsWithNoRule (polygons, CPoint (50, 5)));
+		EXPECT (containsWithNoRule (polygons, CPoint (50, 85)));
+	);
+
+	TEST(pathHitTest,
+		CPoint size (100, 100);
+		auto bitmap = makeOwned<Bitmap> (&size);
+		auto context = owned (new Context (bitmap));
+		auto path = owned (context->createGraphicsPath ());
+		path->addRect (CRect (0, 0, 100, 100));
+		path->addRect (CRect (25, 25, 75, 75));
+		EXPECT (path->hitTest (CPoint (50, 50), false) == true);
+		EXPECT (path->hitTest (CPoint (50, 50), true) == false);
+		EXPECT (path->hitTest (CPoint (10, 10), true) == true);
+		EXPECT (path->hitTest (CPoint (10, 10), false) == true);
+		EXPECT (path->hitTest (CPoint (150, 50), false) == false);
+	);
+);
+
+} // Cairo
+} // VSTGUI
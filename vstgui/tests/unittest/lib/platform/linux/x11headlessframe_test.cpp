@@ -0,0 +1,163 @@
+// This file is part of VSTGUI. It is subject to the license terms 
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../../../lib/platform/platform_x11.h"
+#include "../../../../../lib/cframe.h"
+#include "../../../unittests.h"
+
+namespace VSTGUI {
+namespace X11 {
+
+namespace {
+
+//------------------------------------------------------------------------
+struct TimerHandler : ITimerHandler
+{
+	uint32_t numFired {0};
+	IRunLoop* unregisterFrom {nullptr};
+
+	void onTimer () override
+	{
+		++numFired;
+		if (unregisterFrom)
+			unregisterFrom->unregisterTimer (this);
+	}
+};
+
+//------------------------------------------------------------------------
+struct IdleView : CView
+{
+	uint32_t numIdleCalls {0};
+
+	IdleView () : CView (CRect (0, 0, 10, 10)) {}
+	void onIdle () override { ++numIdleCalls; }
+};
+
+//------------------------------------------------------------------------
+static CFrame* openHeadlessFrame (HeadlessFrameConfig& config)
+{
+	auto frame = new CFrame (CRect (0, 0, 100, 100), nullptr);
+	if (frame->open (nullptr, kHeadless, &config))
+		return frame;
+	frame->forget ();
+	return nullptr;
+}
+
+} // anonymous
+
+//------------------------------------------------------------------------
+TESTCASE(HeadlessRunLoopTest,
+
+	TEST(timersFireWhenTheirIntervalElapsed,
+		auto runLoop = makeOwned<HeadlessRunLoop> ();
+		TimerHandler t1;
+		TimerHandler t2;
+		EXPECT (runLoop->registerTimer (10, &t1));
+		EXPECT (runLoop->registerTimer (20, &t2));
+		EXPECT (runLoop->registerTimer (20, &t2) == false);
+		EXPECT (runLoop->processTimers (5) == 0);
+		EXPECT (runLoop->processTimers (5) == 1);
+		EXPECT (t1.numFired == 1);
+		EXPECT (runLoop->processTimers (10) == 2);
+		EXPECT (t1.numFired == 2);
+		EXPECT (t2.numFired == 1);
+	);
+
+	TEST(timerFiresOnceForMultipleIntervals,
+		auto runLoop = makeOwned<HeadlessRunLoop> ();
+		TimerHandler t;
+		runLoop->registerTimer (10, &t);
+		EXPECT (runLoop->processTimers (100) == 1);
+		EXPECT (runLoop->processTimers (9) == 0);
+		EXPECT (runLoop->processTimers (1) == 1);
+	);
+
+	TEST(unregisteredTimersDoNotFire,
+		auto runLoop = makeOwned<HeadlessRunLoop> ();
+		TimerHandler t1;
+		TimerHandler t2;
+		t1.unregisterFrom = runLoop;
+		runLoop->registerTimer (10, &t1);
+		runLoop->registerTimer (10, &t2);
+		EXPECT (runLoop->unregisterTimer (&t2));
+		EXPECT (runLoop->unregisterTimer (&t2) == false);
+		EXPECT (runLoop->processTimers (10) == 1);
+		EXPECT (runLoop->processTimers (10) == 0);
+		EXPECT (t1.numFired == 1);
+		EXPECT (t2.numFired == 0);
+	);
+
+	TEST(eventHandlersAreNotSupported,
+		auto runLoop = makeOwned<HeadlessRunLoop> ();
+		EXPECT (runLoop->registerEventHandler (0, nullptr) == false);
+	);
+);
+
+//------------------------------------------------------------------------
+TESTCASE(HeadlessFrameTest,
+
+	TEST(idleViewsWithoutRunLoop,
+		HeadlessFrameConfig config;
+		auto frame = openHeadlessFrame (config);
+		EXPECT (frame);
+		auto view = new IdleView ();
+		frame->addView (view);
+		view->setWantsIdle (true);
+		view->setWantsIdle (false);
+		frame->close ();
+	);
+
+	TEST(idleViewsFireWithHeadlessRunLoop,
+		auto runLoop = makeOwned<HeadlessRunLoop> ();
+		HeadlessFrameConfig config;
+		config.runLoop = runLoop;
+		auto frame = openHeadlessFrame (config);
+		EXPECT (frame);
+		auto view = new IdleView ();
+		frame->addView (view);
+		view->setWantsIdle (true);
+		runLoop->processTimers (1000 / CView::idleRate);
+		EXPECT (view->numIdleCalls == 1);
+		view->setWantsIdle (false);
+		runLoop->processTimers (1000);
+		EXPECT (view->numIdleCalls == 1);
+		frame->close ();
+	);
+
+	TEST(openWithoutConfig,
+		auto frame = new CFrame (CRect (0, 0, 100, 100), nullptr);
+		EXPECT (frame->open (nullptr, kHeadless));
+		EXPECT (dynamic_cast<IHeadlessFrame*> (frame->getPlatformFrame ()));
+		frame->close ();
+	);
+
+	TEST(framesWithAnotherRunLoopAreRefused,
+		auto runLoop = makeOwned<HeadlessRunLoop> ();
+		HeadlessFrameConfig config;
+		config.runLoop = runLoop;
+		auto frame = openHeadlessFrame (config);
+		EXPECT (frame);
+		HeadlessFrameConfig otherConfig;
+		otherConfig.runLoop = makeOwned<HeadlessRunLoop> ();
+		EXPECT (openHeadlessFrame (otherConfig) == nullptr);
+		auto sameRunLoopFrame = openHeadlessFrame (config);
+		EXPECT (sameRunLoopFrame);
+		sameRunLoopFrame->close ();
+		// a frame without a run loop uses the run loop of the open frames
+		HeadlessFrameConfig emptyConfig;
+		auto secondFrame = openHeadlessFrame (emptyConfig);
+		EXPECT (secondFrame);
+		auto view = new IdleView ();
+		secondFrame->addView (view);
+		view->setWantsIdle (true);
+		runLoop->processTimers (1000 / CView::idleRate);
+		EXPECT (view->numIdleCalls == 1);
+		view->setWantsIdle (false);
+		secondFrame->close ();
+		frame->close ();
+	);
+);
+
+} // X11
+} // VSTGUI
@@ -0,0 +1,124 @@
+// This file is part of VSTGUI. It is subject to the license terms 
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../../tools/imagestitcher/source/atlaspacker.h"
+#include "../../unittests.h"
+#include <vector>
+
+namespace VSTGUI {
+namespace ImageStitcher {
+
+namespace {
+
+//------------------------------------------------------------------------
+bool layoutIsValid (const std::vector<CPoint>& sizes, const AtlasLayout& layout, uint32_t padding)
+{
+	if (layout.positions.size () != sizes.size ())
+		return false;
+	CRect atlasRect (CPoint (), layout.size);
+	std::vector<CRect> paddedRects;
+	for (auto index = 0u; index < sizes.size (); ++index)
+	{
+		CRect r (layout.positions[index], sizes[index]);
+		CRect bounded (r);
+		bounded.bound (atlasRect);
+		if (bounded != r)
+			return false;
+		r.right += padding;
+		r.bottom += padding;
+		paddedRects.emplace_back (r);
+	}
+	for (auto i = 0u; i < paddedRects.size (); ++i)
+	{
+		for (auto j = i + 1; j < paddedRects.size (); ++j)
+		{
+			CRect overlap (paddedRects[i]);
+			overlap.bound (paddedRects[j]);
+			if (!overlap.isEmpty ())
+				return false;
+		}
+	}
+	return true;
+}
+
+} // anonymous
+
+TESTCASE(AtlasPackerTest,
+
+	TEST(noRectangles,
+		EXPECT (!packAtlas ({}, AtlasConfig ()));
+	);
+
+	TEST(singleRectangle,
+		std::vector<CPoint> sizes {CPoint (20, 10)};
+		auto layout = packAtlas (sizes, AtlasConfig ());
+		EXPECT (layout);
+		EXPECT (layout->size == CPoint (20, 10));
+		EXPECT (layout->positions[0] == CPoint (0, 0));
+	);
+
+	TEST(equalRectanglesArePackedIntoASquare,
+		AtlasConfig config;
+		config.padding = 0;
+		std::vector<CPoint> sizes (4, CPoint (10, 10));
+		auto layout = packAtlas (sizes, config);
+		EXPECT (layout);
+		EXPECT (layout->size == CPoint (20, 20));
+		EXPECT (layoutIsValid (sizes, *layout, config.padding));
+	);
+
+	TEST(paddingSeparatesRectangles,
+		AtlasConfig config;
+		config.padding = 2;
+		std::vector<CPoint> sizes (4, CPoint (10, 10));
+		auto layout = packAtlas (sizes, config);
+		EXPECT (layout);
+		EXPECT (layout->size == CPoint (22, 22));
+		EXPECT (layoutIsValid (sizes, *layout, config.padding));
+	);
+
+	TEST(rectanglesOfDifferentSizesDoNotOverlap,
+		AtlasConfig config;
+		config.padding = 1;
+		std::vector<CPoint> sizes;
+		for (auto i = 1; i <= 24; ++i)
+			sizes.emplace_back (CPoint ((i * 7) % 23 + 1, (i * 5) % 17 + 1));
+		auto layout = packAtlas (sizes, config);
+		EXPECT (layout);
+		EXPECT (layoutIsValid (sizes, *layout, config.padding));
+		CCoord area = 0;
+		for (const auto& size : sizes)
+			area += (size.x + config.padding) * (size.y + config.padding);
+		EXPECT (layout->size.x * layout->size.y < 2 * area);
+	);
+
+	TEST(fractionalSizesAreRoundedUp,
+		AtlasConfig config;
+		config.padding = 0;
+		std::vector<CPoint> sizes (2, CPoint (9.5, 9.5));
+		auto layout = packAtlas (sizes, config);
+		EXPECT (layout);
+		std::vector<CPoint> roundedSizes (2, CPoint (10, 10));
+		EXPECT (layoutIsValid (roundedSizes, *layout, config.padding));
+	);
+
+	TEST(rectangleLargerThanMaxSizeDoesNotFit,
+		AtlasConfig config;
+		config.maxSize = 16;
+		EXPECT (!packAtlas ({CPoint (17, 4)}, config));
+		EXPECT (!packAtlas ({CPoint (4, 17)}, config));
+		EXPECT (packAtlas ({CPoint (16, 16)}, config));
+	);
+
+	TEST(rectanglesExceedingMaxSizeDoNotFit,
+		AtlasConfig config;
+		config.padding = 0;
+		config.maxSize = 20;
+		EXPECT (packAtlas (std::vector<CPoint> (4, CPoint (10, 10)), config));
+		EXPECT (!packAtlas (std::vector<CPoint> (5, CPoint (10, 10)), config));
+	);
+);
+
+} // ImageStitcher
+} // VSTGUI
@@ -4,6 +4,8 @@
 
 #include "../unittests.h"
 #include "../../../uidescription/cstream.h"
+#include <cstdio>
+#include <cstring>
 
 namespace VSTGUI {
 
@@ -136,4 +138,90 @@ TESTCASE(CMemoryStreamTests,
 	
 );
 
+TESTCASE(CMemoryStreamWriteTests,
+
+	TEST(grow,
+		CMemoryStream s (16, 16);
+		for (uint32_t i = 0; i < 10000; ++i)
+			EXPECT(s.writeRaw (&i, sizeof (i)) == sizeof (i));
+		EXPECT(s.tell () == 10000 * sizeof (uint32_t));
+		s.rewind ();
+		for (uint32_t i = 0; i < 10000; ++i)
+		{
+			uint32_t value;
+			EXPECT(s.readRaw (&value, sizeof (value)) == sizeof (value));
+			EXPECT(value == i);
+		}
+	);
+
+	TEST(writeChunks,
+		CMemoryStream s (4, 4, false);
+		EXPECT(s.writeRawChunks ({{"<", 1}, {"name", 4}, {"/>", 2}}) == 7);
+		EXPECT(s.writeRawChunks ({}) == 0);
+		s.end ();
+		EXPECT(std::string (reinterpret_cast<const char*> (s.getBuffer ())) == "<name/>");
+	);
+
+	TEST(bufferedStream,
+		CMemoryStream s (1024, 1024, false);
+		std::string large (100, 'x');
+		{
+			BufferedOutputStream bs (s, 16);
+			EXPECT(bs.writeRaw ("abc", 3) == 3);
+			EXPECT(s.tell () == 0);
+			EXPECT(bs.writeRaw (large.data (), 100) == 100);
+			EXPECT(s.tell () == 103);
+			EXPECT(bs.writeRawChunks ({{"de", 2}, {"fgh", 3}}) == 5);
+			EXPECT(s.tell () == 103);
+		}
+		EXPECT(s.tell () == 108);
+		s.end ();
+		EXPECT(std::string (reinterpret_cast<const char*> (s.getBuffer ())) == "abc" + large + "defgh");
+	);
+);
+
+static constexpr auto kTestFilePath = "vstgui_cfilestream_test.tmp";
+static constexpr auto kTestFileContent = "0123456789";
+
+TESTCASE(CFileStreamTests,
+
+	SETUP(
+		CFileStream s;
+		s.open (kTestFilePath, CFileStream::kWriteMode | CFileStream::kTruncateMode | CFileStream::kBinaryMode);
+		s.writeRaw (kTestFileContent, static_cast<uint32_t> (strlen (kTestFileContent)));
+	);
+	TEARDOWN(
+		std::remove (kTestFilePath);
+	);
+
+	TEST(readSeek,
+		CFileStream s;
+		EXPECT(s.open (kTestFilePath, CFileStream::kReadMode | CFileStream::kBinaryMode));
+		char buffer[4] {};
+		EXPECT(s.readRaw (buffer, 3) == 3);
+		EXPECT(strcmp (buffer, "012") == 0);
+		EXPECT(s.tell () == 3);
+		EXPECT(s.seek (-2, CFileStream::kSeekEnd) == 8);
+		EXPECT(s.readRaw (buffer, 3) == 2);
+		EXPECT(strncmp (buffer, "89", 2) == 0);
+		EXPECT(s.readRaw (buffer, 3) == 0);
+		s.rewind ();
+		EXPECT(s.tell () == 0);
+	);
+
+	TEST(truncateWhileReading,
+		// the file is not memory mapped, so reading a truncated file must not crash
+		CFileStream s;
+		EXPECT(s.open (kTestFilePath, CFileStream::kReadMode | CFileStream::kBinaryMode));
+		char buffer[4] {};
+		EXPECT(s.readRaw (buffer, 3) == 3);
+		CFileStream ws;
+		EXPECT(ws.open (kTestFilePath, CFileStream::kWriteMode | CFileStream::kTruncateMode));
+		// rewinding drops the buffered data, so the truncated file is read again
+		s.rewind ();
+		EXPECT(s.readRaw (buffer, 3) == 0);
+		EXPECT(s.readRaw (buffer, 3) == 0);
+	);
+);
+
 } // VSTGUI
@@ -0,0 +1,99 @@
+// This file is part of VSTGUI. It is subject to the license terms 
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../unittests.h"
+#include "../../../../uidescription/editing/uiattributescontroller.h"
+#include "../../../../uidescription/editing/uiselection.h"
+#include "../../../../uidescription/uiviewfactory.h"
+#include "../../../../uidescription/detail/uiviewcreatorattributes.h"
+#include "../../../../uidescription/uiattributes.h"
+#include "../uidescriptionadapter.h"
+
+#if VSTGUI_LIVE_EDITING
+
+namespace VSTGUI {
+
+namespace {
+
+using AttributeRow = UIAttributesController::AttributeRow;
+
+//------------------------------------------------------------------------
+static AttributeRow makeRow (const UIViewFactory& factory, UISelection* selection, const std::string& name)
+{
+	AttributeRow row;
+	row.name = name;
+	UIAttributesController::initAttributeRow (&factory, selection, row);
+	return row;
+}
+
+//------------------------------------------------------------------------
+static SharedPointer<CView> makeView (const UIViewFactory& factory, IdStringPtr className)
+{
+	UIDescriptionAdapter description;
+	UIAttributes attributes;
+	attributes.setAttribute (UIViewCreator::kAttrClass, className);
+	return owned (factory.createView (attributes, &description));
+}
+
+} // anonymous
+
+//------------------------------------------------------------------------
+TESTCASE(UIAttributesControllerTest,
+
+	TEST(rowsAreReusedForViewsOfTheSameClass,
+		UIViewFactory factory;
+		auto selection = makeOwned<UISelection> ();
+		auto slider1 = makeView (factory, "CSlider");
+		auto slider2 = makeView (factory, "CSlider");
+		selection->setExclusive (slider1);
+		auto orientationRow = makeRow (factory, selection, UIViewCreator::kAttrOrientation);
+		auto opacityRow = makeRow (factory, selection, UIViewCreator::kAttrOpacity);
+		EXPECT(orientationRow.type == IViewCreator::kListType);
+		selection->setExclusive (slider2);
+		EXPECT(makeRow (factory, selection, UIViewCreator::kAttrOrientation).isSameKind (orientationRow));
+		EXPECT(makeRow (factory, selection, UIViewCreator::kAttrOpacity).isSameKind (opacityRow));
+	);
+
+	TEST(listRowsAreNotReusedForOtherClasses,
+		UIViewFactory factory;
+		auto selection = makeOwned<UISelection> ();
+		auto slider = makeView (factory, "CSlider");
+		auto vuMeter = makeView (factory, "CVuMeter");
+		selection->setExclusive (slider);
+		auto sliderRow = makeRow (factory, selection, UIViewCreator::kAttrOrientation);
+		selection->setExclusive (vuMeter);
+		auto vuMeterRow = makeRow (factory, selection, UIViewCreator::kAttrOrientation);
+		EXPECT(vuMeterRow.type == IViewCreator::kListType);
+		EXPECT(sliderRow.isSameKind (vuMeterRow) == false);
+	);
+
+	TEST(otherRowsAreReusedForOtherClasses,
+		UIViewFactory factory;
+		auto selection = makeOwned<UISelection> ();
+		auto slider = makeView (factory, "CSlider");
+		auto vuMeter = makeView (factory, "CVuMeter");
+		selection->setExclusive (slider);
+		auto sliderRow = makeRow (factory, selection, UIViewCreator::kAttrOpacity);
+		selection->setExclusive (vuMeter);
+		EXPECT(makeRow (factory, selection, UIViewCreator::kAttrOpacity).isSameKind (sliderRow));
+	);
+
+	TEST(autosizeRowDependsOnContainers,
+		UIViewFactory factory;
+		auto selection = makeOwned<UISelection> ();
+		auto container = makeView (factory, "CViewContainer");
+		auto slider = makeView (factory, "CSlider");
+		selection->setExclusive (container);
+		auto containerRow = makeRow (factory, selection, UIViewCreator::kAttrAutosize);
+		EXPECT(containerRow.containersOnly);
+		selection->add (slider);
+		auto mixedRow = makeRow (factory, selection, UIViewCreator::kAttrAutosize);
+		EXPECT(mixedRow.containersOnly == false);
+		EXPECT(containerRow.isSameKind (mixedRow) == false);
+	);
+);
+
+} // VSTGUI
+
+#endif // VSTGUI_LIVE_EDITING
@@ -0,0 +1,210 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../unittests.h"
+#include "../../../../uidescription/editing/uiundomanager.h"
+#include "../../../../uidescription/editing/uiactions.h"
+#include "../../../../uidescription/editing/uiselection.h"
+#include "../../../../lib/cview.h"
+#include <chrono>
+#include <thread>
+
+#if VSTGUI_LIVE_EDITING
+
+namespace VSTGUI {
+
+namespace {
+
+//------------------------------------------------------------------------
+struct TestAction : public IAction
+{
+	TestAction (int32_t& numDeleted, size_t memoryUsage = 128)
+	: numDeleted (numDeleted), memoryUsage (memoryUsage)
+	{
+	}
+	~TestAction () override { ++numDeleted; }
+
+	UTF8StringPtr getName () override { return "Test"; }
+	void perform () override { ++numPerformed; }
+	void undo () override { ++numUndone; }
+	size_t getMemoryUsage () const override { return memoryUsage; }
+
+	int32_t& numDeleted;
+	size_t memoryUsage;
+	int32_t numPerformed {0};
+	int32_t numUndone {0};
+};
+
+//------------------------------------------------------------------------
+static void pushMove (UIUndoManager* undoManager, UISelection* selection, const CPoint& delta)
+{
+	auto action = new ViewSizeChangeOperation (selection, false, true);
+	selection->moveBy (delta);
+	undoManager->pushAndPerform (action);
+}
+
+} // anonymous
+
+//------------------------------------------------------------------------
+TESTCASE(UIUndoManagerTest,
+
+	TEST(mergeSuccessiveMoves,
+		auto undoManager = makeOwned<UIUndoManager> ();
+		auto selection = makeOwned<UISelection> ();
+		auto view = makeOwned<CView> (CRect (0, 0, 10, 10));
+		selection->add (view);
+		pushMove (undoManager, selection, CPoint (1, 0));
+		pushMove (undoManager, selection, CPoint (1, 0));
+		pushMove (undoManager, selection, CPoint (0, 1));
+		EXPECT(undoManager->getNumActions () == 1);
+		EXPECT(view->getViewSize () == CRect (2, 1, 12, 11));
+		undoManager->performUndo ();
+		EXPECT(view->getViewSize () == CRect (0, 0, 10, 10));
+		EXPECT(undoManager->canUndo () == false);
+		undoManager->performRedo ();
+		EXPECT(view->getViewSize () == CRect (2, 1, 12, 11));
+	);
+
+	TEST(noMergeOfDifferentViews,
+		auto undoManager = makeOwned<UIUndoManager> ();
+		auto selection = makeOwned<UISelection> ();
+		auto view1 = makeOwned<CView> (CRect (0, 0, 10, 10));
+		auto view2 = makeOwned<CView> (CRect (0, 0, 10, 10));
+		selection->add (view1);
+		pushMove (undoManager, selection, CPoint (1, 0));
+		selection->setExclusive (view2);
+		pushMove (undoManager, selection, CPoint (1, 0));
+		EXPECT(undoManager->getNumActions () == 2);
+	);
+
+	TEST(noMergeIntoSavePosition,
+		auto undoManager = makeOwned<UIUndoManager> ();
+		auto selection = makeOwned<UISelection> ();
+		auto view = makeOwned<CView> (CRect (0, 0, 10, 10));
+		selection->add (view);
+		pushMove (undoManager, selection, CPoint (1, 0));
+		undoManager->markSavePosition ();
+		pushMove (undoManager, selection, CPoint (1, 0));
+		EXPECT(undoManager->getNumActions () == 2);
+		undoManager->performUndo ();
+		EXPECT(undoManager->isSavePosition ());
+		EXPECT(view->getViewSize () == CRect (1, 0, 11, 10));
+	);
+
+	TEST(noMergeAfterMergeTimeWindow,
+		auto undoManager = makeOwned<UIUndoManager> ();
+		undoManager->setMergeTimeWindow (5);
+		auto selection = makeOwned<UISelection> ();
+		auto view = makeOwned<CView> (CRect (0, 0, 10, 10));
+		selection->add (view);
+		pushMove (undoManager, selection, CPoint (1, 0));
+		std::this_thread::sleep_for (std::chrono::milliseconds (20));
+		pushMove (undoManager, selection, CPoint (1, 0));
+		EXPECT(undoManager->getNumActions () == 2);
+	);
+
+	TEST(noMergeWhenDisabled,
+		auto undoManager = makeOwned<UIUndoManager> ();
+		undoManager->setMergeTimeWindow (0);
+		auto selection = makeOwned<UISelection> ();
+		auto view = makeOwned<CView> (CRect (0, 0, 10, 10));
+		selection->add (view);
+		pushMove (undoManager, selection, CPoint (1, 0));
+		pushMove (undoManager, selection, CPoint (1, 0));
+		EXPECT(undoManager->getNumActions () == 2);
+	);
+
+	TEST(noMergeAfterUndo,
+		auto undoManager = makeOwned<UIUndoManager> ();
+		auto selection = makeOwned<UISelection> ();
+		auto view1 = makeOwned<CView> (CRect (0, 0, 10, 10));
+		auto view2 = makeOwned<CView> (CRect (0, 0, 10, 10));
+		selection->add (view1);
+		pushMove (undoManager, selection, CPoint (1, 0));
+		selection->setExclusive (view2);
+		pushMove (undoManager, selection, CPoint (1, 0));
+		undoManager->performUndo ();
+		selection->setExclusive (view1);
+		pushMove (undoManager, selection, CPoint (1, 0));
+		EXPECT(undoManager->getNumActions () == 2);
+		undoManager->performUndo ();
+		EXPECT(view1->getViewSize () == CRect (1, 0, 11, 10));
+	);
+
+	TEST(maxActions,
+		int32_t numDeleted = 0;
+		auto undoManager = makeOwned<UIUndoManager> ();
+		undoManager->setMaxActions (3);
+		for (auto i = 0; i < 5; ++i)
+			undoManager->pushAndPerform (new TestAction (numDeleted));
+		EXPECT(undoManager->getNumActions () == 3);
+		EXPECT(numDeleted == 2);
+		for (auto i = 0; i < 3; ++i)
+		{
+			EXPECT(undoManager->canUndo ());
+			undoManager->performUndo ();
+		}
+		EXPECT(undoManager->canUndo () == false);
+	);
+
+	TEST(maxMemoryUsage,
+		int32_t numDeleted = 0;
+		auto undoManager = makeOwned<UIUndoManager> ();
+		undoManager->setMaxMemoryUsage (2500);
+		for (auto i = 0; i < 5; ++i)
+			undoManager->pushAndPerform (new TestAction (numDeleted, 1000));
+		EXPECT(undoManager->getNumActions () == 2);
+		EXPECT(undoManager->getMemoryUsage () <= 2500);
+		undoManager->pushAndPerform (new TestAction (numDeleted, 10000));
+		EXPECT(undoManager->getNumActions () == 1);
+		EXPECT(undoManager->canUndo ());
+	);
+
+	TEST(memoryUsageFollowsTheActions,
+		int32_t numDeleted = 0;
+		auto undoManager = makeOwned<UIUndoManager> ();
+		auto emptyMemoryUsage = undoManager->getMemoryUsage ();
+		for (auto i = 0; i < 3; ++i)
+			undoManager->pushAndPerform (new TestAction (numDeleted, 1000));
+		EXPECT(undoManager->getMemoryUsage () == emptyMemoryUsage + 3000);
+		undoManager->performUndo ();
+		undoManager->pushAndPerform (new TestAction (numDeleted, 500));
+		EXPECT(undoManager->getMemoryUsage () == emptyMemoryUsage + 2500);
+		undoManager->setMaxActions (1);
+		EXPECT(undoManager->getMemoryUsage () == emptyMemoryUsage + 500);
+		undoManager->clear ();
+		EXPECT(undoManager->getMemoryUsage () == emptyMemoryUsage);
+	);
+
+	TEST(redoActionsAreNotTrimmed,
+		int32_t numDeleted = 0;
+		auto undoManager = makeOwned<UIUndoManager> ();
+		for (auto i = 0; i < 3; ++i)
+			undoManager->pushAndPerform (new TestAction (numDeleted));
+		undoManager->performUndo ();
+		undoManager->performUndo ();
+		undoManager->setMaxActions (1);
+		EXPECT(numDeleted == 0);
+		EXPECT(undoManager->canRedo ());
+	);
+
+	TEST(trimKeepsSavePosition,
+		int32_t numDeleted = 0;
+		auto undoManager = makeOwned<UIUndoManager> ();
+		undoManager->setMaxActions (2);
+		undoManager->pushAndPerform (new TestAction (numDeleted));
+		undoManager->markSavePosition ();
+		undoManager->pushAndPerform (new TestAction (numDeleted));
+		undoManager->pushAndPerform (new TestAction (numDeleted));
+		EXPECT(numDeleted == 1);
+		undoManager->performUndo ();
+		EXPECT(undoManager->isSavePosition () == false);
+		undoManager->performUndo ();
+		EXPECT(undoManager->isSavePosition ());
+	);
+);
+
+} // VSTGUI
+
+#endif // VSTGUI_LIVE_EDITING
@@ -4,6 +4,7 @@
 
 #include "../unittests.h"
 #include "../../../uidescription/uidescription.h"
+#include "../../../uidescription/uiviewplaceholder.h"
 #include "../../../uidescription/uiattributes.h"
 #include "../../../uidescription/icontroller.h"
 #include "../../../uidescription/xmlparser.h"
@@ -11,6 +12,7 @@
 #include "../../../lib/ccolor.h"
 #include "../../../lib/cbitmap.h"
 #include "../../../lib/cgradient.h"
+#include "../../../lib/cframe.h"
 #include "../../../lib/cviewcontainer.h"
 
 namespace VSTGUI {
@@ -56,6 +58,21 @@ constexpr auto bitmapNodesUIDesc = R"(
 </vstgui-ui-description>
 )";
 
+constexpr auto atlasBitmapNodesUIDesc = R"(
+<vstgui-ui-description version="1">
+	<bitmaps>
+		<bitmap name="sheet" path="sheet.png"/>
+		<bitmap name="knob" atlas="sheet" frame-size="10, 10">
+			<frame region="0, 0, 10, 10"/>
+			<frame region="10, 0, 16, 6" offset="2, 2"/>
+		</bitmap>
+		<bitmap name="self" atlas="self" frame-size="10, 10"/>
+		<bitmap name="a" atlas="b" frame-size="10, 10"/>
+		<bitmap name="b" atlas="a" frame-size="10, 10"/>
+	</bitmaps>
+</vstgui-ui-description>
+)";
+
 constexpr auto tagNodesUIDesc = R"(
 <vstgui-ui-description version="1">
 	<control-tags>
@@ -187,6 +204,26 @@ constexpr auto restoreViewUIDesc = R"(
 </vstgui-ui-description>
 )";
 
+constexpr auto lazyViewUIDesc = R"(
+<vstgui-ui-description version="1">
+	<template class="CViewContainer" name="view" origin="0, 0" size="400, 235">
+		<view class="CViewContainer" lazy-creation="true" opacity="0.5" origin="4, 10" size="392, 40" transparent="false">
+			<view class="CView" origin="0, 0" size="10, 10"/>
+		</view>
+	</template>
+</vstgui-ui-description>
+)";
+
+struct VerifyCountController : public Controller
+{
+	CView* verifyView (CView* view, const UIAttributes& attributes, const IUIDescription* description) override
+	{
+		++numVerified;
+		return view;
+	}
+	int32_t numVerified {0};
+};
+
 #if 0
 constexpr auto completeExample = R"(
 <vstgui-ui-description version="1">
@@ -417,6 +454,28 @@ TESTCASE(UIDescriptionTests,
 		EXPECT(dynamic_cast<CNinePartTiledBitmap*>(bitmap) == nullptr);
 	);
 	
+	TEST(atlasBitmaps,
+		Xml::MemoryContentProvider provider (atlasBitmapNodesUIDesc, static_cast<uint32_t> (strlen (atlasBitmapNodesUIDesc)));
+		UIDescription desc (&provider);
+		EXPECT(desc.parse () == true);
+		auto bitmap = dynamic_cast<CAtlasBitmap*> (desc.getBitmap ("knob"));
+		EXPECT(bitmap);
+		EXPECT(bitmap->getAtlas () == desc.getBitmap ("sheet"));
+		EXPECT(bitmap->getFrames ().size () == 2);
+		EXPECT(bitmap->getFrames ()[1].offset == CPoint (2, 2));
+		EXPECT(bitmap->getHeight () == 20);
+	);
+
+	TEST(atlasBitmapCyclesAreNotResolved,
+		Xml::MemoryContentProvider provider (atlasBitmapNodesUIDesc, static_cast<uint32_t> (strlen (atlasBitmapNodesUIDesc)));
+		UIDescription desc (&provider);
+		EXPECT(desc.parse () == true);
+		EXPECT(desc.getBitmap ("self") == nullptr);
+		EXPECT(desc.getBitmap ("a") == nullptr);
+		EXPECT(desc.getBitmap ("b") == nullptr);
+		EXPECT(desc.getBitmap ("knob"));
+	);
+
 	TEST(tags,
 		Xml::MemoryContentProvider provider (tagNodesUIDesc, static_cast<uint32_t> (strlen(tagNodesUIDesc)));
 		UIDescription desc (&provider);
@@ -677,6 +736,65 @@ TESTCASE(UIDescriptionTests,
 		view->removed (parentContainer);
 	);
 
+	TEST(storeRestoreViewsBinary,
+		Xml::MemoryContentProvider provider (restoreViewUIDesc, static_cast<uint32_t> (strlen(restoreViewUIDesc)));
+		UIDescription desc (&provider);
+		EXPECT(desc.parse () == true);
+
+		Controller controller;
+		auto view = owned (desc.createView ("view", &controller));
+		EXPECT(view);
+		auto parentContainer = owned (new CViewContainer (CRect (0, 0, 10, 10)));
+		view->attached (parentContainer);
+		auto viewToStore = view.cast<CViewContainer>()->getView (1);
+
+		UIAttributes customAttributes;
+		customAttributes.setAttribute ("Test", "Value");
+		customAttributes.setIntegerAttribute ("Integer", -5);
+		customAttributes.setBooleanAttribute ("Bool", true);
+
+		CMemoryStream xmlStream (1024, 1024, false);
+		EXPECT(desc.storeViews ({viewToStore}, xmlStream, &customAttributes));
+		CMemoryStream memoryStream (1024, 1024, false);
+		EXPECT(desc.storeViews ({viewToStore}, memoryStream, &customAttributes, UIDescription::kBinaryViewsFormat));
+		EXPECT(memoryStream.tell () < xmlStream.tell ());
+		memoryStream.rewind ();
+
+		std::list<SharedPointer<CView>> restoredView;
+		UIAttributes* customAttributesRestored = nullptr;
+		EXPECT(desc.restoreViews (memoryStream, restoredView, &customAttributesRestored));
+		EXPECT(restoredView.size () == 1);
+		auto container = restoredView.front ().cast<CViewContainer> ();
+		EXPECT(container);
+		EXPECT(container->getViewSize () == viewToStore->getViewSize ());
+		EXPECT(container->getNbViews () == 1);
+		EXPECT(container->getView (0)->getViewSize () == CRect (4, 10, 396, 50));
+
+		EXPECT(customAttributesRestored);
+		EXPECT(*customAttributesRestored->getAttributeValue ("Test") == "Value");
+		EXPECT(*customAttributesRestored->getAttributeValue ("Integer") == "-5");
+		EXPECT(*customAttributesRestored->getAttributeValue ("Bool") == "true");
+		customAttributesRestored->forget ();
+		view->removed (parentContainer);
+	);
+
+	TEST(restoreTruncatedBinaryViewsFails,
+		Xml::MemoryContentProvider provider (restoreViewUIDesc, static_cast<uint32_t> (strlen(restoreViewUIDesc)));
+		UIDescription desc (&provider);
+		EXPECT(desc.parse () == true);
+
+		Controller controller;
+		auto view = owned (desc.createView ("view", &controller));
+		EXPECT(view);
+
+		CMemoryStream memoryStream (1024, 1024, false);
+		EXPECT(desc.storeViews ({view.cast<CViewContainer>()->getView (1)}, memoryStream, nullptr, UIDescription::kBinaryViewsFormat));
+		CMemoryStream truncatedStream (memoryStream.getBuffer (), static_cast<uint32_t> (memoryStream.tell () - 4), false);
+		std::list<SharedPointer<CView>> restoredView;
+		EXPECT(desc.restoreViews (truncatedStream, restoredView) == false);
+		EXPECT(restoredView.empty ());
+	);
+
 	TEST(updateViewDescription,
 		Xml::MemoryContentProvider provider (createViewUIDesc, static_cast<uint32_t> (strlen (createViewUIDesc)));
 		UIDescription desc (&provider);
@@ -705,6 +823,112 @@ TESTCASE(UIDescriptionTests,
 		EXPECT(desc.setCustomAttributes("Test", nullptr) == false);
 	);
 
+	TEST(lazyViewCreatesPlaceholder,
+		Xml::MemoryContentProvider provider (lazyViewUIDesc, static_cast<uint32_t> (strlen (lazyViewUIDesc)));
+		UIDescription desc (&provider);
+		EXPECT(desc.parse () == true);
+		VerifyCountController controller;
+		auto view = owned (desc.createView ("view", &controller));
+		EXPECT(view);
+		// the template view and the placeholder
+		EXPECT(controller.numVerified == 2);
+		auto placeholder = dynamic_cast<UIViewPlaceholder*> (view.cast<CViewContainer> ()->getView (0));
+		EXPECT(placeholder);
+		EXPECT(placeholder->isMaterialized () == false);
+		EXPECT(placeholder->isVisible () == false);
+		EXPECT(placeholder->getViewSize () == CRect (4, 10, 396, 50));
+		EXPECT(placeholder->getAlphaValue () == 1.f);
+		EXPECT(placeholder->getNbViews () == 0);
+	);
+
+	TEST(lazyViewInAttachedTemplateIsNotCreatedUntilShown,
+		Xml::MemoryContentProvider provider (lazyViewUIDesc, static_cast<uint32_t> (strlen (lazyViewUIDesc)));
+		UIDescription desc (&provider);
+		EXPECT(desc.parse () == true);
+		VerifyCountController controller;
+		auto frame = owned (new CFrame (CRect (0, 0, 400, 235), nullptr));
+		auto view = desc.createView ("view", &controller);
+		EXPECT(view);
+		frame->addView (view);
+		frame->attached (frame);
+		auto placeholder = dynamic_cast<UIViewPlaceholder*> (view->asViewContainer ()->getView (0));
+		EXPECT(placeholder);
+		EXPECT(placeholder->isAttached ());
+		EXPECT(placeholder->isMaterialized () == false);
+		EXPECT(frame->getViewAt (CPoint (10, 20), GetViewOptions ().deep ()) == nullptr);
+		EXPECT(placeholder->isMaterialized () == false);
+		EXPECT(controller.numVerified == 2);
+		placeholder->setVisible (true);
+		EXPECT(placeholder->isMaterialized ());
+		EXPECT(controller.numVerified == 4);
+		auto lazyView = placeholder->getView (0);
+		EXPECT(lazyView);
+		EXPECT(lazyView->isAttached ());
+		EXPECT(lazyView->getAlphaValue () == 0.5f);
+		EXPECT(placeholder->getAlphaValue () == 1.f);
+		frame->close ();
+	);
+
+	TEST(lazyViewIsCreatedWhenShown,
+		Xml::MemoryContentProvider provider (lazyViewUIDesc, static_cast<uint32_t> (strlen (lazyViewUIDesc)));
+		UIDescription desc (&provider);
+		EXPECT(desc.parse () == true);
+		VerifyCountController controller;
+		auto view = owned (desc.createView ("view", &controller));
+		auto placeholder = dynamic_cast<UIViewPlaceholder*> (view.cast<CViewContainer> ()->getView (0));
+		EXPECT(placeholder);
+		EXPECT(placeholder->isMaterialized () == false);
+		placeholder->setVisible (true);
+		EXPECT(placeholder->isMaterialized ());
+		EXPECT(controller.numVerified == 4);
+		auto lazyView = placeholder->getView (0);
+		EXPECT(lazyView);
+		EXPECT(lazyView->getViewSize () == CRect (0, 0, 392, 40));
+		EXPECT(lazyView->getTransparency () == false);
+		EXPECT(lazyView->asViewContainer ()->getNbViews () == 1);
+		placeholder->setVisible (false);
+		placeholder->setVisible (true);
+		EXPECT(controller.numVerified == 4);
+	);
+
+	TEST(materializeAllLazyViews,
+		Xml::MemoryContentProvider provider (lazyViewUIDesc, static_cast<uint32_t> (strlen (lazyViewUIDesc)));
+		UIDescription desc (&provider);
+		EXPECT(desc.parse () == true);
+		Controller controller;
+		auto view = owned (desc.createView ("view", &controller));
+		UIViewPlaceholder::materializeAll (view.cast<CViewContainer> ());
+		auto placeholder = dynamic_cast<UIViewPlaceholder*> (view.cast<CViewContainer> ()->getView (0));
+		EXPECT(placeholder);
+		EXPECT(placeholder->isMaterialized ());
+		EXPECT(placeholder->getNbViews () == 1);
+	);
+
+	TEST(lazyViewAfterDescriptionDestroyed,
+		auto provider = std::unique_ptr<Xml::MemoryContentProvider> (new Xml::MemoryContentProvider (lazyViewUIDesc, static_cast<uint32_t> (strlen (lazyViewUIDesc))));
+		auto desc = makeOwned<UIDescription> (provider.get ());
+		EXPECT(desc->parse () == true);
+		Controller controller;
+		auto view = owned (desc->createView ("view", &controller));
+		desc = nullptr;
+		auto placeholder = dynamic_cast<UIViewPlaceholder*> (view.cast<CViewContainer> ()->getView (0));
+		EXPECT(placeholder);
+		EXPECT(placeholder->materialize () == nullptr);
+		EXPECT(placeholder->isMaterialized ());
+	);
+
+	TEST(disabledLazyViewCreation,
+		Xml::MemoryContentProvider provider (lazyViewUIDesc, static_cast<uint32_t> (strlen (lazyViewUIDesc)));
+		UIDescription desc (&provider);
+		EXPECT(desc.parse () == true);
+		desc.setLazyViewCreation (false);
+		Controller controller;
+		auto view = owned (desc.createView ("view", &controller));
+		auto child = view.cast<CViewContainer> ()->getView (0);
+		EXPECT(dynamic_cast<UIViewPlaceholder*> (child) == nullptr);
+		EXPECT(child->asViewContainer ()->getNbViews () == 1);
+	);
+
 );
 
 #if 0
@@ -139,6 +139,22 @@ TESTCASE(CViewCreatorTest,
 		});
 	);
 
+	TEST(lazyCreation,
+		testAttribute<CView>(kCView, kAttrLazyCreation, true, nullptr, [&] (CView* v) {
+			uint32_t size;
+			return v->getAttributeSize ('uilc', size);
+		});
+
+		UIViewFactory factory;
+		UIAttributes a;
+		a.setAttribute (kAttrClass, kCView);
+		a.setBooleanAttribute (kAttrLazyCreation, false);
+		auto view = owned (factory.createView (a, nullptr));
+		UIAttributes a2;
+		factory.getAttributesForView (view, nullptr, a2);
+		EXPECT(a2.hasAttribute (kAttrLazyCreation) == false);
+	);
+
 	TEST(opacity,
 		testAttribute<CView>(kCView, kAttrOpacity, 0.5, nullptr, [&] (CView* v) {
 			return v->getAlphaValue() == 0.5;
@@ -60,6 +60,38 @@ TESTCASE(UIViewSwitchContainerCreatorTest,
 		DummyUIDescription uidesc;
 		testPossibleValues (kUIViewSwitchContainer, kAttrAnimationStyle, &uidesc, {"fade", "move", "push"});
 	);
+
+	TEST(cachePolicy,
+		DummyUIDescription uidesc;
+		testAttribute<UIViewSwitchContainer>(kUIViewSwitchContainer, kAttrCachePolicy, "rebuild", &uidesc, [] (UIViewSwitchContainer* v) {
+			return v->getCachePolicy() == UIViewSwitchContainer::kRebuildViews;
+		});
+		testAttribute<UIViewSwitchContainer>(kUIViewSwitchContainer, kAttrCachePolicy, "keep-alive", &uidesc, [] (UIViewSwitchContainer* v) {
+			return v->getCachePolicy() == UIViewSwitchContainer::kKeepViewsAlive;
+		});
+		testAttribute<UIViewSwitchContainer>(kUIViewSwitchContainer, kAttrCachePolicy, "lru", &uidesc, [] (UIViewSwitchContainer* v) {
+			return v->getCachePolicy() == UIViewSwitchContainer::kLRUCachedViews;
+		});
+	);
+
+	TEST(cachePolicyValues,
+		DummyUIDescription uidesc;
+		testPossibleValues (kUIViewSwitchContainer, kAttrCachePolicy, &uidesc, {"rebuild", "keep-alive", "lru"});
+	);
+
+	TEST(maxCachedViews,
+		DummyUIDescription uidesc;
+		testAttribute<UIViewSwitchContainer>(kUIViewSwitchContainer, kAttrMaxCachedViews, 3, &uidesc, [] (UIViewSwitchContainer* v) {
+			return v->getMaxCachedViews() == 3;
+		});
+	);
+
+	TEST(preInstantiateViews,
+		DummyUIDescription uidesc;
+		testAttribute<UIViewSwitchContainer>(kUIViewSwitchContainer, kAttrPreInstantiateViews, true, &uidesc, [] (UIViewSwitchContainer* v) {
+			return v->getPreInstantiateViews();
+		});
+	);
 	
 );
 
@@ -7,6 +7,7 @@
 #include "uidescriptionadapter.h"
 #include "../../../lib/cstring.h"
 #include "../../../lib/controls/cbuttons.h"
+#include "../../../lib/cframe.h"
 
 namespace VSTGUI {
 
@@ -39,6 +40,18 @@ struct TestUIDescription : public UIDescriptionAdapter
 	}
 };
 
+/** releases the controller of a removed view, like the VST3Editor releases its sub controllers */
+struct ReleaseControllerObserver : public IViewAddedRemovedObserver
+{
+	void onViewAdded (CFrame* frame, CView* view) override {}
+	void onViewRemoved (CFrame* frame, CView* view) override
+	{
+		if (view->removeAttribute (kCViewControllerAttribute))
+			++numReleased;
+	}
+	uint32_t numReleased {0};
+};
+
 TESTCASE(UIViewSwitchControllerTest,
 
 	TEST (switchViaIndex,
@@ -114,6 +127,180 @@ TESTCASE(UIViewSwitchControllerTest,
 		container->removed (rootView);
 	);
 
+	TEST (rebuildViews,
+		TestUIDescription uiDesc;
+		auto rootView = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto container = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto viewSwitch = new UIViewSwitchContainer (CRect (0, 0, 100, 100));
+		viewSwitch->setAnimationTime (0);
+		auto controller = new UIDescriptionViewSwitchController (viewSwitch, &uiDesc, nullptr);
+		controller->setTemplateNames ("v1,v2");
+		EXPECT(container->addView (viewSwitch));
+		container->attached (rootView);
+		viewSwitch->setCurrentViewIndex (0);
+		auto view = shared (viewSwitch->getView (0));
+		viewSwitch->setCurrentViewIndex (1);
+		viewSwitch->setCurrentViewIndex (0);
+		EXPECT(dynamic_cast<View1*> (viewSwitch->getView (0)));
+		EXPECT(viewSwitch->getView (0) != view);
+		container->removed (rootView);
+	);
+
+	TEST (keepViewsAlive,
+		TestUIDescription uiDesc;
+		auto rootView = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto container = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto viewSwitch = new UIViewSwitchContainer (CRect (0, 0, 100, 100));
+		viewSwitch->setAnimationTime (0);
+		viewSwitch->setCachePolicy (UIViewSwitchContainer::kKeepViewsAlive);
+		auto controller = new UIDescriptionViewSwitchController (viewSwitch, &uiDesc, nullptr);
+		controller->setTemplateNames ("v1,v2,v3");
+		EXPECT(container->addView (viewSwitch));
+		container->attached (rootView);
+		viewSwitch->setCurrentViewIndex (0);
+		auto view1 = viewSwitch->getCurrentView ();
+		viewSwitch->setCurrentViewIndex (1);
+		auto view2 = viewSwitch->getCurrentView ();
+		viewSwitch->setCurrentViewIndex (2);
+		viewSwitch->setCurrentViewIndex (0);
+		EXPECT(viewSwitch->getCurrentView () == view1);
+		EXPECT(viewSwitch->getNbViews () == 3);
+		EXPECT(view1->isVisible ());
+		EXPECT(view2->isVisible () == false);
+		viewSwitch->setCurrentViewIndex (1);
+		EXPECT(viewSwitch->getCurrentView () == view2);
+		EXPECT(view1->isVisible () == false);
+		container->removed (rootView);
+	);
+
+	TEST (lruCachedViews,
+		TestUIDescription uiDesc;
+		auto rootView = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto container = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto viewSwitch = new UIViewSwitchContainer (CRect (0, 0, 100, 100));
+		viewSwitch->setAnimationTime (0);
+		viewSwitch->setCachePolicy (UIViewSwitchContainer::kLRUCachedViews);
+		viewSwitch->setMaxCachedViews (2);
+		auto controller = new UIDescriptionViewSwitchController (viewSwitch, &uiDesc, nullptr);
+		controller->setTemplateNames ("v1,v2,v3");
+		EXPECT(container->addView (viewSwitch));
+		container->attached (rootView);
+		viewSwitch->setCurrentViewIndex (0);
+		auto view1 = shared (viewSwitch->getCurrentView ());
+		viewSwitch->setCurrentViewIndex (1);
+		auto view2 = viewSwitch->getCurrentView ();
+		viewSwitch->setCurrentViewIndex (2);
+		EXPECT(viewSwitch->getNbViews () == 2);
+		EXPECT(view1->isSubview () == false);
+		viewSwitch->setCurrentViewIndex (1);
+		EXPECT(viewSwitch->getCurrentView () == view2);
+		viewSwitch->setCurrentViewIndex (0);
+		EXPECT(dynamic_cast<View1*> (viewSwitch->getCurrentView ()));
+		EXPECT(viewSwitch->getCurrentView () != view1);
+		container->removed (rootView);
+	);
+
+	TEST (cachedViewIsResetAfterFadeOut,
+		TestUIDescription uiDesc;
+		auto frame = owned (new CFrame (CRect (0, 0, 100, 100), nullptr));
+		auto viewSwitch = new UIViewSwitchContainer (CRect (0, 0, 100, 100));
+		viewSwitch->setAnimationTime (1000);
+		viewSwitch->setAnimationStyle (UIViewSwitchContainer::kFadeInOut);
+		viewSwitch->setCachePolicy (UIViewSwitchContainer::kKeepViewsAlive);
+		auto controller = new UIDescriptionViewSwitchController (viewSwitch, &uiDesc, nullptr);
+		controller->setTemplateNames ("v1,v2");
+		frame->addView (viewSwitch);
+		frame->attached (frame);
+		viewSwitch->setCurrentViewIndex (0);
+		auto view1 = viewSwitch->getCurrentView ();
+		viewSwitch->setCurrentViewIndex (1);
+		auto view2 = viewSwitch->getCurrentView ();
+		EXPECT(view1->isVisible ());
+		EXPECT(view2->getAlphaValue () == 0.f);
+		// switching again finishes the running animation
+		viewSwitch->setAnimationTime (0);
+		viewSwitch->setCurrentViewIndex (0);
+		EXPECT(viewSwitch->getCurrentView () == view1);
+		EXPECT(view1->isVisible ());
+		EXPECT(view1->getAlphaValue () == 1.f);
+		EXPECT(view2->isVisible () == false);
+		EXPECT(view2->getAlphaValue () == 1.f);
+		frame->close ();
+	);
+
+	TEST (cachedViewsAreNotRemovedFromTheFrame,
+		TestUIDescription uiDesc;
+		ReleaseControllerObserver observer;
+		auto frame = owned (new CFrame (CRect (0, 0, 100, 100), nullptr));
+		frame->setViewAddedRemovedObserver (&observer);
+		auto viewSwitch = new UIViewSwitchContainer (CRect (0, 0, 100, 100));
+		viewSwitch->setAnimationTime (0);
+		viewSwitch->setCachePolicy (UIViewSwitchContainer::kKeepViewsAlive);
+		auto controller = new UIDescriptionViewSwitchController (viewSwitch, &uiDesc, nullptr);
+		controller->setTemplateNames ("v1,v2");
+		frame->addView (viewSwitch);
+		frame->attached (frame);
+		viewSwitch->setCurrentViewIndex (0);
+		auto view1 = viewSwitch->getCurrentView ();
+		IController* viewController = nullptr;
+		view1->setAttribute (kCViewControllerAttribute, viewController);
+		viewSwitch->setCurrentViewIndex (1);
+		viewSwitch->setCurrentViewIndex (0);
+		EXPECT(viewSwitch->getCurrentView () == view1);
+		EXPECT(observer.numReleased == 0);
+		uint32_t size = 0;
+		EXPECT(view1->getAttributeSize (kCViewControllerAttribute, size));
+		frame->removeAll ();
+		EXPECT(observer.numReleased == 1);
+		frame->setViewAddedRemovedObserver (nullptr);
+		frame->close ();
+	);
+
+	TEST (lruEvictedViewIsRemovedFromTheFrame,
+		TestUIDescription uiDesc;
+		ReleaseControllerObserver observer;
+		auto frame = owned (new CFrame (CRect (0, 0, 100, 100), nullptr));
+		frame->setViewAddedRemovedObserver (&observer);
+		auto viewSwitch = new UIViewSwitchContainer (CRect (0, 0, 100, 100));
+		viewSwitch->setAnimationTime (0);
+		viewSwitch->setCachePolicy (UIViewSwitchContainer::kLRUCachedViews);
+		viewSwitch->setMaxCachedViews (2);
+		auto controller = new UIDescriptionViewSwitchController (viewSwitch, &uiDesc, nullptr);
+		controller->setTemplateNames ("v1,v2,v3");
+		frame->addView (viewSwitch);
+		frame->attached (frame);
+		viewSwitch->setCurrentViewIndex (0);
+		IController* viewController = nullptr;
+		viewSwitch->getCurrentView ()->setAttribute (kCViewControllerAttribute, viewController);
+		viewSwitch->setCurrentViewIndex (1);
+		EXPECT(observer.numReleased == 0);
+		viewSwitch->setCurrentViewIndex (2);
+		EXPECT(observer.numReleased == 1);
+		frame->setViewAddedRemovedObserver (nullptr);
+		frame->close ();
+	);
+
+	TEST (cachedViewKeepsSizeChangedWhileShown,
+		TestUIDescription uiDesc;
+		auto rootView = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto container = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto viewSwitch = new UIViewSwitchContainer (CRect (0, 0, 100, 100));
+		viewSwitch->setAnimationTime (0);
+		viewSwitch->setCachePolicy (UIViewSwitchContainer::kKeepViewsAlive);
+		auto controller = new UIDescriptionViewSwitchController (viewSwitch, &uiDesc, nullptr);
+		controller->setTemplateNames ("v1,v2");
+		EXPECT(container->addView (viewSwitch));
+		container->attached (rootView);
+		viewSwitch->setCurrentViewIndex (0);
+		auto view1 = viewSwitch->getView (0);
+		view1->setViewSize (CRect (0, 0, 50, 50));
+		viewSwitch->setCurrentViewIndex (1);
+		viewSwitch->setCurrentViewIndex (0);
+		EXPECT(viewSwitch->getView (0) == view1);
+		EXPECT(view1->getViewSize () == CRect (0, 0, 50, 50));
+		container->removed (rootView);
+	);
+
 );
 
 } // VSTGUI
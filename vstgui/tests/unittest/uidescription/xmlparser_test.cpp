@@ -4,6 +4,7 @@
 
 #include "../unittests.h"
 #include "../../../uidescription/xmlparser.h"
+#include "../../../uidescription/cstream.h"
 #include <string>
 
 namespace VSTGUI {
@@ -14,8 +15,11 @@ namespace {
 struct Handler : public IHandler
 {
 	bool stopOnStartElement {false};
+	uint32_t numElements {0};
+	std::string charData;
 	void startXmlElement (Parser* parser, IdStringPtr elementName, UTF8StringPtr* elementAttributes) override
 	{
+		++numElements;
 		if (stopOnStartElement)
 			parser->stop ();
 	}
@@ -24,6 +28,7 @@ struct Handler : public IHandler
 	}
 	void xmlCharData (Parser* parser, const int8_t* data, int32_t length) override
 	{
+		charData.append (reinterpret_cast<const char*> (data), static_cast<size_t> (length));
 	}
 	void xmlComment (Parser* parser, IdStringPtr comment) override
 	{
@@ -89,6 +94,32 @@ TESTCASE(XMLParserTest,
 		EXPECT(p.parse (&provider, &handler) == false);
 	);
 
+	TEST(parseFromStream,
+		// CMemoryStream does not provide its memory, so the content is read in chunks
+		CMemoryStream stream;
+		stream.writeRaw (validXML, static_cast<uint32_t> (strlen (validXML)));
+		stream.rewind ();
+		InputStreamContentProvider provider (stream);
+		Handler handler;
+		Parser p;
+		EXPECT(p.parse (&provider, &handler) == true);
+		EXPECT(handler.numElements == 1);
+		EXPECT(handler.charData.find ("CHARDATA") != std::string::npos);
+	);
+
+	TEST(parseFromMemory,
+		MemoryContentProvider provider (validXML, static_cast<uint32_t> (strlen (validXML)));
+		const int8_t* data = nullptr;
+		uint64_t dataSize = 0;
+		EXPECT(provider.getRawXmlData (data, dataSize));
+		EXPECT(dataSize == strlen (validXML));
+		Handler handler;
+		Parser p;
+		EXPECT(p.parse (&provider, &handler) == true);
+		EXPECT(handler.numElements == 1);
+		EXPECT(handler.charData.find ("CHARDATA") != std::string::npos);
+	);
+
 );
 
 } // VSTGUI
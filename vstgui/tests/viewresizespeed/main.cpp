@@ -0,0 +1,153 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/cframe.h"
+#include "vstgui/lib/iviewlistener.h"
+
+#include <chrono>
+#include <cstdio>
+
+#if MAC
+#include <CoreFoundation/CoreFoundation.h>
+namespace VSTGUI { void* gBundleRef = CFBundleGetMainBundle (); }
+#elif WINDOWS
+#include <windows.h>
+void* hInstance = nullptr;
+#elif LINUX
+namespace VSTGUI { void* soHandle = nullptr; }
+#endif
+
+using namespace VSTGUI;
+
+static constexpr auto numLevels = 5;
+static constexpr auto numChildContainers = 4;
+static constexpr auto numLeafViews = 7;
+static constexpr auto numResizes = 500;
+
+//------------------------------------------------------------------------
+class SizeChangeCounter : public ViewListenerAdapter
+{
+public:
+	void viewSizeChanged (CView* view, const CRect& oldSize) override { ++numChanges; }
+
+	uint64_t numChanges {0};
+};
+
+//------------------------------------------------------------------------
+class InvalidRectCounter : public CViewContainer
+{
+public:
+	InvalidRectCounter (const CRect& size) : CViewContainer (size) {}
+
+	void invalidRect (const CRect& rect) override
+	{
+		++numInvalidRects;
+		CViewContainer::invalidRect (rect);
+	}
+
+	uint64_t numInvalidRects {0};
+};
+
+//------------------------------------------------------------------------
+static uint32_t buildTree (CViewContainer* parent, int32_t level, SizeChangeCounter& counter)
+{
+	uint32_t numViews = 0;
+	auto size = parent->getViewSize ();
+	size.originize ();
+	if (level == numLevels - 1)
+	{
+		auto height = size.getHeight () / numLeafViews;
+		for (auto i = 0; i < numLeafViews; ++i)
+		{
+			auto view = new CView (CRect (0, i * height, size.getWidth (), (i + 1) * height));
+			view->setAutosizeFlags (kAutosizeLeft | kAutosizeRight | kAutosizeTop);
+			view->registerViewListener (&counter);
+			parent->addView (view);
+			++numViews;
+		}
+		return numViews;
+	}
+	auto width = size.getWidth () / numChildContainers;
+	for (auto i = 0; i < numChildContainers; ++i)
+	{
+		auto container = new CViewContainer (CRect (i * width, 0, (i + 1) * width, size.getHeight ()));
+		container->setAutosizeFlags (kAutosizeAll);
+		container->registerViewListener (&counter);
+		parent->addView (container);
+		numViews += 1 + buildTree (container, level + 1, counter);
+	}
+	// the child containers share the width of the container
+	parent->setAutosizeFlags (parent->getAutosizeFlags () | kAutosizeColumn);
+	return numViews;
+}
+
+//------------------------------------------------------------------------
+static void unregisterListener (CViewContainer* container, SizeChangeCounter& counter)
+{
+	container->forEachChild ([&] (CView* view) {
+		view->unregisterViewListener (&counter);
+		if (auto childContainer = view->asViewContainer ())
+			unregisterListener (childContainer, counter);
+	});
+}
+
+//------------------------------------------------------------------------
+using Clock = std::chrono::high_resolution_clock;
+
+template<typename Proc>
+static double measureMs (Proc proc)
+{
+	auto start = Clock::now ();
+	proc ();
+	return std::chrono::duration<double, std::milli> (Clock::now () - start).count ();
+}
+
+//------------------------------------------------------------------------
+static void runBenchmark (bool dirtyCallAlwaysOnMainThread)
+{
+	CView::kDirtyCallAlwaysOnMainThread = dirtyCallAlwaysOnMainThread;
+
+	CRect size (0, 0, 1024, 768);
+	auto frame = new CFrame (CRect (0, 0, 2048, 2048), nullptr);
+	auto parent = new InvalidRectCounter (frame->getViewSize ());
+	auto root = new CViewContainer (size);
+	SizeChangeCounter counter;
+	auto numViews = 1 + buildTree (root, 0, counter);
+	parent->addView (root);
+	frame->addView (parent);
+	frame->attached (frame);
+
+	// a live resize of the content of the window
+	counter.numChanges = 0;
+	parent->numInvalidRects = 0;
+	auto resizeTime = measureMs ([&] () {
+		for (auto i = 0; i < numResizes; ++i)
+		{
+			auto delta = static_cast<CCoord> (i % 100 + 1);
+			root->setViewSize (CRect (0, 0, size.getWidth () + delta * 4, size.getHeight () + delta * 2));
+			frame->idle ();
+		}
+	});
+
+	printf ("%d levels, %u views, %s\n", numLevels, numViews,
+	        dirtyCallAlwaysOnMainThread ? "views invalidate immediately" :
+	                                      "views are invalidated in idle");
+	printf ("  resize time: %.4f ms\n", resizeTime / numResizes);
+	printf ("  size change notifications per resize: %.1f\n",
+	        counter.numChanges / static_cast<double> (numResizes));
+	printf ("  invalidated rects per resize: %.1f\n",
+	        parent->numInvalidRects / static_cast<double> (numResizes));
+
+	unregisterListener (root, counter);
+	frame->close ();
+}
+
+//------------------------------------------------------------------------
+int main ()
+{
+	// VST3Editor and the standalone library invalidate immediately
+	runBenchmark (true);
+	runBenchmark (false);
+	return 0;
+}
@@ -0,0 +1,236 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "atlaspacker.h"
+#include "vstgui/lib/cbitmap.h"
+#include "vstgui/lib/ccolor.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+namespace ImageStitcher {
+
+//------------------------------------------------------------------------
+namespace {
+
+//------------------------------------------------------------------------
+struct RectSize
+{
+	uint32_t width {0};
+	uint32_t height {0};
+};
+
+//------------------------------------------------------------------------
+/** bottom-left skyline packer
+ *
+ *	The skyline describes the top edge of the already placed rectangles. New rectangles are
+ *	placed where their bottom edge is the lowest.
+ */
+class Skyline
+{
+public:
+	Skyline (uint32_t width) : width (width) { nodes.push_back ({0, 0, width}); }
+
+	bool insert (const RectSize& size, CPoint& position)
+	{
+		auto bestIndex = nodes.size ();
+		auto bestBottom = std::numeric_limits<uint32_t>::max ();
+		uint32_t bestTop = 0;
+		for (auto index = 0u; index < nodes.size (); ++index)
+		{
+			uint32_t top;
+			if (!fit (index, size.width, top))
+				continue;
+			if (top + size.height < bestBottom)
+			{
+				bestIndex = index;
+				bestBottom = top + size.height;
+				bestTop = top;
+			}
+		}
+		if (bestIndex == nodes.size ())
+			return false;
+		position (nodes[bestIndex].x, bestTop);
+		usedWidth = std::max (usedWidth, nodes[bestIndex].x + size.width);
+		addNode (bestIndex, size.width, bestBottom);
+		usedHeight = std::max (usedHeight, bestBottom);
+		return true;
+	}
+
+	uint32_t getUsedWidth () const { return usedWidth; }
+	uint32_t getUsedHeight () const { return usedHeight; }
+
+private:
+	struct Node
+	{
+		uint32_t x;
+		uint32_t y;
+		uint32_t width;
+	};
+
+	bool fit (size_t index, uint32_t rectWidth, uint32_t& top) const
+	{
+		if (nodes[index].x + rectWidth > width)
+			return false;
+		top = 0;
+		auto remaining = rectWidth;
+		for (; remaining > 0 && index < nodes.size (); ++index)
+		{
+			top = std::max (top, nodes[index].y);
+			remaining -= std::min (remaining, nodes[index].width);
+		}
+		return remaining == 0;
+	}
+
+	void addNode (size_t index, uint32_t nodeWidth, uint32_t y)
+	{
+		nodes.insert (nodes.begin () + index, {nodes[index].x, y, nodeWidth});
+		// shrink or remove the nodes covered by the new node
+		auto right = nodes[index].x + nodeWidth;
+		for (auto i = index + 1; i < nodes.size ();)
+		{
+			auto& node = nodes[i];
+			if (node.x >= right)
+				break;
+			auto overlap = right - node.x;
+			if (node.width <= overlap)
+			{
+				nodes.erase (nodes.begin () + i);
+				continue;
+			}
+			node.x += overlap;
+			node.width -= overlap;
+			break;
+		}
+		for (auto i = 0u; i + 1 < nodes.size ();)
+		{
+			if (nodes[i].y == nodes[i + 1].y)
+			{
+				nodes[i].width += nodes[i + 1].width;
+				nodes.erase (nodes.begin () + i + 1);
+			}
+			else
+				++i;
+		}
+	}
+
+	uint32_t width;
+	uint32_t usedWidth {0};
+	uint32_t usedHeight {0};
+	std::vector<Node> nodes;
+};
+
+//------------------------------------------------------------------------
+} // anonymous
+
+//------------------------------------------------------------------------
+Optional<AtlasLayout> packAtlas (const std::vector<CPoint>& sizes, const AtlasConfig& config)
+{
+	if (sizes.empty ())
+		return {};
+
+	// the padding is added to the right and bottom of every rectangle and removed from the
+	// atlas size at the end
+	std::vector<RectSize> paddedSizes;
+	paddedSizes.reserve (sizes.size ());
+	uint64_t area = 0;
+	uint32_t minWidth = 0;
+	uint32_t maxWidth = 0;
+	for (const auto& size : sizes)
+	{
+		RectSize s;
+		s.width = static_cast<uint32_t> (std::ceil (size.x)) + config.padding;
+		s.height = static_cast<uint32_t> (std::ceil (size.y)) + config.padding;
+		area += static_cast<uint64_t> (s.width) * s.height;
+		minWidth = std::max (minWidth, s.width);
+		maxWidth += s.width;
+		paddedSizes.emplace_back (s);
+	}
+	auto maxSize = config.maxSize + config.padding;
+	maxWidth = std::min (maxWidth, maxSize);
+	if (minWidth > maxWidth)
+		return {};
+
+	// placing the tallest rectangles first gives the flattest skyline
+	std::vector<size_t> order (sizes.size ());
+	std::iota (order.begin (), order.end (), 0);
+	std::stable_sort (order.begin (), order.end (), [&] (size_t lhs, size_t rhs) {
+		if (paddedSizes[lhs].height != paddedSizes[rhs].height)
+			return paddedSizes[lhs].height > paddedSizes[rhs].height;
+		return paddedSizes[lhs].width > paddedSizes[rhs].width;
+	});
+
+	AtlasLayout bestLayout;
+	auto bestArea = std::numeric_limits<uint64_t>::max ();
+	auto bestMaxSide = std::numeric_limits<uint32_t>::max ();
+	auto tryWidth = [&] (uint32_t width) {
+		Skyline skyline (width);
+		std::vector<CPoint> positions (sizes.size ());
+		for (auto index : order)
+		{
+			if (!skyline.insert (paddedSizes[index], positions[index]))
+				return;
+			if (skyline.getUsedHeight () > maxSize)
+				return;
+		}
+		auto atlasArea =
+		    static_cast<uint64_t> (skyline.getUsedWidth ()) * skyline.getUsedHeight ();
+		auto maxSide = std::max (skyline.getUsedWidth (), skyline.getUsedHeight ());
+		if (atlasArea > bestArea || (atlasArea == bestArea && maxSide >= bestMaxSide))
+			return;
+		bestArea = atlasArea;
+		bestMaxSide = maxSide;
+		bestLayout.size (skyline.getUsedWidth () - config.padding,
+		                 skyline.getUsedHeight () - config.padding);
+		bestLayout.positions = std::move (positions);
+	};
+
+	// try a range of widths around the square root of the needed area, very wide atlases are
+	// not wanted even if they are a little bit smaller
+	auto endWidth = std::max (minWidth, static_cast<uint32_t> (2. * std::sqrt (area)));
+	endWidth = std::min (endWidth, maxWidth);
+	static constexpr uint32_t numSteps = 64;
+	auto step = std::max (1u, (endWidth - minWidth) / numSteps);
+	for (auto width = minWidth; width < endWidth; width += step)
+		tryWidth (width);
+	tryWidth (endWidth);
+	if (bestLayout.positions.empty ())
+		return {};
+	return makeOptional (std::move (bestLayout));
+}
+
+//------------------------------------------------------------------------
+CRect getOpaqueBounds (CBitmap* bitmap)
+{
+	auto accessor = owned (CBitmapPixelAccess::create (bitmap));
+	if (!accessor)
+		return {};
+	auto left = accessor->getBitmapWidth ();
+	auto top = accessor->getBitmapHeight ();
+	uint32_t right = 0;
+	uint32_t bottom = 0;
+	CColor color;
+	do
+	{
+		accessor->getColor (color);
+		if (color.alpha == 0)
+			continue;
+		auto x = accessor->getX ();
+		auto y = accessor->getY ();
+		left = std::min (left, x);
+		top = std::min (top, y);
+		right = std::max (right, x + 1);
+		bottom = std::max (bottom, y + 1);
+	} while (++(*accessor));
+	if (right <= left || bottom <= top)
+		return {};
+	return CRect (left, top, right, bottom);
+}
+
+//------------------------------------------------------------------------
+} // ImageStitcher
+} // VSTGUI
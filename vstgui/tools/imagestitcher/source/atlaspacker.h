@@ -0,0 +1,55 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#pragma once
+
+#include "vstgui/lib/cpoint.h"
+#include "vstgui/lib/crect.h"
+#include "vstgui/lib/optional.h"
+#include "vstgui/lib/vstguifwd.h"
+#include <vector>
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+namespace ImageStitcher {
+
+//------------------------------------------------------------------------
+struct AtlasConfig
+{
+	/** empty pixels between the frames in the atlas */
+	uint32_t padding {1};
+	/** maximum width and height of the atlas */
+	uint32_t maxSize {4096};
+	/** remove fully transparent rows and columns at the borders of the frames */
+	bool trimTransparentBorders {true};
+};
+
+//------------------------------------------------------------------------
+struct AtlasLayout
+{
+	/** size of the atlas */
+	CPoint size;
+	/** the position in the atlas for every input rectangle */
+	std::vector<CPoint> positions;
+};
+
+//------------------------------------------------------------------------
+/** pack rectangles into an atlas as small as possible
+ *
+ *	@param sizes sizes of the rectangles
+ *	@param config padding and maximum size of the atlas
+ *	@return the layout or nothing if the rectangles do not fit into the maximum size
+ */
+Optional<AtlasLayout> packAtlas (const std::vector<CPoint>& sizes, const AtlasConfig& config);
+
+//------------------------------------------------------------------------
+/** get the bounds of the pixels of a bitmap which are not fully transparent
+ *
+ *	@return the bounds in pixels or an empty rect if the bitmap is fully transparent
+ */
+CRect getOpaqueBounds (CBitmap* bitmap);
+
+//------------------------------------------------------------------------
+} // ImageStitcher
+} // VSTGUI
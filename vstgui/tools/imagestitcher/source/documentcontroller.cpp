@@ -21,6 +21,7 @@
 #include "vstgui/uidescription/delegationcontroller.h"
 #include "vstgui/uidescription/iuidescription.h"
 #include "vstgui/uidescription/uiattributes.h"
+#include <sstream>
 
 //------------------------------------------------------------------------
 namespace VSTGUI {
@@ -360,6 +361,72 @@ void DocumentWindowController::doExport ()
 	});
 }
 
+//------------------------------------------------------------------------
+static bool exportAtlasDescription (const Path& path, const std::string& bitmapName,
+                                    const std::string& atlasFileName, const CPoint& frameSize,
+                                    const CAtlasBitmap::FrameList& frames)
+{
+	auto atlasName = bitmapName + "-atlas";
+	std::stringstream str;
+	str << "<bitmaps>\n";
+	str << "\t<bitmap name=\"" << atlasName << "\" path=\"" << atlasFileName << "\"/>\n";
+	str << "\t<bitmap name=\"" << bitmapName << "\" atlas=\"" << atlasName << "\" frame-size=\""
+	    << frameSize.x << ", " << frameSize.y << "\">\n";
+	for (const auto& frame : frames)
+	{
+		str << "\t\t<frame region=\"" << frame.region.left << ", " << frame.region.top << ", "
+		    << frame.region.right << ", " << frame.region.bottom << "\" offset=\""
+		    << frame.offset.x << ", " << frame.offset.y << "\"/>\n";
+	}
+	str << "\t</bitmap>\n";
+	str << "</bitmaps>\n";
+
+	CFileStream stream;
+	if (!stream.open (path.data (), CFileStream::kWriteMode | CFileStream::kTruncateMode))
+		return false;
+	auto data = str.str ();
+	return stream.writeRaw (data.data (), static_cast<uint32_t> (data.size ())) == data.size ();
+}
+
+//------------------------------------------------------------------------
+void DocumentWindowController::doExportAtlas ()
+{
+	auto fs =
+	    owned (CNewFileSelector::create (contentView, CNewFileSelector::Style::kSelectSaveFile));
+	if (!fs)
+		return;
+	fs->setTitle ("Save Atlas Image");
+	fs->setDefaultExtension (pngFileExtension);
+	fs->run ([this] (CNewFileSelector* fs) {
+		if (fs->getNumSelectedFiles () == 0)
+			return;
+		Path imagePath (fs->getSelectedFile (0));
+		auto descPath = imagePath;
+		auto extPos = descPath.find_last_of ('.');
+		if (extPos != Path::npos && descPath.find (PathSeparator, extPos) == Path::npos)
+			descPath.erase (extPos);
+		descPath += ".xml";
+
+		auto bitmapName = getDisplayFilename (docContext->getPath ());
+		auto namePos = bitmapName.find_last_of ('.');
+		if (namePos != std::string::npos && namePos > 0)
+			bitmapName.erase (namePos);
+
+		CAtlasBitmap::FrameList frames;
+		auto image = createAtlasBitmap (AtlasConfig (), frames);
+		if (!image || !exportImage (image, imagePath.data ()) ||
+		    !exportAtlasDescription (descPath, bitmapName, getDisplayFilename (imagePath),
+		                             CPoint (docContext->getWidth (), docContext->getHeight ()),
+		                             frames))
+		{
+			AlertBoxForWindowConfig alert;
+			alert.window = window;
+			alert.headline = "Export failed";
+			IApplication::instance ().showAlertBoxForWindow (alert);
+		}
+	});
+}
+
 //------------------------------------------------------------------------
 void DocumentWindowController::doSave ()
 {
@@ -604,6 +671,8 @@ bool DocumentWindowController::canHandleCommand (const Command& command)
 		return !imageList.empty ();
 	if (command == ExportCommand)
 		return !imageList.empty ();
+	if (command == ExportAtlasCommand)
+		return !imageList.empty ();
 	if (command == Commands::SaveDocumentAs)
 		return !imageList.empty ();
 	if (command == Commands::SaveDocument)
@@ -629,6 +698,11 @@ bool DocumentWindowController::handleCommand (const Command& command)
 		doExport ();
 		return true;
 	}
+	if (command == ExportAtlasCommand)
+	{
+		doExportAtlas ();
+		return true;
+	}
 	if (command == Commands::SaveDocument)
 	{
 		doSave ();
@@ -667,6 +741,49 @@ SharedPointer<CBitmap> DocumentWindowController::createStitchedBitmap ()
 	return shared (offscreen->getBitmap ());
 }
 
+//------------------------------------------------------------------------
+SharedPointer<CBitmap> DocumentWindowController::createAtlasBitmap (
+    const AtlasConfig& config, CAtlasBitmap::FrameList& frames)
+{
+	if (!contentView || imageList.empty ())
+		return nullptr;
+
+	std::vector<CRect> sourceRects;
+	std::vector<CPoint> sizes;
+	for (auto& image : imageList)
+	{
+		CRect r (0, 0, docContext->getWidth (), docContext->getHeight ());
+		if (config.trimTransparentBorders)
+		{
+			r = getOpaqueBounds (image.bitmap);
+			// fully transparent frames still need a region
+			if (r.isEmpty ())
+				r (0, 0, 1, 1);
+		}
+		sourceRects.emplace_back (r);
+		sizes.emplace_back (r.getSize ());
+	}
+	auto layout = packAtlas (sizes, config);
+	if (!layout)
+		return nullptr;
+
+	auto offscreen = COffscreenContext::create (contentView, layout->size.x, layout->size.y);
+	if (!offscreen)
+		return nullptr;
+
+	frames.clear ();
+	offscreen->beginDraw ();
+	for (auto index = 0u; index < imageList.size (); ++index)
+	{
+		CRect region (layout->positions[index], sizes[index]);
+		imageList[index].bitmap->draw (offscreen, region, sourceRects[index].getTopLeft ());
+		frames.emplace_back (region, sourceRects[index].getTopLeft ());
+	}
+	offscreen->endDraw ();
+
+	return shared (offscreen->getBitmap ());
+}
+
 //------------------------------------------------------------------------
 void DocumentWindowController::setDirty ()
 {
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include "atlaspacker.h"
 #include "document.h"
+#include "vstgui/lib/cbitmap.h"
 #include "vstgui/lib/cfileselector.h"
 #include "vstgui/lib/cvstguitimer.h"
 #include "vstgui/standalone/include/helpers/windowcontroller.h"
@@ -22,6 +24,9 @@ class ImageFramesView;
 //------------------------------------------------------------------------
 static constexpr IdStringPtr ExportStr = "Export...";
 static const Standalone::Command ExportCommand {Standalone::CommandGroup::File, ExportStr};
+static constexpr IdStringPtr ExportAtlasStr = "Export Atlas...";
+static const Standalone::Command ExportAtlasCommand {Standalone::CommandGroup::File,
+                                                    ExportAtlasStr};
 static CFileExtension imageStitchExtension ("Image Stitch File", "imagestitch", "", 0, "");
 
 //------------------------------------------------------------------------
@@ -47,6 +52,8 @@ public:
 
 	const DocumentContextPtr& getDoc () const noexcept { return docContext; }
 	SharedPointer<CBitmap> createStitchedBitmap ();
+	SharedPointer<CBitmap> createAtlasBitmap (const AtlasConfig& config,
+	                                          CAtlasBitmap::FrameList& frames);
 
 	void showWindow ();
 	void closeWindow ();
@@ -76,6 +83,7 @@ private:
 	void doStartAnimation ();
 	void doStopAnimation ();
 	void doExport ();
+	void doExportAtlas ();
 	void doSave ();
 
 	bool somethingSelected () const;
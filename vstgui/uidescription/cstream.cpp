@@ -15,6 +15,18 @@
 
 namespace VSTGUI {
 
+//-----------------------------------------------------------------------------
+static VSTGUI::SeekMode toPlatformSeekMode (SeekableStream::SeekMode mode)
+{
+	switch (mode)
+	{
+		case SeekableStream::kSeekCurrent: return VSTGUI::SeekMode::Current;
+		case SeekableStream::kSeekSet: return VSTGUI::SeekMode::Set;
+		case SeekableStream::kSeekEnd: return VSTGUI::SeekMode::End;
+	}
+	return VSTGUI::SeekMode::Set;
+}
+
 //-----------------------------------------------------------------------------
 CMemoryStream::CMemoryStream (uint32_t initialSize, uint32_t inDelta, bool binaryMode, ByteOrder byteOrder)
 : OutputStream (byteOrder)
@@ -60,19 +72,18 @@ bool CMemoryStream::resize (uint32_t inSize)
 	if (ownsBuffer == false)
 		return false;
 
-	uint32_t newSize = bufferSize + delta;
-	while (newSize < inSize)
-		newSize += delta;
+	// grow geometrically so that writing a large stream in small pieces is linear
+	uint64_t newSize = static_cast<uint64_t> (bufferSize) + std::max (delta, bufferSize);
+	newSize = std::max<uint64_t> (newSize, inSize);
+	newSize = std::min<uint64_t> (newSize, std::numeric_limits<uint32_t>::max ());
 
-	int8_t* newBuffer = (int8_t*)std::malloc (newSize);
-	if (newBuffer && buffer)
-		memcpy (newBuffer, buffer, size);
-	if (buffer)
-		std::free (buffer);
+	auto newBuffer = static_cast<int8_t*> (std::realloc (buffer, static_cast<size_t> (newSize)));
+	if (newBuffer == nullptr)
+		return false;
 	buffer = newBuffer;
-	bufferSize = newSize;
+	bufferSize = static_cast<uint32_t> (newSize);
 	
-	return buffer != nullptr;
+	return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -88,6 +99,24 @@ uint32_t CMemoryStream::writeRaw (const void* inBuffer, uint32_t inSize)
 	return inSize;
 }
 
+//-----------------------------------------------------------------------------
+uint32_t CMemoryStream::writeRawChunks (const RawChunk* chunks, size_t numChunks)
+{
+	uint64_t totalSize = 0;
+	for (auto chunk = chunks; chunk != chunks + numChunks; ++chunk)
+		totalSize += chunk->size;
+	if (pos + totalSize > std::numeric_limits<uint32_t>::max () ||
+	    !resize (static_cast<uint32_t> (pos + totalSize)))
+		return kStreamIOError;
+	for (auto chunk = chunks; chunk != chunks + numChunks; ++chunk)
+	{
+		memcpy (buffer + pos, chunk->buffer, chunk->size);
+		pos += chunk->size;
+	}
+	size = pos;
+	return static_cast<uint32_t> (totalSize);
+}
+
 //-----------------------------------------------------------------------------
 uint32_t CMemoryStream::readRaw (void* outBuffer, uint32_t outSize)
 {
@@ -111,7 +140,7 @@ int64_t CMemoryStream::seek (int64_t seekpos, SeekMode mode)
 		case kSeekCurrent: newPos = pos + seekpos; break;
 		case kSeekEnd: newPos = size - seekpos; break;
 	}
-	if (newPos <= size && newPos > 0)
+	if (newPos <= size && newPos >= 0)
 	{
 		pos = static_cast<uint32_t> (newPos);
 		return pos;
@@ -353,16 +382,7 @@ uint32_t CResourceInputStream::readRaw (void* buffer, uint32_t size)
 int64_t CResourceInputStream::seek (int64_t pos, SeekMode mode)
 {
 	if (platformStream)
-	{
-		VSTGUI::SeekMode sm = VSTGUI::SeekMode::Set;
-		switch (mode)
-		{
-			case kSeekCurrent: sm = VSTGUI::SeekMode::Current; break;
-			case kSeekSet: sm = VSTGUI::SeekMode::Set; break;
-			case kSeekEnd: sm = VSTGUI::SeekMode::End; break;
-		}
-		return platformStream->seek (pos, sm);
-	}
+		return platformStream->seek (pos, toPlatformSeekMode (mode));
 	return kStreamSeekError;
 }
 
@@ -382,6 +402,14 @@ void CResourceInputStream::rewind ()
 		platformStream->seek (0, VSTGUI::SeekMode::Set);
 }
 
+//-----------------------------------------------------------------------------
+const int8_t* CResourceInputStream::getMemory (uint64_t& size) const
+{
+	if (platformStream)
+		return static_cast<const int8_t*> (platformStream->getMemory (size));
+	return nullptr;
+}
+
 //-----------------------------------------------------------------------------
 template<typename T>
 void endianSwap (T& value)
@@ -411,6 +439,19 @@ bool writeEndianSwap (const T& value, OutputStream& s)
 
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+uint32_t OutputStream::writeRawChunks (const RawChunk* chunks, size_t numChunks)
+{
+	uint32_t written = 0;
+	for (auto chunk = chunks; chunk != chunks + numChunks; ++chunk)
+	{
+		if (writeRaw (chunk->buffer, chunk->size) != chunk->size)
+			return kStreamIOError;
+		written += chunk->size;
+	}
+	return written;
+}
+
 //-----------------------------------------------------------------------------
 bool OutputStream::operator<< (const int8_t& input)
 {
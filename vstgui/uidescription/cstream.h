@@ -8,6 +8,7 @@
 #include "../lib/vstguifwd.h"
 #include "../lib/optional.h"
 #include <algorithm>
+#include <initializer_list>
 #include <string>
 #include <limits>
 #include <memory>
@@ -40,6 +41,19 @@ public:
 	virtual bool operator<< (const std::string& str) = 0;
 
 	virtual uint32_t writeRaw (const void* buffer, uint32_t size) = 0;
+
+	struct RawChunk
+	{
+		const void* buffer;
+		uint32_t size;
+	};
+	/** write multiple chunks at once, like writev.
+		returns the number of bytes written or kStreamIOError */
+	virtual uint32_t writeRawChunks (const RawChunk* chunks, size_t numChunks);
+	uint32_t writeRawChunks (std::initializer_list<RawChunk> chunks)
+	{
+		return writeRawChunks (chunks.begin (), chunks.size ());
+	}
 private:
 	ByteOrder byteOrder;
 };
@@ -92,8 +106,23 @@ public:
 	virtual void rewind () = 0;
 };
 
+/**
+	Interface for streams which can provide their whole content as one block of memory
+ */
+class MemoryBackedStream
+{
+public:
+	virtual ~MemoryBackedStream () noexcept = default;
+
+	/** returns nullptr if the content is not available in memory. The memory is valid as long as
+		the stream is open. */
+	virtual const int8_t* getMemory (uint64_t& size) const = 0;
+};
+
 /**
 	Memory input and output stream
+
+	The buffer grows geometrically, delta is the minimum number of bytes it grows.
  */
 class CMemoryStream : virtual public OutputStream, virtual public InputStream, public SeekableStream, public AtomicReferenceCounted
 {
@@ -103,6 +132,7 @@ public:
 	~CMemoryStream () noexcept override;
 
 	uint32_t writeRaw (const void* buffer, uint32_t size) override;
+	uint32_t writeRawChunks (const RawChunk* chunks, size_t numChunks) override;
 	uint32_t readRaw (void* buffer, uint32_t size) override;
 
 	int64_t seek (int64_t pos, SeekMode mode) override;
@@ -115,6 +145,7 @@ public:
 	bool operator>> (std::string& string) override;
 
 	using OutputStream::operator<<;
+	using OutputStream::writeRawChunks;
 	using InputStream::operator>>;
 
 	bool end (); // write a zero byte if binaryMode is false
@@ -211,7 +242,7 @@ inline bool pathIsAbsolute (const std::string& path)
 /**
 	Resource input stream
  */
-class CResourceInputStream : public InputStream, public SeekableStream
+class CResourceInputStream : public InputStream, public SeekableStream, public MemoryBackedStream
 {
 public:
 	explicit CResourceInputStream (ByteOrder byteOrder = kNativeByteOrder);
@@ -225,6 +256,8 @@ public:
 	int64_t tell () const override;
 	void rewind () override;
 
+	const int8_t* getMemory (uint64_t& size) const override;
+
 	using InputStream::operator>>;
 protected:
 	std::unique_ptr<IPlatformResourceInputStream> platformStream;
@@ -246,21 +279,17 @@ public:
 	}
 	uint32_t writeRaw (const void* inBuffer, uint32_t size) override
 	{
-		auto written = size;
-		const uint8_t* ptr = reinterpret_cast<const uint8_t*> (inBuffer);
-		while (size)
+		if (buffer.size () + size > bufferSize)
 		{
-			auto toWrite = 1;
-			buffer.emplace_back (*ptr);
-			if (buffer.size () == bufferSize)
-			{
-				if (!flush ())
-					return kStreamIOError;
-			}
-			size -= toWrite;
-			ptr += toWrite;
+			if (!flush ())
+				return kStreamIOError;
+			// blocks which do not fit into the buffer are written directly
+			if (size >= bufferSize)
+				return stream.writeRaw (inBuffer, size);
 		}
-		return written;
+		auto ptr = reinterpret_cast<const uint8_t*> (inBuffer);
+		buffer.insert (buffer.end (), ptr, ptr + size);
+		return size;
 	}
 	bool flush ()
 	{
@@ -81,6 +81,7 @@ static const std::string kAttrAutosize = "autosize";
 static const std::string kAttrTooltip = "tooltip";
 static const std::string kAttrCustomViewName = IUIDescription::kCustomViewName;
 static const std::string kAttrSubController = "sub-controller";
+static const std::string kAttrLazyCreation = "lazy-creation";
 static const std::string kAttrOpacity = "opacity";
 
 //-----------------------------------------------------------------------------
@@ -115,6 +116,7 @@ static const std::string kAttrAutoDragScrolling = "auto-drag-scrolling";
 static const std::string kAttrBordered = "bordered";
 static const std::string kAttrOverlayScrollbars = "overlay-scrollbars";
 static const std::string kAttrFollowFocusView = "follow-focus-view";
+static const std::string kAttrScrollByTransform = "scroll-by-transform";
 static const std::string kAttrAutoHideScrollbars = "auto-hide-scrollbars";
 static const std::string kAttrScrollbarBackgroundColor = "scrollbar-background-color";
 static const std::string kAttrScrollbarFrameColor = "scrollbar-frame-color";
@@ -278,6 +280,9 @@ static const std::string kAttrTemplateNames = "template-names";
 static const std::string kAttrTemplateSwitchControl = "template-switch-control";
 static const std::string kAttrAnimationStyle = "animation-style";
 static const std::string kAttrAnimationTimingFunction = "animation-timing-function";
+static const std::string kAttrCachePolicy = "cache-policy";
+static const std::string kAttrMaxCachedViews = "max-cached-views";
+static const std::string kAttrPreInstantiateViews = "pre-instantiate-views";
 
 //-----------------------------------------------------------------------------
 // CSplitViewCreator attributes
@@ -23,6 +23,17 @@ public:
 	virtual UTF8StringPtr getName () = 0;
 	virtual void perform () = 0;
 	virtual void undo () = 0;
+
+	/** approximate number of bytes the action keeps alive, the default is a guess for actions
+	 *	which only hold a few pointers and strings
+	 */
+	virtual size_t getMemoryUsage () const { return 128; }
+	/** merge an action which was performed directly after this action into this action
+	 *
+	 *	@return true if this action includes the changes of the other action now, the other action
+	 *	is deleted then
+	 */
+	virtual bool merge (IAction* action) { return false; }
 };
 
 //----------------------------------------------------------------------------------------------------
@@ -16,6 +16,27 @@
 
 namespace VSTGUI {
 
+//----------------------------------------------------------------------------------------------------
+static size_t getStringMemoryUsage (const std::string& str)
+{
+	return sizeof (std::string) + str.capacity ();
+}
+
+//----------------------------------------------------------------------------------------------------
+/** a rough guess of the memory used by a view and its subviews, which is kept alive by an action
+ *	when the view is not part of the view hierarchy anymore */
+static size_t getViewTreeMemoryUsage (CView* view)
+{
+	if (auto container = view->asViewContainer ())
+	{
+		size_t result = sizeof (CViewContainer);
+		container->forEachChild (
+		    [&] (CView* child) { result += getViewTreeMemoryUsage (child); });
+		return result;
+	}
+	return sizeof (CView);
+}
+
 //----------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------
@@ -235,6 +256,7 @@ ViewCopyOperation::ViewCopyOperation (UISelection* copySelection, UISelection* w
 			view->setViewSize (newSize);
 			view->setMouseableArea (newSize);
 			emplace_back (view);
+			viewsMemoryUsage += getViewTreeMemoryUsage (view);
 		}
 	}
 
@@ -242,6 +264,13 @@ ViewCopyOperation::ViewCopyOperation (UISelection* copySelection, UISelection* w
 		oldSelectedViews.emplace_back (view);
 }
 
+//-----------------------------------------------------------------------------
+size_t ViewCopyOperation::getMemoryUsage () const
+{
+	return sizeof (*this) + (size () + oldSelectedViews.size ()) * 3 * sizeof (void*) +
+	       viewsMemoryUsage;
+}
+
 //-----------------------------------------------------------------------------
 UTF8StringPtr ViewCopyOperation::getName () 
 {
@@ -343,6 +372,20 @@ void ViewSizeChangeOperation::undo ()
 	}
 }
 
+//-----------------------------------------------------------------------------
+bool ViewSizeChangeOperation::merge (IAction* action)
+{
+	// successive moves or resizes of the same views are undone in one step
+	auto sizeChange = dynamic_cast<ViewSizeChangeOperation*> (action);
+	if (!sizeChange || sizeChange->sizing != sizing || sizeChange->autosizing != autosizing ||
+	    sizeChange->size () != size ())
+		return false;
+	return std::equal (begin (), end (), sizeChange->begin (),
+	                   [] (const value_type& e1, const value_type& e2) {
+		                   return e1.first == e2.first;
+	                   });
+}
+
 //-----------------------------------------------------------------------------
 bool ViewSizeChangeOperation::didChange ()
 {
@@ -382,10 +425,19 @@ DeleteOperation::DeleteOperation (UISelection* selection)
 				++it;
 			}
 			insert (std::make_pair (container, DeleteOperationViewAndNext (view, nextView)));
+			viewsMemoryUsage += getViewTreeMemoryUsage (view);
 		}
 	}
 }
 
+//----------------------------------------------------------------------------------------------------
+size_t DeleteOperation::getMemoryUsage () const
+{
+	// a map node has three pointers and a color in addition to the element
+	return sizeof (*this) + size () * (sizeof (value_type) + 4 * sizeof (void*)) +
+	       viewsMemoryUsage;
+}
+
 //----------------------------------------------------------------------------------------------------
 UTF8StringPtr DeleteOperation::getName ()
 {
@@ -608,6 +660,32 @@ void AttributeChangeAction::perform ()
 	updateSelection ();
 }
 
+//-----------------------------------------------------------------------------
+size_t AttributeChangeAction::getMemoryUsage () const
+{
+	auto result = sizeof (*this) + attrName.capacity () + attrValue.capacity () + name.capacity ();
+	for (auto& element : *this)
+		result += 4 * sizeof (void*) + sizeof (element.first) + getStringMemoryUsage (element.second);
+	return result;
+}
+
+//-----------------------------------------------------------------------------
+bool AttributeChangeAction::merge (IAction* action)
+{
+	// successive changes of the same attribute of the same views are undone in one step
+	auto attributeChange = dynamic_cast<AttributeChangeAction*> (action);
+	if (!attributeChange || attributeChange->desc != desc || attributeChange->attrName != attrName ||
+	    attributeChange->size () != size ())
+		return false;
+	if (!std::equal (begin (), end (), attributeChange->begin (),
+	                 [] (const value_type& e1, const value_type& e2) {
+		                 return e1.first == e2.first;
+	                 }))
+		return false;
+	attrValue = attributeChange->attrValue;
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 void AttributeChangeAction::undo ()
 {
@@ -704,6 +782,16 @@ void MultipleAttributeChangeAction::undo ()
 	setAttributeValue (oldValue.c_str ());
 }
 
+//----------------------------------------------------------------------------------------------------
+size_t MultipleAttributeChangeAction::getMemoryUsage () const
+{
+	auto result = sizeof (*this) + oldValue.capacity () + newValue.capacity () +
+	              (capacity () - size ()) * sizeof (value_type);
+	for (auto& element : *this)
+		result += sizeof (element.first) + getStringMemoryUsage (element.second);
+	return result;
+}
+
 //----------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------
@@ -32,6 +32,12 @@ class BaseSelectionOperation : public IAction, protected std::list<T>
 public:
 	BaseSelectionOperation (UISelection* selection) : selection (selection) {}
 
+	size_t getMemoryUsage () const override
+	{
+		// a list node has two pointers in addition to the element
+		return sizeof (*this) + this->size () * (sizeof (T) + 2 * sizeof (void*));
+	}
+
 protected:
 	SharedPointer<UISelection> selection;	
 };
@@ -94,11 +100,13 @@ public:
 	UTF8StringPtr getName () override;
 	void perform () override;
 	void undo () override;
+	size_t getMemoryUsage () const override;
 protected:
 	SharedPointer<CViewContainer> parent;
 	SharedPointer<UISelection> copySelection;
 	SharedPointer<UISelection> workingSelection;
 	std::list<SharedPointer<CView> > oldSelectedViews;
+	size_t viewsMemoryUsage {0};
 };
 
 //-----------------------------------------------------------------------------
@@ -111,6 +119,7 @@ public:
 	UTF8StringPtr getName () override;
 	void perform () override;
 	void undo () override;
+	bool merge (IAction* action) override;
 	
 	bool didChange ();
 protected:
@@ -138,8 +147,10 @@ public:
 	UTF8StringPtr getName () override;
 	void perform () override;
 	void undo () override;
+	size_t getMemoryUsage () const override;
 protected:
 	SharedPointer<UISelection> selection;
+	size_t viewsMemoryUsage {0};
 };
 
 //-----------------------------------------------------------------------------
@@ -190,6 +201,8 @@ public:
 	UTF8StringPtr getName () override;
 	void perform () override;
 	void undo () override;
+	size_t getMemoryUsage () const override;
+	bool merge (IAction* action) override;
 protected:
 	void updateSelection ();
 	
@@ -208,6 +221,7 @@ public:
 	UTF8StringPtr getName () override { return "multiple view attribute changes"; }
 	void perform () override;
 	void undo () override;
+	size_t getMemoryUsage () const override;
 protected:
 	void setAttributeValue (UTF8StringPtr value);
 	static void collectAllSubViews (CView* view, std::list<CView*>& views);
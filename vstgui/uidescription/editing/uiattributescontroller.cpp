@@ -22,6 +22,7 @@
 #include <sstream>
 #include <algorithm>
 #include <cassert>
+#include <unordered_map>
 
 namespace VSTGUI {
 
@@ -798,6 +799,11 @@ void UIAttributesController::endLiveAttributeChange ()
 //----------------------------------------------------------------------------------------------------
 void UIAttributesController::performAttributeChange (const std::string& name, const std::string& value)
 {
+	for (auto& row : attributeRows)
+	{
+		if (row.name == name)
+			row.valueValid = false;
+	}
 	IAction* action = new AttributeChangeAction (editDescription, selection, name, value);
 	if (liveAction)
 	{
@@ -931,37 +937,37 @@ IController* UIAttributesController::createSubController (IdStringPtr _name, con
 //----------------------------------------------------------------------------------------------------
 void UIAttributesController::onUIDescTagChanged (UIDescription* desc)
 {
-	validateAttributeViews ();
+	invalidateAttributeViews (IViewCreator::kTagType);
 }
 
 //----------------------------------------------------------------------------------------------------
 void UIAttributesController::onUIDescColorChanged (UIDescription* desc)
 {
-	validateAttributeViews ();
+	invalidateAttributeViews (IViewCreator::kColorType);
 }
 
 //----------------------------------------------------------------------------------------------------
 void UIAttributesController::onUIDescFontChanged (UIDescription* desc)
 {
-	validateAttributeViews ();
+	invalidateAttributeViews (IViewCreator::kFontType);
 }
 
 //----------------------------------------------------------------------------------------------------
 void UIAttributesController::onUIDescBitmapChanged (UIDescription* desc)
 {
-	validateAttributeViews ();
+	invalidateAttributeViews (IViewCreator::kBitmapType);
 }
 
 //----------------------------------------------------------------------------------------------------
 void UIAttributesController::onUIDescTemplateChanged (UIDescription* desc)
 {
-	validateAttributeViews ();
+	invalidateAttributeViews (IViewCreator::kUnknownType);
 }
 
 //----------------------------------------------------------------------------------------------------
 void UIAttributesController::onUIDescGradientChanged (UIDescription* desc)
 {
-	validateAttributeViews ();
+	invalidateAttributeViews (IViewCreator::kGradientType);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -991,27 +997,71 @@ CMessageResult UIAttributesController::notify (CBaseObject* sender, IdStringPtr
 }
 
 //----------------------------------------------------------------------------------------------------
-void UIAttributesController::validateAttributeViews ()
+bool UIAttributesController::AttributeRow::isSameKind (const AttributeRow& other) const
+{
+	return name == other.name && type == other.type && hasValueRange == other.hasValueRange &&
+	       minValue == other.minValue && maxValue == other.maxValue &&
+	       containersOnly == other.containersOnly && viewClass == other.viewClass;
+}
+
+//----------------------------------------------------------------------------------------------------
+void UIAttributesController::getConsolidatedValues (const AttributeRows& rows, ConsolidatedValues& result)
 {
 	const auto* viewFactory = static_cast<const UIViewFactory*> (editDescription->getViewFactory ());
 
-	for (auto& controller : attributeControllers)
+	result.clear ();
+	result.resize (rows.size ());
+	bool first = true;
+	std::string temp;
+	for (const auto& view : *selection)
 	{
-		std::string attrValue;
-		bool first = true;
-		bool hasDifferentValues = false;
-		for (const auto& view : *selection)
+		for (auto index = 0u; index < rows.size (); ++index)
 		{
-			std::string temp;
-			viewFactory->getAttributeValue (view, controller->getAttributeName (), temp, editDescription);
-			if (temp != attrValue && !first)
-				hasDifferentValues = true;
-			attrValue = temp;
-			first = false;
+			auto& consolidated = result[index];
+			temp.clear ();
+			viewFactory->getAttributeValue (view, rows[index].name, temp, editDescription);
+			if (!first && temp != consolidated.value)
+				consolidated.differentValues = true;
+			consolidated.value.swap (temp);
 		}
-		controller->hasDifferentValues (hasDifferentValues);
-		controller->setValue (attrValue);
+		first = false;
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+void UIAttributesController::updateAttributeRow (AttributeRow& row, const ConsolidatedValue& value)
+{
+	if (row.controller == nullptr)
+		return;
+	// the controller resets its different values state when the user changes the value
+	if (row.valueValid && row.value == value.value && row.differentValues == value.differentValues &&
+	    row.controller->hasDifferentValues () == value.differentValues)
+		return;
+	row.value = value.value;
+	row.differentValues = value.differentValues;
+	row.valueValid = true;
+	row.controller->hasDifferentValues (row.differentValues);
+	row.controller->setValue (row.value);
+}
+
+//----------------------------------------------------------------------------------------------------
+void UIAttributesController::validateAttributeViews ()
+{
+	ConsolidatedValues values;
+	getConsolidatedValues (attributeRows, values);
+	for (auto index = 0u; index < attributeRows.size (); ++index)
+		updateAttributeRow (attributeRows[index], values[index]);
+}
+
+//----------------------------------------------------------------------------------------------------
+void UIAttributesController::invalidateAttributeViews (IViewCreator::AttrType type)
+{
+	for (auto& row : attributeRows)
+	{
+		if (type == IViewCreator::kUnknownType || row.type == type)
+			row.valueValid = false;
 	}
+	validateAttributeViews ();
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -1065,7 +1115,7 @@ CView* UIAttributesController::createValueViewForAttributeType (const UIViewFact
 }
 
 //----------------------------------------------------------------------------------------------------
-CView* UIAttributesController::createViewForAttribute (const std::string& attrName)
+CView* UIAttributesController::createViewForAttribute (AttributeRow& row)
 {
 	const CCoord height = 18;
 	const CCoord width = 160;
@@ -1075,7 +1125,7 @@ CView* UIAttributesController::createViewForAttribute (const std::string& attrNa
 	result->setTransparency (true);
 
 	CCoord middle = width/2;
-	CTextLabel* label = new CTextLabel (CRect (5, 1, middle - margin, height+1), attrName.c_str ());
+	CTextLabel* label = new CTextLabel (CRect (5, 1, middle - margin, height+1), row.name.c_str ());
 	label->setTextTruncateMode (CTextLabel::kTruncateHead);
 	label->setTransparency (true);
 	label->setHoriAlign (kRightText);
@@ -1085,30 +1135,16 @@ CView* UIAttributesController::createViewForAttribute (const std::string& attrNa
 
 	result->addView (label);
 	
-	bool hasDifferentValues = false;
-
 	const auto* viewFactory = static_cast<const UIViewFactory*> (editDescription->getViewFactory ());
 
-	std::string attrValue;
-	bool first = true;
-	for (const auto& view : *selection)
-	{
-		std::string temp;
-		viewFactory->getAttributeValue (view, attrName, temp, editDescription);
-		if (temp != attrValue && !first)
-			hasDifferentValues = true;
-		attrValue = temp;
-		first = false;
-	}
-
 	CRect r (middle+margin, 1, width-5, height+1);
 	CView* valueView = nullptr;
 	
-	if (attrName == "text-alignment")
+	if (row.name == "text-alignment")
 	{
 		valueView = UIEditController::getEditorDescription ()->createView ("attributes.text.alignment", this);
 	}
-	else if (attrName == "autosize")
+	else if (row.name == "autosize")
 	{
 		valueView = UIEditController::getEditorDescription ()->createView ("attributes.view.autosize", this);
 	}
@@ -1116,14 +1152,13 @@ CView* UIAttributesController::createViewForAttribute (const std::string& attrNa
 	if (valueView == nullptr)
 	{
 		CView* firstView = selection->first ();
-		IViewCreator::AttrType attrType = viewFactory->getAttributeType (firstView, attrName);
-		valueView = createValueViewForAttributeType (viewFactory, firstView, attrName, attrType);
+		valueView = createValueViewForAttributeType (viewFactory, firstView, row.name, row.type);
 	}
 	if (valueView == nullptr) // fallcack if attributes.text template not defined
 	{
 		IController* controller = new UIAttributeControllers::TextController (this, *currentAttributeName);
 		auto* textEdit = new CTextEdit (r, this, -1);
-		textEdit->setText (attrValue.c_str ());
+		textEdit->setText (row.value.c_str ());
 		textEdit->setTransparency (true);
 		textEdit->setFontColor (kBlackCColor);
 		textEdit->setFont (kNormalFontSmall);
@@ -1139,9 +1174,10 @@ CView* UIAttributesController::createViewForAttribute (const std::string& attrNa
 			auto* c = dynamic_cast<UIAttributeControllers::Controller*>(controller);
 			if (c)
 			{
-				c->hasDifferentValues (hasDifferentValues);
-				c->setValue (attrValue);
-				attributeControllers.emplace_back (c);
+				c->hasDifferentValues (row.differentValues);
+				c->setValue (row.value);
+				row.controller = c;
+				row.valueValid = true;
 			}
 		}
 		r.setHeight (valueView->getHeight ());
@@ -1161,42 +1197,101 @@ void UIAttributesController::getConsolidatedAttributeNames (StringList& attrName
 {
 	const auto* viewFactory = dynamic_cast<const UIViewFactory*> (editDescription->getViewFactory ());
 	vstgui_assert (viewFactory);
-	
+
+	// the order of the first view is used, an attribute is only shown when all views have it
+	std::unordered_map<std::string, uint32_t> numViewsPerAttribute;
+	uint32_t numViews = 0;
+	StringList temp;
 	for (const auto& view : *selection)
 	{
-		StringList temp;
-		if (viewFactory->getAttributeNamesForView (view, temp))
+		temp.clear ();
+		if (!viewFactory->getAttributeNamesForView (view, temp))
+			continue;
+		if (numViews == 0)
+			attrNames = temp;
+		for (const auto& attrName : temp)
+			++numViewsPerAttribute[attrName];
+		++numViews;
+	}
+	attrNames.remove_if ([&] (const std::string& attrName) {
+		if (numViewsPerAttribute[attrName] != numViews)
+			return true;
+		if (filter.empty ())
+			return false;
+		std::string lowerCaseName (attrName);
+		std::transform (lowerCaseName.begin (), lowerCaseName.end (), lowerCaseName.begin (), ::tolower);
+		return lowerCaseName.find (filter) == std::string::npos;
+	});
+}
+
+//----------------------------------------------------------------------------------------------------
+void UIAttributesController::initAttributeRow (const UIViewFactory* viewFactory, const UISelection* selection, AttributeRow& row)
+{
+	CView* firstView = selection->first ();
+	row.type = viewFactory->getAttributeType (firstView, row.name);
+	if (row.type == IViewCreator::kFloatType || row.type == IViewCreator::kIntegerType)
+		row.hasValueRange = viewFactory->getAttributeValueRange (firstView, row.name, row.minValue, row.maxValue);
+	else if (row.type == IViewCreator::kListType)
+	{
+		// the list controller collects the menu items from the first view once
+		if (auto viewName = viewFactory->getViewName (firstView))
+			row.viewClass = viewName;
+	}
+	if (row.name == "autosize")
+	{
+		// the autosize controller only shows the row and column options for containers
+		row.containersOnly = true;
+		for (const auto& view : *selection)
 		{
-			StringList toRemove;
-			if (attrNames.empty ())
-				attrNames = temp;
-			else
+			if (view->asViewContainer () == nullptr)
 			{
-				for (auto& attrName : attrNames)
-				{
-					bool found = std::find (temp.begin (), temp.end (), attrName) != temp.end ();
-					if (!found)
-					{
-						toRemove.emplace_back (attrName);
-						temp.remove (attrName);
-					}
-				}
+				row.containersOnly = false;
+				break;
 			}
-			if (!filter.empty ())
+		}
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+void UIAttributesController::updateViewNameLabel (const UIViewFactory* viewFactory)
+{
+	if (viewNameLabel == nullptr)
+		return;
+	int32_t selectedViews = selection->total ();
+	if (selectedViews > 0)
+	{
+		UTF8StringPtr viewname = nullptr;
+		for (const auto& view : *selection)
+		{
+			UTF8StringPtr name = viewFactory->getViewDisplayName (view);
+			if (viewname != nullptr && UTF8StringView (name) != viewname)
 			{
-				for (auto rit = temp.rbegin (); rit != temp.rend (); ++rit)
-				{
-					std::string lowerCaseName (*rit);
-					std::transform (lowerCaseName.begin (), lowerCaseName.end (), lowerCaseName.begin (), ::tolower);
-					if (lowerCaseName.find (filter) == std::string::npos)
-						toRemove.emplace_back (*rit);
-				}
+				viewname = nullptr;
+				break;
 			}
-			for (auto& attrName : toRemove)
+			viewname = name;
+		}
+		if (viewname != nullptr)
+		{
+			if (selectedViews == 1)
+				viewNameLabel->setText (viewname);
+			else
 			{
-				attrNames.remove (attrName);
+				std::stringstream str;
+				str << selectedViews << "x " << viewname;
+				viewNameLabel->setText (str.str ().c_str ());
 			}
 		}
+		else
+		{
+			std::stringstream str;
+			str << selectedViews << "x different views";
+			viewNameLabel->setText (str.str ().c_str ());
+		}
+	}
+	else
+	{
+		viewNameLabel->setText ("No Selection");
 	}
 }
 
@@ -1207,57 +1302,81 @@ void UIAttributesController::rebuildAttributesView ()
 	if (attributeView == nullptr || viewFactory == nullptr)
 		return;
 
-	attributeView->invalid ();
-	attributeView->removeAll ();
-	attributeControllers.clear ();
-
 	std::string filter (filterString);
 	std::transform (filter.begin (), filter.end (), filter.begin (), ::tolower);
 
-	if (viewNameLabel)
+	updateViewNameLabel (viewFactory);
+
+	StringList attrNames;
+	getConsolidatedAttributeNames (attrNames, filter);
+
+	// take over the rows which show the same kind of value view
+	AttributeRows rows;
+	rows.reserve (attrNames.size ());
+	for (const auto& name : attrNames)
+	{
+		AttributeRow row;
+		row.name = name;
+		initAttributeRow (viewFactory, selection, row);
+		auto it = std::find_if (attributeRows.begin (), attributeRows.end (), [&] (const AttributeRow& oldRow) {
+			return oldRow.view && oldRow.isSameKind (row);
+		});
+		if (it != attributeRows.end ())
+		{
+			row = std::move (*it);
+			it->view = nullptr;
+		}
+		rows.emplace_back (std::move (row));
+	}
+	bool layoutChanged = false;
+	for (auto& oldRow : attributeRows)
 	{
-		int32_t selectedViews = selection->total ();
-		if (selectedViews > 0)
+		if (oldRow.view)
 		{
-			UTF8StringPtr viewname = nullptr;
-			for (const auto& view : *selection)
-			{
-				UTF8StringPtr name = viewFactory->getViewDisplayName (view);
-				if (viewname != nullptr && UTF8StringView (name) != viewname)
-				{
-					viewname = nullptr;
-					break;
-				}
-				viewname = name;
-			}
-			if (viewname != nullptr)
-			{
-				if (selectedViews == 1)
-					viewNameLabel->setText (viewname);
-				else
-				{
-					std::stringstream str;
-					str << selectedViews << "x " << viewname;
-					viewNameLabel->setText (str.str ().c_str ());
-				}
-			}
-			else
-			{
-				std::stringstream str;
-				str << selectedViews << "x different views";
-				viewNameLabel->setText (str.str ().c_str ());
-			}
+			attributeView->removeView (oldRow.view);
+			layoutChanged = true;
+		}
+	}
+	attributeRows = std::move (rows);
+
+	ConsolidatedValues values;
+	getConsolidatedValues (attributeRows, values);
+
+	CCoord width = attributeView->getWidth () - (attributeView->getMargin ().left + attributeView->getMargin ().right);
+	for (auto index = 0u; index < attributeRows.size (); ++index)
+	{
+		auto& row = attributeRows[index];
+		if (row.view)
+		{
+			updateAttributeRow (row, values[index]);
 		}
 		else
 		{
-			viewNameLabel->setText ("No Selection");
+			row.value = std::move (values[index].value);
+			row.differentValues = values[index].differentValues;
+			currentAttributeName = &row.name;
+			row.view = createViewForAttribute (row);
+			CRect r = row.view->getViewSize ();
+			r.setWidth (width);
+			row.view->setViewSize (r);
+			row.view->setMouseableArea (r);
+			attributeView->addView (row.view);
+			layoutChanged = true;
+		}
+		// the reused rows keep their order and the new rows are added at the end, so the rows
+		// only need to move to the front
+		if (attributeView->getView (index) != row.view)
+		{
+			attributeView->changeViewZOrder (row.view, index);
+			layoutChanged = true;
 		}
 	}
+	currentAttributeName = nullptr;
+	if (!layoutChanged)
+		return;
 
-
-	StringList attrNames;
-	getConsolidatedAttributeNames (attrNames, filter);
-	if (attrNames.empty ())
+	attributeView->invalid ();
+	if (attributeRows.empty ())
 	{
 		CRect r (attributeView->getViewSize ());
 		r.setHeight (0);
@@ -1266,21 +1385,6 @@ void UIAttributesController::rebuildAttributesView ()
 	}
 	else
 	{
-		CCoord width = attributeView->getWidth () - (attributeView->getMargin ().left + attributeView->getMargin ().right);
-		for (const auto& name : attrNames)
-		{
-			currentAttributeName = &name;
-			CView* view = createViewForAttribute (name);
-			if (view)
-			{
-				CRect r = view->getViewSize ();
-				r.setWidth (width);
-				view->setViewSize (r);
-				view->setMouseableArea (r);
-				attributeView->addView (view);
-			}
-		}
-		currentAttributeName = nullptr;
 		attributeView->sizeToFit ();
 		attributeView->setMouseableArea (attributeView->getViewSize ());
 	}
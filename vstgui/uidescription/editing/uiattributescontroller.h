@@ -15,6 +15,7 @@
 #include "../uidescriptionlistener.h"
 #include "uiundomanager.h"
 #include "../../lib/controls/ctextedit.h"
+#include <vector>
 
 namespace VSTGUI {
 class CRowColumnView;
@@ -34,12 +35,52 @@ public:
 	void beginLiveAttributeChange (const std::string& name, const std::string& currentValue);
 	void endLiveAttributeChange ();
 	void performAttributeChange (const std::string& name, const std::string& value);
+
+	/** a row of the attributes view, rows are reused as long as the kind of their value view
+	 *	does not change and are only updated when their value changes
+	 */
+	struct AttributeRow
+	{
+		std::string name;
+		IViewCreator::AttrType type {IViewCreator::kUnknownType};
+		bool hasValueRange {false};
+		double minValue {0.};
+		double maxValue {0.};
+		bool containersOnly {false};
+		/** the view class for list types, the list values depend on the creator of the view */
+		std::string viewClass;
+
+		CView* view {nullptr};
+		UIAttributeControllers::Controller* controller {nullptr};
+		std::string value;
+		bool differentValues {false};
+		bool valueValid {false};
+
+		bool isSameKind (const AttributeRow& other) const;
+	};
+	using AttributeRows = std::vector<AttributeRow>;
+
+	/** init the kind of the row with the name of the attribute for the selected views */
+	static void initAttributeRow (const UIViewFactory* viewFactory, const UISelection* selection, AttributeRow& row);
+
 protected:
 	using StringList = std::list<std::string>;
 
-	CView* createViewForAttribute (const std::string& attrName);
+	struct ConsolidatedValue
+	{
+		std::string value;
+		bool differentValues {false};
+	};
+	using ConsolidatedValues = std::vector<ConsolidatedValue>;
+
+	CView* createViewForAttribute (AttributeRow& row);
 	void rebuildAttributesView ();
 	void validateAttributeViews ();
+	/** update the rows of the type even if their value did not change, kUnknownType updates all rows */
+	void invalidateAttributeViews (IViewCreator::AttrType type);
+	void updateViewNameLabel (const UIViewFactory* viewFactory);
+	void updateAttributeRow (AttributeRow& row, const ConsolidatedValue& value);
+	void getConsolidatedValues (const AttributeRows& rows, ConsolidatedValues& result);
 	CView* createValueViewForAttributeType (const UIViewFactory* viewFactory, CView* view, const std::string& attrName, IViewCreator::AttrType attrType);
 	void getConsolidatedAttributeNames (StringList& result, const std::string& filter);
 
@@ -63,8 +104,7 @@ protected:
 	SharedPointer<CVSTGUITimer> timer;
 	IAction* liveAction;
 
-	using UIAttributeControllerList = std::list<UIAttributeControllers::Controller*>;
-	UIAttributeControllerList attributeControllers;
+	AttributeRows attributeRows;
 
 	enum {
 		kSearchFieldTag = 100,
@@ -228,12 +228,11 @@ CMouseEventResult UIBitmapsDataSource::dbOnMouseMoved (const CPoint& where, cons
 			                                                  description, &attr))
 			{
 				CMemoryStream stream (1024, 1024, false);
-				if (selection->store (stream, description))
+				if (selection->store (stream, description, UIDescription::kBinaryViewsFormat))
 				{
-					stream.end ();
 					auto dropSource = CDropSource::create (stream.getBuffer (),
 					                                       static_cast<uint32_t> (stream.tell ()),
-					                                       CDropSource::kText);
+					                                       CDropSource::kBinary);
 					browser->doDrag (DragDescription (dropSource, {}, bitmap));
 					return kMouseMoveEventHandledButDontNeedMoreEvents;
 				}
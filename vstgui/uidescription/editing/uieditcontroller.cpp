@@ -38,6 +38,7 @@
 #include <sstream>
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <array>
 
 #if WINDOWS
@@ -392,10 +393,13 @@ UIEditController::UIEditController (UIDescription* description)
 , editView (nullptr)
 , templateController (nullptr)
 , dirty (false)
+, descriptionLazyViewCreation (description->getLazyViewCreation ())
 {
 	editorDesc = getEditorDescription ();
 	undoManager->addDependency (this);
 	editDescription->registerListener (this);
+	// the editor needs all views of a template
+	editDescription->setLazyViewCreation (false);
 	menuController = new UIEditMenuController (this, selection, undoManager, editDescription, this);
 	onTemplatesChanged ();
 }
@@ -407,6 +411,7 @@ UIEditController::~UIEditController ()
 		templateController->removeDependency (this);
 	undoManager->removeDependency (this);
 	editDescription->unregisterListener (this);
+	editDescription->setLazyViewCreation (descriptionLazyViewCreation);
 	editorDesc = nullptr;
 	gUIDescription.tryFree ();
 }
@@ -881,6 +886,17 @@ void UIEditController::doCopy (bool cut)
 	selection->store (stream, editDescription);
 	auto dataSource = CDropSource::create (stream.getBuffer (), static_cast<uint32_t> (stream.tell ()), IDataPackage::kText);
 	editView->getFrame ()->setClipboard (dataSource);
+	CMemoryStream snapshot (1024, 1024, false);
+	if (selection->store (snapshot, editDescription, UIDescription::kBinaryViewsFormat))
+	{
+		copiedXML.assign (stream.getBuffer (), stream.getBuffer () + stream.tell ());
+		copiedSnapshot.assign (snapshot.getBuffer (), snapshot.getBuffer () + snapshot.tell ());
+	}
+	else
+	{
+		copiedXML.clear ();
+		copiedSnapshot.clear ();
+	}
 	if (cut)
 		undoManager->pushAndPerform (new DeleteOperation (selection));
 }
@@ -916,7 +932,15 @@ void UIEditController::doPaste ()
 			uint32_t size = clipboard->getData (0, data, type);
 			if (size > 0)
 			{
-				CMemoryStream stream ((const int8_t*)data, size, false);
+				auto buffer = static_cast<const int8_t*> (data);
+				auto xmlSize = buffer[size - 1] == 0 ? size - 1 : size;
+				if (!copiedSnapshot.empty () && xmlSize == copiedXML.size () &&
+				    std::memcmp (buffer, copiedXML.data (), xmlSize) == 0)
+				{
+					buffer = copiedSnapshot.data ();
+					size = static_cast<uint32_t> (copiedSnapshot.size ());
+				}
+				CMemoryStream stream (buffer, size, false);
 				auto* copySelection = new UISelection ();
 				if (copySelection->restore (stream, editDescription))
 				{
@@ -144,8 +144,15 @@ protected:
 	
 	std::string editTemplateName;
 	std::list<SharedPointer<CSplitView> > splitViews;
+
+	/** the XML of the last copy and the same views in the binary format, so that pasting them
+	 *	does not need to parse the XML as long as the clipboard still contains it
+	 */
+	std::vector<int8_t> copiedXML;
+	std::vector<int8_t> copiedSnapshot;
 	
 	bool dirty;
+	bool descriptionLazyViewCreation;
 	
 	struct Template {
 		std::string name;
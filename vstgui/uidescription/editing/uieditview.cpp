@@ -1085,9 +1085,8 @@ void UIEditView::startDrag (CPoint& where)
 		description->updateViewDescription (templateName.c_str (), getEditView ());
 
 	CMemoryStream stream (1024, 1024, false);
-	if (!getSelection ()->store (stream, description))
+	if (!getSelection ()->store (stream, description, UIDescription::kBinaryViewsFormat))
 		return;
-	stream.end ();
 
 	auto callback = makeOwned<DragCallbackFunctions> ();
 	callback->endedFunc = [this] (IDraggingSession*, CPoint pos, DragOperation) {
@@ -1095,7 +1094,7 @@ void UIEditView::startDrag (CPoint& where)
 		onMouseMoved (pos, 0);
 	};
 
-	auto dropSource = CDropSource::create (stream.getBuffer (), static_cast<uint32_t>(stream.tell ()), CDropSource::kText);
+	auto dropSource = CDropSource::create (stream.getBuffer (), static_cast<uint32_t>(stream.tell ()), CDropSource::kBinary);
 	doDrag (DragDescription (dropSource, offset, bitmap), callback);
 }
 
@@ -1106,7 +1105,9 @@ UISelection* UIEditView::getSelectionOutOfDrag (IDataPackage* drag)
 	IDataPackage::Type type;
 	const void* dragData;
 	uint32_t size;
-	if ((size = drag->getData (0, dragData, type)) > 0 && type == IDataPackage::kText)
+	// views dragged inside the editor are in the binary format, views from outside are XML text
+	if ((size = drag->getData (0, dragData, type)) > 0 &&
+	    (type == IDataPackage::kText || type == IDataPackage::kBinary))
 	{
 		IController* controller = getEditor () ? dynamic_cast<IController*> (getEditor ()) : nullptr;
 		if (controller)
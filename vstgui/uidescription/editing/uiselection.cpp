@@ -221,7 +221,8 @@ void UISelection::invalidRects () const
 }
 
 //----------------------------------------------------------------------------------------------------
-bool UISelection::store (OutputStream& stream, IUIDescription* uiDescription)
+bool UISelection::store (OutputStream& stream, IUIDescription* uiDescription,
+                         UIDescription::ViewsFormat format)
 {
 	UIDescription* desc = dynamic_cast<UIDescription*>(uiDescription);
 	if (desc)
@@ -237,7 +238,7 @@ bool UISelection::store (OutputStream& stream, IUIDescription* uiDescription)
 		
 		auto attr = makeOwned<UIAttributes> ();
 		attr->setPointAttribute ("selection-drag-offset", dragOffset);
-		return desc->storeViews (views, stream, attr);
+		return desc->storeViews (views, stream, attr, format);
 	}
 	return false;
 }
@@ -9,6 +9,7 @@
 
 #include "../../lib/cview.h"
 #include "../../lib/idependency.h"
+#include "../uidescription.h"
 #include <list>
 #include <string>
 
@@ -70,7 +71,8 @@ public:
 	static IdStringPtr kMsgSelectionViewWillChange;
 	static IdStringPtr kMsgSelectionViewChanged;
 
-	bool store (OutputStream& stream, IUIDescription* uiDescription);
+	bool store (OutputStream& stream, IUIDescription* uiDescription,
+	            UIDescription::ViewsFormat format = UIDescription::kXMLViewsFormat);
 	bool restore (InputStream& stream, IUIDescription* uiDescription);
 protected:
 	int32_t style;
@@ -7,6 +7,9 @@
 #if VSTGUI_LIVE_EDITING
 
 #include "iaction.h"
+#include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <string>
 
 namespace VSTGUI {
@@ -36,6 +39,14 @@ public:
 
 	UTF8StringPtr getName () override { return name.c_str (); }
 
+	size_t getMemoryUsage () const override
+	{
+		auto result = sizeof (*this) + name.capacity ();
+		for (auto action : *this)
+			result += 3 * sizeof (void*) + action->getMemoryUsage ();
+		return result;
+	}
+
 	void perform () override
 	{
 		std::for_each (begin (), end (), doPerform);
@@ -61,6 +72,7 @@ UIUndoManager::UIUndoManager ()
 	emplace_back (new UndoStackTop);
 	position = begin ();
 	savePosition = begin ();
+	memoryUsage = front ()->getMemoryUsage ();
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -80,23 +92,79 @@ void UIUndoManager::pushAndPerform (IAction* action)
 	if (position != end ())
 	{
 		position++;
-		iterator oldStack = position;
 		while (position != end ())
 		{
 			if (position == savePosition)
 				savePosition = end ();
-			delete (*position);
-			position++;
+			deleteAction (position++);
 		}
-		erase (oldStack, end ());
 	}
 	emplace_back (action);
 	position = end ();
 	position--;
 	action->perform ();
+	memoryUsage += action->getMemoryUsage ();
+	auto now = std::chrono::steady_clock::now ();
+	auto inMergeTimeWindow =
+		mergeTimeWindow && now - lastPushTime <= std::chrono::milliseconds (mergeTimeWindow);
+	lastPushTime = now;
+	auto previous = std::prev (position);
+	auto previousMemoryUsage = (*previous)->getMemoryUsage ();
+	// the state at the save position must not change
+	if (inMergeTimeWindow && previous != begin () && previous != savePosition &&
+	    (*previous)->merge (action))
+	{
+		deleteAction (position);
+		position = previous;
+		memoryUsage -= std::min (memoryUsage, previousMemoryUsage);
+		memoryUsage += (*previous)->getMemoryUsage ();
+	}
+	trim ();
 	changed (kMsgChanged);
 }
 
+//----------------------------------------------------------------------------------------------------
+void UIUndoManager::setMaxActions (size_t numActions)
+{
+	maxActions = numActions;
+	trim ();
+}
+
+//----------------------------------------------------------------------------------------------------
+void UIUndoManager::setMaxMemoryUsage (size_t bytes)
+{
+	maxMemoryUsage = bytes;
+	trim ();
+}
+
+//----------------------------------------------------------------------------------------------------
+void UIUndoManager::deleteAction (iterator it)
+{
+	memoryUsage -= std::min (memoryUsage, (*it)->getMemoryUsage ());
+	delete *it;
+	erase (it);
+}
+
+//----------------------------------------------------------------------------------------------------
+void UIUndoManager::trim ()
+{
+	auto numActions = getNumActions ();
+	// only actions which can be undone are removed and the latest one is always kept
+	while (position != end () && position != begin () && std::next (begin ()) != position &&
+	       ((maxActions && numActions > maxActions) ||
+	        (maxMemoryUsage && memoryUsage > maxMemoryUsage)))
+	{
+		auto oldest = std::next (begin ());
+		// the stack top now stands for the state after the oldest action
+		if (savePosition == begin ())
+			savePosition = end ();
+		else if (savePosition == oldest)
+			savePosition = begin ();
+		deleteAction (oldest);
+		--numActions;
+	}
+}
+
 //----------------------------------------------------------------------------------------------------
 void UIUndoManager::performUndo ()
 {
@@ -104,6 +172,7 @@ void UIUndoManager::performUndo ()
 	{
 		(*position)->undo ();
 		position--;
+		lastPushTime = {};
 		changed (kMsgChanged);
 	}
 }
@@ -117,6 +186,7 @@ void UIUndoManager::performRedo ()
 		if (position != end ())
 		{
 			(*position)->perform ();
+			lastPushTime = {};
 			changed (kMsgChanged);
 		}
 	}
@@ -169,6 +239,8 @@ void UIUndoManager::clear ()
 	emplace_back (new UndoStackTop);
 	position = end ();
 	savePosition = begin ();
+	memoryUsage = front ()->getMemoryUsage ();
+	lastPushTime = {};
 	changed (kMsgChanged);
 }
 
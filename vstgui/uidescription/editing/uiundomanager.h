@@ -10,6 +10,7 @@
 #if VSTGUI_LIVE_EDITING
 
 #include "../../lib/idependency.h"
+#include <chrono>
 #include <list>
 #include <deque>
 
@@ -18,14 +19,42 @@ class IAction;
 class UIGroupAction;
 
 //----------------------------------------------------------------------------------------------------
+/** Undo stack of the UI editor
+ *
+ *	An action which is pushed directly after an action it can be merged with (see IAction::merge)
+ *	does not get its own undo step, if it is pushed within the merge time window of the previous
+ *	push. So holding a key which nudges a view is one undo step, while two separate edits of the
+ *	same attribute are two. Mouse drags and live edits are already pushed as one action. When
+ *	there are more actions than the maximum number of actions or they use more memory than the
+ *	maximum memory usage, the oldest actions are removed. The latest action is always kept.
+ */
 class UIUndoManager : public CBaseObject, protected std::list<IAction*>, public IDependency
 {
 public:
+	static constexpr size_t kDefaultMaxActions = 1000;
+	static constexpr size_t kDefaultMaxMemoryUsage = 64 * 1024 * 1024;
+	static constexpr uint32_t kDefaultMergeTimeWindow = 500;
+
 	UIUndoManager ();
 	~UIUndoManager () override;
 
 	void pushAndPerform (IAction* action);
 
+	/** set the maximum number of actions, zero means unlimited */
+	void setMaxActions (size_t numActions);
+	size_t getMaxActions () const { return maxActions; }
+	/** set the maximum approximate memory usage of the actions in bytes, zero means unlimited */
+	void setMaxMemoryUsage (size_t bytes);
+	size_t getMaxMemoryUsage () const { return maxMemoryUsage; }
+	/** set the time in milliseconds after a push in which the next action may be merged with the
+	 *	previous one, zero disables merging */
+	void setMergeTimeWindow (uint32_t milliseconds) { mergeTimeWindow = milliseconds; }
+	uint32_t getMergeTimeWindow () const { return mergeTimeWindow; }
+
+	size_t getNumActions () const { return size () - 1; }
+	/** approximate memory usage of all actions in bytes */
+	size_t getMemoryUsage () const { return memoryUsage; }
+
 	UTF8StringPtr getUndoName ();
 	UTF8StringPtr getRedoName ();
 	
@@ -45,8 +74,18 @@ public:
 	
 	static IdStringPtr kMsgChanged;
 protected:
+	void trim ();
+	void deleteAction (iterator it);
+
 	iterator position;
 	iterator savePosition;
+	size_t maxActions {kDefaultMaxActions};
+	size_t maxMemoryUsage {kDefaultMaxMemoryUsage};
+	uint32_t mergeTimeWindow {kDefaultMergeTimeWindow};
+	/** sum of the memory usage of the actions, updated when actions are added or removed */
+	size_t memoryUsage {0};
+	/** time of the last push, reset when the position changes otherwise */
+	std::chrono::steady_clock::time_point lastPushTime;
 	using GroupActionDeque = std::deque<UIGroupAction*>;
 	GroupActionDeque groupQueue;
 };
@@ -207,10 +207,9 @@ CMouseEventResult UIViewCreatorDataSource::dbOnMouseMoved (const CPoint& where,
 		auto row = dataBrowser->getSelection().front ();
 		SharedPointer<UISelection> selection = createSelection (row);
 		CMemoryStream stream (1024, 1024, false);
-		if (selection->store (stream, description))
+		if (selection->store (stream, description, UIDescription::kBinaryViewsFormat))
 		{
-			stream.end ();
-			auto dropSource = CDropSource::create (stream.getBuffer (), static_cast<uint32_t> (stream.tell ()), CDropSource::kText);
+			auto dropSource = CDropSource::create (stream.getBuffer (), static_cast<uint32_t> (stream.tell ()), CDropSource::kBinary);
 			auto bitmap = createBitmapFromSelection (selection, dataBrowser->getFrame ());
 			browser->doDrag (DragDescription (dropSource, CPoint (), bitmap));
 		}
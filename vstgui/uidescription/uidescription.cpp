@@ -7,6 +7,7 @@
 #include "uiattributes.h"
 #include "uiviewfactory.h"
 #include "uiviewcreator.h"
+#include "uiviewplaceholder.h"
 #include "cstream.h"
 #include "base64codec.h"
 #include "icontroller.h"
@@ -26,6 +27,7 @@
 #include <sstream>
 #include <fstream>
 #include <algorithm>
+#include <cstdlib>
 #include <cassert>
 #include <deque>
 
@@ -190,6 +192,10 @@ class UIBitmapNode : public UINode
 public:
 	UIBitmapNode (const std::string& name, const SharedPointer<UIAttributes>& attributes);
 	CBitmap* getBitmap (const std::string& pathHint);
+	CBitmap* getAtlasBitmap (CBitmap* atlas);
+	CBitmap* detachBitmap ();
+	void attachBitmap (CBitmap* bitmap);
+	const std::string* getAtlasName () const { return attributes->getAttributeValue ("atlas"); }
 	void setBitmap (UTF8StringPtr bitmapName);
 	void setNinePartTiledOffset (const CRect* offsets);
 	void invalidBitmap ();
@@ -411,6 +417,8 @@ protected:
 	bool writeComment (UICommentNode* node, OutputStream& stream);
 	bool writeNodeData (UINode::DataStorage& str, OutputStream& stream);
 	bool writeAttributes (UIAttributes* attr, OutputStream& stream);
+	void writeIntend (OutputStream& stream);
+	void writeEndTag (UINode* node, OutputStream& stream);
 	int32_t intendLevel;
 };
 
@@ -440,6 +448,28 @@ void UIDescWriter::encodeAttributeString (std::string& str)
 	}
 }
 
+//-----------------------------------------------------------------------------
+void UIDescWriter::writeIntend (OutputStream& stream)
+{
+	static const std::string tabs (64, '\t');
+	for (auto level = static_cast<uint32_t> (intendLevel); level > 0;)
+	{
+		auto numTabs = std::min (level, static_cast<uint32_t> (tabs.size ()));
+		stream.writeRaw (tabs.data (), numTabs);
+		level -= numTabs;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void UIDescWriter::writeEndTag (UINode* node, OutputStream& stream)
+{
+	writeIntend (stream);
+	const auto& name = node->getName ();
+	stream.writeRawChunks ({{"</", 2},
+	                        {name.data (), static_cast<uint32_t> (name.size ())},
+	                        {">\n", 2}});
+}
+
 //-----------------------------------------------------------------------------
 bool UIDescWriter::writeAttributes (UIAttributes* attr, OutputStream& stream)
 {
@@ -450,13 +480,13 @@ bool UIDescWriter::writeAttributes (UIAttributes* attr, OutputStream& stream)
 	{
 		if (sa.second.length () > 0)
 		{
-			stream << " ";
-			stream << sa.first;
-			stream << "=\"";
 			std::string value (sa.second);
 			encodeAttributeString (value);
-			stream << value;
-			stream << "\"";
+			stream.writeRawChunks ({{" ", 1},
+			                        {sa.first.data (), static_cast<uint32_t> (sa.first.size ())},
+			                        {"=\"", 2},
+			                        {value.data (), static_cast<uint32_t> (value.size ())},
+			                        {"\"", 1}});
 		}
 	}
 	return result;
@@ -465,16 +495,17 @@ bool UIDescWriter::writeAttributes (UIAttributes* attr, OutputStream& stream)
 //-----------------------------------------------------------------------------
 bool UIDescWriter::writeNodeData (UINode::DataStorage& str, OutputStream& stream)
 {
-	for (int32_t i = 0; i < intendLevel; i++) stream << "\t";
-	uint32_t i = 0;
-	for (auto c : str)
+	// the data is broken into lines of 82 characters
+	static constexpr size_t kLineLength = 82;
+	writeIntend (stream);
+	for (size_t pos = 0; pos < str.size (); pos += kLineLength)
 	{
-		stream << static_cast<int8_t> (c);
-		if (i++ > 80)
+		auto length = std::min (kLineLength, str.size () - pos);
+		stream.writeRaw (str.data () + pos, static_cast<uint32_t> (length));
+		if (length == kLineLength)
 		{
 			stream << "\n";
-			i = 0;
-			for (int32_t i = 0; i < intendLevel; i++) stream << "\t";
+			writeIntend (stream);
 		}
 	}
 	stream << "\n";
@@ -496,13 +527,13 @@ bool UIDescWriter::writeNode (UINode* node, OutputStream& stream)
 	bool result = true;
 	if (node->noExport ())
 		return result;
-	for (int32_t i = 0; i < intendLevel; i++) stream << "\t";
+	writeIntend (stream);
 	if (UICommentNode* commentNode = dynamic_cast<UICommentNode*> (node))
 	{
 		return writeComment (commentNode, stream);
 	}
-	stream << "<";
-	stream << node->getName ();
+	const auto& name = node->getName ();
+	stream.writeRawChunks ({{"<", 1}, {name.data (), static_cast<uint32_t> (name.size ())}});
 	result = writeAttributes (node->getAttributes (), stream);
 	if (result)
 	{
@@ -519,10 +550,7 @@ bool UIDescWriter::writeNode (UINode* node, OutputStream& stream)
 					return false;
 			}
 			intendLevel--;
-			for (int32_t i = 0; i < intendLevel; i++) stream << "\t";
-			stream << "</";
-			stream << node->getName ();
-			stream << ">\n";
+			writeEndTag (node, stream);
 		}
 		else if (!node->getData ().empty ())
 		{
@@ -530,16 +558,328 @@ bool UIDescWriter::writeNode (UINode* node, OutputStream& stream)
 			intendLevel++;
 			result = writeNodeData (node->getData (), stream);
 			intendLevel--;
-			for (int32_t i = 0; i < intendLevel; i++) stream << "\t";
-			stream << "</";
-			stream << node->getName ();
-			stream << ">\n";
+			writeEndTag (node, stream);
 		}
 		else
 			stream << "/>\n";
 	}
 	return result;
 }
+
+//-----------------------------------------------------------------------------
+/** binary snapshot of a node tree used to transfer views inside the editor
+ *
+ *	All strings are written once into a string table and the nodes reference them by index.
+ *	Integer and boolean attribute values are stored as numbers. All numbers are written with
+ *	seven bits per byte, so small numbers only need one byte. Reading a snapshot creates the
+ *	nodes directly without parsing any XML.
+ */
+namespace UIViewSnapshot {
+
+static constexpr int32_t kIdentifier = 'UIVS';
+static constexpr uint32_t kVersion = 1;
+static constexpr uint32_t kMaxNodeDepth = 256;
+
+enum ValueType : uint8_t
+{
+	kStringValue,
+	kIntegerValue,
+	kFalseValue,
+	kTrueValue
+};
+
+//-----------------------------------------------------------------------------
+static void appendNumber (std::vector<uint8_t>& buffer, uint32_t value)
+{
+	// the high bit marks that more bytes follow
+	while (value > 0x7f)
+	{
+		buffer.emplace_back (static_cast<uint8_t> ((value & 0x7f) | 0x80));
+		value >>= 7;
+	}
+	buffer.emplace_back (static_cast<uint8_t> (value));
+}
+
+//-----------------------------------------------------------------------------
+static void appendInteger (std::vector<uint8_t>& buffer, int32_t value)
+{
+	// zigzag encoding, so that small negative numbers are small, too
+	auto number = static_cast<uint32_t> (value);
+	appendNumber (buffer, (number << 1) ^ (value < 0 ? 0xffffffff : 0));
+}
+
+//-----------------------------------------------------------------------------
+static bool exportNode (UINode* node)
+{
+	return !node->noExport () && dynamic_cast<UICommentNode*> (node) == nullptr;
+}
+
+//-----------------------------------------------------------------------------
+static bool isIntegerValue (const std::string& value, int32_t& result)
+{
+	// only values which are written back exactly the same are stored as integers
+	auto digits = value.data () + (value[0] == '-' ? 1 : 0);
+	auto numDigits = value.size () - static_cast<size_t> (digits - value.data ());
+	if (numDigits == 0 || numDigits > 9 || (digits[0] == '0' && (numDigits > 1 || digits != value.data ())))
+		return false;
+	if (!std::all_of (digits, digits + numDigits, [] (char c) { return c >= '0' && c <= '9'; }))
+		return false;
+	result = std::atoi (value.data ());
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+class Writer
+{
+public:
+	bool write (OutputStream& stream, UINode* rootNode);
+
+private:
+	void writeNode (UINode* node);
+	void writeString (const std::string& str);
+
+	std::unordered_map<std::string, uint32_t> stringIndices;
+	std::vector<const std::string*> strings;
+	std::vector<uint8_t> nodeData;
+};
+
+//-----------------------------------------------------------------------------
+bool Writer::write (OutputStream& stream, UINode* rootNode)
+{
+	// the nodes are written first, as they build the string table
+	writeNode (rootNode);
+	std::vector<uint8_t> stringTable;
+	appendNumber (stringTable, static_cast<uint32_t> (strings.size ()));
+	for (auto str : strings)
+	{
+		appendNumber (stringTable, static_cast<uint32_t> (str->size ()));
+		stringTable.insert (stringTable.end (), str->begin (), str->end ());
+	}
+	if (!(stream << kIdentifier)) return false;
+	if (!(stream << kVersion)) return false;
+	auto size = static_cast<uint32_t> (stringTable.size () + nodeData.size ());
+	return stream.writeRawChunks (
+	           {{stringTable.data (), static_cast<uint32_t> (stringTable.size ())},
+	            {nodeData.data (), static_cast<uint32_t> (nodeData.size ())}}) == size;
+}
+
+//-----------------------------------------------------------------------------
+void Writer::writeString (const std::string& str)
+{
+	auto it = stringIndices.find (str);
+	if (it == stringIndices.end ())
+	{
+		it = stringIndices.emplace (str, static_cast<uint32_t> (strings.size ())).first;
+		strings.emplace_back (&it->first);
+	}
+	appendNumber (nodeData, it->second);
+}
+
+//-----------------------------------------------------------------------------
+void Writer::writeNode (UINode* node)
+{
+	writeString (node->getName ());
+	writeString (node->getData ());
+	const auto& attributes = *node->getAttributes ();
+	auto numAttributes = std::count_if (
+	    attributes.begin (), attributes.end (),
+	    [] (const UIAttributesMap::value_type& attr) { return !attr.second.empty (); });
+	appendNumber (nodeData, static_cast<uint32_t> (numAttributes));
+	int32_t integer;
+	for (const auto& attr : attributes)
+	{
+		if (attr.second.empty ())
+			continue;
+		writeString (attr.first);
+		if (isIntegerValue (attr.second, integer))
+		{
+			nodeData.emplace_back (kIntegerValue);
+			appendInteger (nodeData, integer);
+		}
+		else if (attr.second == "true")
+			nodeData.emplace_back (kTrueValue);
+		else if (attr.second == "false")
+			nodeData.emplace_back (kFalseValue);
+		else
+		{
+			nodeData.emplace_back (kStringValue);
+			writeString (attr.second);
+		}
+	}
+	const auto& children = node->getChildren ();
+	auto numChildren = std::count_if (children.begin (), children.end (), exportNode);
+	appendNumber (nodeData, static_cast<uint32_t> (numChildren));
+	for (auto& child : children)
+	{
+		if (exportNode (child))
+			writeNode (child);
+	}
+}
+
+//-----------------------------------------------------------------------------
+class Reader
+{
+public:
+	/** check if the stream contains a snapshot and skip its header, otherwise the stream
+	 *	position is not changed
+	 */
+	static bool readHeader (InputStream& stream);
+	/** read the snapshot after the header */
+	SharedPointer<UINode> read (InputStream& stream);
+
+private:
+	bool readNumber (uint32_t& value);
+	bool readInteger (int32_t& value);
+	const std::string* readString ();
+	SharedPointer<UINode> readNode (uint32_t depth);
+
+	std::vector<uint8_t> data;
+	const uint8_t* pos {nullptr};
+	const uint8_t* end {nullptr};
+	std::vector<std::string> strings;
+};
+
+//-----------------------------------------------------------------------------
+bool Reader::readHeader (InputStream& stream)
+{
+	auto seekableStream = dynamic_cast<SeekableStream*> (&stream);
+	if (!seekableStream)
+		return false;
+	auto startPos = seekableStream->tell ();
+	int32_t identifier;
+	uint32_t version;
+	if ((stream >> identifier) && identifier == kIdentifier && (stream >> version) &&
+	    version == kVersion)
+		return true;
+	seekableStream->seek (startPos, SeekableStream::kSeekSet);
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+SharedPointer<UINode> Reader::read (InputStream& stream)
+{
+	static constexpr uint32_t kChunkSize = 64 * 1024;
+	uint32_t numRead;
+	do
+	{
+		auto size = data.size ();
+		data.resize (size + kChunkSize);
+		numRead = stream.readRaw (data.data () + size, kChunkSize);
+		if (numRead == kStreamIOError)
+			numRead = 0;
+		data.resize (size + numRead);
+	} while (numRead == kChunkSize);
+	pos = data.data ();
+	end = pos + data.size ();
+
+	uint32_t numStrings;
+	if (!readNumber (numStrings))
+		return nullptr;
+	for (uint32_t i = 0; i < numStrings; ++i)
+	{
+		uint32_t length;
+		if (!readNumber (length) || length > static_cast<size_t> (end - pos))
+			return nullptr;
+		strings.emplace_back (reinterpret_cast<const char*> (pos), length);
+		pos += length;
+	}
+	return readNode (0);
+}
+
+//-----------------------------------------------------------------------------
+bool Reader::readNumber (uint32_t& value)
+{
+	value = 0;
+	for (uint32_t shift = 0; shift < 35 && pos != end; shift += 7)
+	{
+		auto byte = *pos++;
+		value |= static_cast<uint32_t> (byte & 0x7f) << shift;
+		if ((byte & 0x80) == 0)
+			return true;
+	}
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+bool Reader::readInteger (int32_t& value)
+{
+	uint32_t number;
+	if (!readNumber (number))
+		return false;
+	value = static_cast<int32_t> ((number >> 1) ^ ((number & 1) ? 0xffffffff : 0));
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+const std::string* Reader::readString ()
+{
+	uint32_t index;
+	if (!readNumber (index) || index >= strings.size ())
+		return nullptr;
+	return &strings[index];
+}
+
+//-----------------------------------------------------------------------------
+SharedPointer<UINode> Reader::readNode (uint32_t depth)
+{
+	if (depth > kMaxNodeDepth)
+		return nullptr;
+	auto name = readString ();
+	auto nodeData = name ? readString () : nullptr;
+	uint32_t numAttributes;
+	if (!nodeData || !readNumber (numAttributes))
+		return nullptr;
+	auto attributes = makeOwned<UIAttributes> ();
+	for (uint32_t i = 0; i < numAttributes; ++i)
+	{
+		auto key = readString ();
+		if (!key || pos == end)
+			return nullptr;
+		auto type = *pos++;
+		switch (type)
+		{
+			case kStringValue:
+			{
+				auto value = readString ();
+				if (!value)
+					return nullptr;
+				attributes->setAttribute (*key, *value);
+				break;
+			}
+			case kIntegerValue:
+			{
+				int32_t value;
+				if (!readInteger (value))
+					return nullptr;
+				attributes->setAttribute (*key, std::to_string (value));
+				break;
+			}
+			case kFalseValue:
+			case kTrueValue:
+			{
+				attributes->setBooleanAttribute (*key, type == kTrueValue);
+				break;
+			}
+			default: return nullptr;
+		}
+	}
+	auto node = makeOwned<UINode> (*name, attributes);
+	node->getData () = *nodeData;
+	uint32_t numChildren;
+	if (!readNumber (numChildren))
+		return nullptr;
+	for (uint32_t i = 0; i < numChildren; ++i)
+	{
+		auto child = readNode (depth + 1);
+		if (!child)
+			return nullptr;
+		node->getChildren ().add (child);
+		child->remember ();
+	}
+	return node;
+}
+
+} // UIViewSnapshot
 /// @endcond
 
 //-----------------------------------------------------------------------------
@@ -680,6 +1020,7 @@ struct UIDescription::Impl
 	std::deque<UINode*> nodeStack;
 	
 	bool restoreViewsMode {false};
+	bool lazyViewCreation {true};
 
 	Optional<UINode*> variableBaseNode;
 
@@ -694,6 +1035,14 @@ struct UIDescription::Impl
 	}
 
 	DispatchList<UIDescriptionListener*> listeners;
+
+	/** the bitmap reload functions and the view placeholders only call back into the
+	 *	description while it exists
+	 */
+	std::shared_ptr<bool> lifetimeToken {std::make_shared<bool> (true)};
+	bool reloadingBitmap {false};
+	/** the names of the atlas bitmaps currently resolved in getBitmap */
+	std::vector<std::string> resolvingAtlasNames;
 };
 
 //-----------------------------------------------------------------------------
@@ -1115,7 +1464,7 @@ UINode* UIDescription::findNodeForView (CView* view) const
 }
 
 //-----------------------------------------------------------------------------
-bool UIDescription::storeViews (const std::list<CView*>& views, OutputStream& stream, UIAttributes* customData) const
+bool UIDescription::storeViews (const std::list<CView*>& views, OutputStream& stream, UIAttributes* customData, ViewsFormat format) const
 {
 	auto nodeList = makeOwned<UIDescList> (false);
 	for (auto& view : views)
@@ -1151,6 +1500,8 @@ bool UIDescription::storeViews (const std::list<CView*>& views, OutputStream& st
 			customData->remember ();
 		}
 		UINode baseNode ("vstgui-ui-description-view-list", nodeList);
+		if (format == kBinaryViewsFormat)
+			return UIViewSnapshot::Writer ().write (stream, &baseNode);
 		UIDescWriter writer;
 		return writer.write (stream, &baseNode);
 	}
@@ -1161,7 +1512,11 @@ bool UIDescription::storeViews (const std::list<CView*>& views, OutputStream& st
 bool UIDescription::restoreViews (InputStream& stream, std::list<SharedPointer<CView> >& views, UIAttributes** customData)
 {
 	SharedPointer<UINode> baseNode;
-	if (impl->nodes)
+	if (impl->nodes && UIViewSnapshot::Reader::readHeader (stream))
+	{
+		baseNode = UIViewSnapshot::Reader ().read (stream);
+	}
+	else if (impl->nodes)
 	{
 		auto origNodes = std::move (impl->nodes);
 		impl->nodes = baseNode;
@@ -1187,7 +1542,7 @@ bool UIDescription::restoreViews (InputStream& stream, std::list<SharedPointer<C
 					(*customData)->remember ();
 				}
 			}
-			else
+			else if (childNode->getName () == "view")
 			{
 				CView* view = createViewFromNode (childNode);
 				if (view)
@@ -1253,7 +1608,14 @@ CView* UIDescription::createViewFromNode (UINode* node) const
 			{
 				if (itNode->getName () == "view")
 				{
-					CView* childView = createViewFromNode (itNode);
+					CView* childView = nullptr;
+					bool lazyCreation;
+					if (impl->lazyViewCreation && !impl->restoreViewsMode &&
+					    itNode->getAttributes ()->getBooleanAttribute (UIViewCreator::kAttrLazyCreation, lazyCreation) &&
+					    lazyCreation)
+						childView = createViewPlaceholder (itNode);
+					else
+						childView = createViewFromNode (itNode);
 					if (childView)
 					{
 						if (!viewContainer->addView (childView))
@@ -1304,6 +1666,47 @@ CView* UIDescription::createViewFromNode (UINode* node) const
 	return result;
 }
 
+//-----------------------------------------------------------------------------
+CView* UIDescription::createViewPlaceholder (UINode* node) const
+{
+	std::weak_ptr<bool> token (impl->lifetimeToken);
+	SharedPointer<UINode> lazyNode (node);
+	IController* controller = impl->controller;
+	auto placeholder = new UIViewPlaceholder (CRect (0, 0, 0, 0), [this, token, lazyNode, controller] () -> CView* {
+		if (token.expired ())
+			return nullptr;
+		ScopePointer<IController> sp (&impl->controller, controller);
+		return createViewFromNode (lazyNode);
+	});
+	if (impl->viewFactory)
+	{
+		// only the geometry is taken over, all other attributes are applied to the real view
+		UIAttributes geometryAttributes;
+		for (const auto& name : {UIViewCreator::kAttrOrigin, UIViewCreator::kAttrSize, UIViewCreator::kAttrAutosize})
+		{
+			if (auto value = node->getAttributes ()->getAttributeValue (name))
+				geometryAttributes.setAttribute (name, *value);
+		}
+		impl->viewFactory->applyCustomViewAttributeValues (placeholder, UIViewCreator::kCView, geometryAttributes, this);
+	}
+	// the placeholder starts hidden, the controller needs it to show the view
+	if (impl->controller)
+		return impl->controller->verifyView (placeholder, *node->getAttributes (), this);
+	return placeholder;
+}
+
+//-----------------------------------------------------------------------------
+void UIDescription::setLazyViewCreation (bool state)
+{
+	impl->lazyViewCreation = state;
+}
+
+//-----------------------------------------------------------------------------
+bool UIDescription::getLazyViewCreation () const
+{
+	return impl->lazyViewCreation;
+}
+
 //-----------------------------------------------------------------------------
 CViewAttributeID UIDescription::kTemplateNameAttributeID = 'uitl';
 
@@ -1476,8 +1879,19 @@ CBitmap* UIDescription::getBitmap (UTF8StringPtr name) const
 	UIBitmapNode* bitmapNode = dynamic_cast<UIBitmapNode*> (findChildNodeByNameAttribute (getBaseNode (MainNodeNames::kBitmap), name));
 	if (bitmapNode)
 	{
+		if (auto atlasName = bitmapNode->getAtlasName ())
+		{
+			// an atlas which is directly or indirectly its own atlas cannot be resolved
+			auto& resolving = impl->resolvingAtlasNames;
+			if (std::find (resolving.begin (), resolving.end (), name) != resolving.end ())
+				return nullptr;
+			resolving.emplace_back (name);
+			auto atlas = getBitmap (atlasName->c_str ());
+			resolving.pop_back ();
+			return bitmapNode->getAtlasBitmap (atlas);
+		}
 		CBitmap* bitmap = bitmapNode->getBitmap (impl->filePath);
-		if (impl->bitmapCreator && bitmap && bitmap->getPlatformBitmap () == nullptr)
+		if (impl->bitmapCreator && bitmap && !bitmap->isLoaded ())
 		{
 			auto platformBitmap = impl->bitmapCreator->createBitmap (*bitmapNode->getAttributes ());
 			if (platformBitmap)
@@ -1602,11 +2016,37 @@ CBitmap* UIDescription::getBitmap (UTF8StringPtr name) const
 			}
 			bitmapNode->setScaledBitmapsAdded ();
 		}
+		if (bitmap && !impl->reloadingBitmap && !bitmap->isReloadable () && bitmap->isLoaded ())
+		{
+			std::weak_ptr<bool> token (impl->lifetimeToken);
+			std::string bitmapName (name);
+			bitmap->setReloadFunction ([this, token, bitmapName] () -> SharedPointer<CBitmap> {
+				if (token.expired ())
+					return nullptr;
+				return reloadBitmap (bitmapName.data ());
+			});
+		}
 		return bitmap;
 	}
 	return nullptr;
 }
 
+//-----------------------------------------------------------------------------
+SharedPointer<CBitmap> UIDescription::reloadBitmap (UTF8StringPtr name) const
+{
+	auto bitmapNode = dynamic_cast<UIBitmapNode*> (findChildNodeByNameAttribute (getBaseNode (MainNodeNames::kBitmap), name));
+	if (!bitmapNode)
+		return nullptr;
+	// decode the bitmap again like the first time, the evicted bitmap stays in the node
+	auto evictedBitmap = bitmapNode->detachBitmap ();
+	auto wasReloading = impl->reloadingBitmap;
+	impl->reloadingBitmap = true;
+	SharedPointer<CBitmap> bitmap (getBitmap (name));
+	impl->reloadingBitmap = wasReloading;
+	bitmapNode->attachBitmap (evictedBitmap);
+	return bitmap;
+}
+
 //-----------------------------------------------------------------------------
 CFontRef UIDescription::getFont (UTF8StringPtr name) const
 {
@@ -3197,6 +3637,8 @@ bool UIBitmapNode::imagesEqual (IPlatformBitmap* b1, IPlatformBitmap* b2)
 //-----------------------------------------------------------------------------
 void UIBitmapNode::createXMLData (const std::string& pathHint)
 {
+	if (getAtlasName ())
+		return;
 	UINode* node = getChildren ().findChildNode ("data");
 	if (node)
 	{
@@ -3330,6 +3772,50 @@ CBitmap* UIBitmapNode::getBitmap (const std::string& pathHint)
 	return bitmap;
 }
 
+//-----------------------------------------------------------------------------
+CBitmap* UIBitmapNode::getAtlasBitmap (CBitmap* atlas)
+{
+	if (bitmap == nullptr && atlas)
+	{
+		CPoint frameSize;
+		if (!attributes->getPointAttribute ("frame-size", frameSize))
+			return nullptr;
+		CAtlasBitmap::FrameList frames;
+		for (auto& childNode : getChildren ())
+		{
+			if (childNode->getName () != "frame")
+				continue;
+			CAtlasBitmap::Frame frame;
+			if (!childNode->getAttributes ()->getRectAttribute ("region", frame.region))
+				continue;
+			childNode->getAttributes ()->getPointAttribute ("offset", frame.offset);
+			frames.emplace_back (frame);
+		}
+		bitmap = new CAtlasBitmap (atlas, frameSize, frames);
+	}
+	return bitmap;
+}
+
+//-----------------------------------------------------------------------------
+CBitmap* UIBitmapNode::detachBitmap ()
+{
+	auto result = bitmap;
+	bitmap = nullptr;
+	filterProcessed = false;
+	scaledBitmapsAdded = false;
+	return result;
+}
+
+//-----------------------------------------------------------------------------
+void UIBitmapNode::attachBitmap (CBitmap* newBitmap)
+{
+	if (bitmap)
+		bitmap->forget ();
+	bitmap = newBitmap;
+	filterProcessed = true;
+	scaledBitmapsAdded = true;
+}
+
 //-----------------------------------------------------------------------------
 void UIBitmapNode::setBitmap (UTF8StringPtr bitmapName)
 {
@@ -38,7 +38,14 @@ public:
 	virtual bool save (UTF8StringPtr filename, int32_t flags = kWriteWindowsResourceFile);
 	virtual bool saveWindowsRCFile (UTF8StringPtr filename);
 
-	bool storeViews (const std::list<CView*>& views, OutputStream& stream, UIAttributes* customData = nullptr) const;
+	enum ViewsFormat {
+		kXMLViewsFormat,
+		/** compact binary format for transfers inside the same process */
+		kBinaryViewsFormat
+	};
+
+	bool storeViews (const std::list<CView*>& views, OutputStream& stream, UIAttributes* customData = nullptr, ViewsFormat format = kXMLViewsFormat) const;
+	/** restores views stored in any of the formats */
 	bool restoreViews (InputStream& stream, std::list<SharedPointer<CView> >& views, UIAttributes** customData = nullptr);
 
 	UTF8StringPtr getFilePath () const;
@@ -127,6 +134,18 @@ public:
 
 	void setBitmapCreator (IBitmapCreator* bitmapCreator);
 
+	/** @name Lazy View Creation
+	 *	Views with the lazy-creation attribute are created with their children the first time they
+	 *	are shown, until then a hidden UIViewPlaceholder is created in their place. Enabled by
+	 *	default, the UI editor disables it while it edits the description.
+	 *
+	 *	@ingroup new_in_4_7
+	 */
+	///@{
+	void setLazyViewCreation (bool state);
+	bool getLazyViewCreation () const;
+	///@}
+
 	using FocusDrawing = FocusDrawingSettings;
 	FocusDrawing getFocusDrawingSettings () const;
 	void setFocusDrawingSettings (const FocusDrawing& fd);
@@ -153,8 +172,10 @@ private:
 	void xmlComment (Xml::Parser* parser, IdStringPtr comment) override;
 	
 	CView* createViewFromNode (UINode* node) const;
+	CView* createViewPlaceholder (UINode* node) const;
 	UINode* getBaseNode (UTF8StringPtr name) const;
 	UINode* findChildNodeByNameAttribute (UINode* node, UTF8StringPtr nameAttribute) const;
+	SharedPointer<CBitmap> reloadBitmap (UTF8StringPtr name) const;
 	UINode* findNodeForView (CView* view) const;
 	bool updateAttributesForView (UINode* node, CView* view, bool deep = true);
 	void removeNode (UTF8StringPtr name, IdStringPtr mainNodeName);
@@ -37,6 +37,7 @@ Attributes:
 - \b bitmap [bitmap name]
 - \b autosize [combination of <i>left</i>, <i>top</i>, <i>right</i>, <i>bottom</i>, <i>row</i>, or <i>column</i> see VSTGUI::CViewAutosizing]
 - \b tooltip [tooltip text]
+- \b lazy-creation [true/false] (a hidden placeholder is created instead, the view and its children are created the first time the placeholder is shown, see VSTGUI::UIViewPlaceholder)
 
 @section cviewcontainer CViewContainer
 Declaration:
@@ -306,6 +307,9 @@ Declaration:
 - \b template-switch-control [tag name]
 - \b animation-style [fade/move/push]
 - \b animation-time [integer]
+- \b cache-policy [rebuild/keep-alive/lru]
+- \b max-cached-views [integer]
+- \b pre-instantiate-views [true/false]
 
 @cond ignore
 */
@@ -622,6 +626,14 @@ public:
 		if (subControllerAttr)
 			view->setAttribute ('uisc', static_cast<uint32_t> (subControllerAttr->size () + 1), subControllerAttr->c_str ());
 
+		if (attributes.getBooleanAttribute (kAttrLazyCreation, b))
+		{
+			if (b)
+				view->setAttribute ('uilc', static_cast<uint32_t> (sizeof (b)), &b);
+			else
+				view->removeAttribute ('uilc');
+		}
+
 		double opacity;
 		if (attributes.getDoubleAttribute (kAttrOpacity, opacity))
 			view->setAlphaValue (static_cast<float>(opacity));
@@ -642,6 +654,7 @@ public:
 		attributeNames.emplace_back (kAttrTooltip);
 		attributeNames.emplace_back (kAttrCustomViewName);
 		attributeNames.emplace_back (kAttrSubController);
+		attributeNames.emplace_back (kAttrLazyCreation);
 		return true;
 	}
 	AttrType getAttributeType (const std::string& attributeName) const override
@@ -658,6 +671,7 @@ public:
 		else if (attributeName == kAttrTooltip) return kStringType;
 		else if (attributeName == kAttrCustomViewName) return kStringType;
 		else if (attributeName == kAttrSubController) return kStringType;
+		else if (attributeName == kAttrLazyCreation) return kBooleanType;
 		return kUnknownType;
 	}
 	bool getAttributeValue (CView* view, const std::string& attributeName, std::string& stringValue, const IUIDescription* desc) const override
@@ -743,6 +757,14 @@ public:
 		{
 			return getViewAttributeString (view, 'uisc', stringValue);
 		}
+		else if (attributeName == kAttrLazyCreation)
+		{
+			uint32_t outSize;
+			if (!view->getAttributeSize ('uilc', outSize))
+				return false;
+			stringValue = strTrue;
+			return true;
+		}
 		return false;
 	}
 	bool getAttributeValueRange (const std::string& attributeName, double& minValue, double &maxValue) const override
@@ -1092,6 +1114,7 @@ public:
 		applyStyleMask (attributes.getAttributeValue (kAttrOverlayScrollbars), CScrollView::kOverlayScrollbars, style);
 		applyStyleMask (attributes.getAttributeValue (kAttrFollowFocusView), CScrollView::kFollowFocusView, style);
 		applyStyleMask (attributes.getAttributeValue (kAttrAutoHideScrollbars), CScrollView::kAutoHideScrollbars, style);
+		applyStyleMask (attributes.getAttributeValue (kAttrScrollByTransform), CScrollView::kScrollByTransform, style);
 		scrollView->setStyle (style);
 		CColor color;
 		CScrollbar* vscrollbar = scrollView->getVerticalScrollbar ();
@@ -1130,6 +1153,7 @@ public:
 		attributeNames.emplace_back (kAttrScrollbarWidth);
 		attributeNames.emplace_back (kAttrBordered);
 		attributeNames.emplace_back (kAttrFollowFocusView);
+		attributeNames.emplace_back (kAttrScrollByTransform);
 		return true;
 	}
 	AttrType getAttributeType (const std::string& attributeName) const override
@@ -1146,6 +1170,7 @@ public:
 		if (attributeName == kAttrScrollbarWidth) return kIntegerType;
 		if (attributeName == kAttrBordered) return kBooleanType;
 		if (attributeName == kAttrFollowFocusView) return kBooleanType;
+		if (attributeName == kAttrScrollByTransform) return kBooleanType;
 		return kUnknownType;
 	}
 	bool getAttributeValue (CView* view, const std::string& attributeName, std::string& stringValue, const IUIDescription* desc) const override
@@ -1219,6 +1244,11 @@ public:
 			stringValue = sc->getStyle () & CScrollView::kFollowFocusView ? strTrue : strFalse;
 			return true;
 		}
+		if (attributeName == kAttrScrollByTransform)
+		{
+			stringValue = sc->getStyle () & CScrollView::kScrollByTransform ? strTrue : strFalse;
+			return true;
+		}
 		return false;
 	}
 
@@ -3730,6 +3760,10 @@ public:
 	std::string kMoveInOut = "move";
 	std::string kPushInOut = "push";
 
+	std::string kRebuildViews = "rebuild";
+	std::string kKeepViewsAlive = "keep-alive";
+	std::string kLRUCachedViews = "lru";
+
 	UIViewSwitchContainerCreator () { UIViewFactory::registerViewCreator (*this); }
 	IdStringPtr getViewName () const override { return kUIViewSwitchContainer; }
 	IdStringPtr getBaseViewName () const override { return kCViewContainer; }
@@ -3796,6 +3830,29 @@ public:
 		{
 			viewSwitch->setAnimationTime (static_cast<uint32_t> (animationTime));
 		}
+
+		attr = attributes.getAttributeValue (kAttrCachePolicy);
+		if (attr)
+		{
+			UIViewSwitchContainer::CachePolicy policy = UIViewSwitchContainer::kRebuildViews;
+			if (*attr == kKeepViewsAlive)
+				policy = UIViewSwitchContainer::kKeepViewsAlive;
+			else if (*attr == kLRUCachedViews)
+				policy = UIViewSwitchContainer::kLRUCachedViews;
+			viewSwitch->setCachePolicy (policy);
+		}
+
+		int32_t maxCachedViews;
+		if (attributes.getIntegerAttribute (kAttrMaxCachedViews, maxCachedViews))
+		{
+			viewSwitch->setMaxCachedViews (static_cast<uint32_t> (std::max (maxCachedViews, 1)));
+		}
+
+		bool preInstantiateViews;
+		if (attributes.getBooleanAttribute (kAttrPreInstantiateViews, preInstantiateViews))
+		{
+			viewSwitch->setPreInstantiateViews (preInstantiateViews);
+		}
 		return true;
 	}
 	bool getAttributeNames (std::list<std::string>& attributeNames) const override
@@ -3805,6 +3862,9 @@ public:
 		attributeNames.emplace_back (kAttrAnimationStyle);
 		attributeNames.emplace_back (kAttrAnimationTimingFunction);
 		attributeNames.emplace_back (kAttrAnimationTime);
+		attributeNames.emplace_back (kAttrCachePolicy);
+		attributeNames.emplace_back (kAttrMaxCachedViews);
+		attributeNames.emplace_back (kAttrPreInstantiateViews);
 		return true;
 	}
 	AttrType getAttributeType (const std::string& attributeName) const override
@@ -3814,6 +3874,9 @@ public:
 		if (attributeName == kAttrAnimationStyle) return kListType;
 		if (attributeName == kAttrAnimationTimingFunction) return kListType;
 		if (attributeName == kAttrAnimationTime) return kIntegerType;
+		if (attributeName == kAttrCachePolicy) return kListType;
+		if (attributeName == kAttrMaxCachedViews) return kIntegerType;
+		if (attributeName == kAttrPreInstantiateViews) return kBooleanType;
 		return kUnknownType;
 	}
 	bool getAttributeValue (CView* view, const std::string& attributeName, std::string& stringValue, const IUIDescription* desc) const override
@@ -3849,6 +3912,37 @@ public:
 			stringValue = numberToString ((int32_t)viewSwitch->getAnimationTime ());
 			return true;
 		}
+		else if (attributeName == kAttrMaxCachedViews)
+		{
+			stringValue = numberToString ((int32_t)viewSwitch->getMaxCachedViews ());
+			return true;
+		}
+		else if (attributeName == kAttrPreInstantiateViews)
+		{
+			stringValue = viewSwitch->getPreInstantiateViews () ? strTrue : strFalse;
+			return true;
+		}
+		else if (attributeName == kAttrCachePolicy)
+		{
+			switch (viewSwitch->getCachePolicy ())
+			{
+				case UIViewSwitchContainer::kRebuildViews:
+				{
+					stringValue = kRebuildViews;
+					return true;
+				}
+				case UIViewSwitchContainer::kKeepViewsAlive:
+				{
+					stringValue = kKeepViewsAlive;
+					return true;
+				}
+				case UIViewSwitchContainer::kLRUCachedViews:
+				{
+					stringValue = kLRUCachedViews;
+					return true;
+				}
+			}
+		}
 		else if (attributeName == kAttrAnimationStyle)
 		{
 			switch (viewSwitch->getAnimationStyle ())
@@ -3921,6 +4015,13 @@ public:
 			values.emplace_back (&kEasy);
 			return true;
 		}
+		if (attributeName == kAttrCachePolicy)
+		{
+			values.emplace_back (&kRebuildViews);
+			values.emplace_back (&kKeepViewsAlive);
+			values.emplace_back (&kLRUCachedViews);
+			return true;
+		}
 		return false;
 	}
 };
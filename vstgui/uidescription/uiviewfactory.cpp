@@ -133,9 +133,6 @@ static ViewCreatorRegistry& getCreatorRegistry ()
 	return creatorRegistry;
 }
 
-//-----------------------------------------------------------------------------
-static CViewAttributeID kViewNameAttribute = 'cvcr';
-
 //-----------------------------------------------------------------------------
 UIViewFactory::UIViewFactory ()
 {
@@ -152,7 +149,7 @@ CView* UIViewFactory::createViewByName (const std::string* className, const UIAt
 		if (view)
 		{
 			IdStringPtr viewName = (*iter).second->getViewName ();
-			view->setAttribute (kViewNameAttribute, viewName);
+			view->setAttribute (kCViewClassNameAttribute, viewName);
 			UIAttributes evaluatedAttributes;
 			evaluateAttributesAndRemember (view, attributes, evaluatedAttributes, description);
 			while (iter != registry.end () && (*iter).second->apply (view, evaluatedAttributes, description))
@@ -209,7 +206,7 @@ bool UIViewFactory::applyCustomViewAttributeValues (CView* customView, IdStringP
 	if (iter != registry.end ())
 	{
 		IdStringPtr viewName = (*iter).second->getViewName ();
-		customView->setAttribute (kViewNameAttribute, viewName);
+		customView->setAttribute (kCViewClassNameAttribute, viewName);
 	}
 	UIAttributes evaluatedAttributes;
 	evaluateAttributesAndRemember (customView, attributes, evaluatedAttributes, desc);
@@ -225,7 +222,7 @@ IdStringPtr UIViewFactory::getViewName (CView* view) const
 {
 	IdStringPtr viewName = nullptr;
 	uint32_t size = sizeof (IdStringPtr);
-	view->getAttribute (kViewNameAttribute, size, &viewName, size);
+	view->getAttribute (kCViewClassNameAttribute, size, &viewName, size);
 	return viewName;
 }
 
@@ -0,0 +1,68 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "uiviewplaceholder.h"
+
+namespace VSTGUI {
+
+//-----------------------------------------------------------------------------
+UIViewPlaceholder::UIViewPlaceholder (const CRect& size, CreateViewFunc&& createViewFunc)
+: CViewContainer (size)
+, createViewFunc (std::move (createViewFunc))
+{
+	setTransparency (true);
+	CViewContainer::setVisible (false);
+}
+
+//-----------------------------------------------------------------------------
+CView* UIViewPlaceholder::materialize ()
+{
+	if (createViewFunc)
+	{
+		auto func = std::move (createViewFunc);
+		createViewFunc = nullptr;
+		if (auto view = func ())
+		{
+			CRect r (0, 0, getWidth (), getHeight ());
+			view->setViewSize (r);
+			view->setMouseableArea (r);
+			addView (view);
+		}
+	}
+	return getView (0);
+}
+
+//-----------------------------------------------------------------------------
+void UIViewPlaceholder::materializeAll (CViewContainer* container)
+{
+	container->forEachChild ([] (CView* view) {
+		if (auto placeholder = dynamic_cast<UIViewPlaceholder*> (view))
+			placeholder->materialize ();
+		if (auto childContainer = view->asViewContainer ())
+			materializeAll (childContainer);
+	});
+}
+
+//-----------------------------------------------------------------------------
+void UIViewPlaceholder::setVisible (bool state)
+{
+	if (state)
+		materialize ();
+	CViewContainer::setVisible (state);
+}
+
+//-----------------------------------------------------------------------------
+void UIViewPlaceholder::setViewSize (const CRect& rect, bool invalid)
+{
+	CViewContainer::setViewSize (rect, invalid);
+	// the view always fills the placeholder
+	if (auto view = getView (0))
+	{
+		CRect r (0, 0, getWidth (), getHeight ());
+		view->setViewSize (r, invalid);
+		view->setMouseableArea (r);
+	}
+}
+
+} // namespace
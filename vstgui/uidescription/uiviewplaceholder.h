@@ -0,0 +1,53 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#ifndef __uiviewplaceholder__
+#define __uiviewplaceholder__
+
+#include "../lib/cviewcontainer.h"
+#include <functional>
+
+namespace VSTGUI {
+
+//-----------------------------------------------------------------------------
+/** @brief Placeholder for a view which is created the first time it is shown
+ *
+ *	The UIDescription creates a placeholder instead of a view and its children when the view
+ *	has the lazy-creation attribute set. The placeholder takes over the origin, size and autosize
+ *	flags of the view and starts hidden. The controller gets a verifyView call for the
+ *	placeholder with the attributes of the view, so that it can keep the placeholder and show it
+ *	later. The real view is created the first time the placeholder is made visible and is then
+ *	added to the placeholder with the size of the placeholder. The controller gets its createView
+ *	and verifyView calls for the view and its children at this time.
+ *
+ *	@ingroup new_in_4_7
+ */
+//-----------------------------------------------------------------------------
+class UIViewPlaceholder : public CViewContainer
+{
+public:
+	using CreateViewFunc = std::function<CView* ()>;
+
+	UIViewPlaceholder (const CRect& size, CreateViewFunc&& createViewFunc);
+
+	/** create the view if not done yet, the visibility of the placeholder is not changed
+	 *	@return the view or nullptr if it could not be created
+	 */
+	CView* materialize ();
+	bool isMaterialized () const { return !createViewFunc; }
+
+	/** materialize all placeholders in the container and its children */
+	static void materializeAll (CViewContainer* container);
+
+	void setVisible (bool state) override;
+	void setViewSize (const CRect& rect, bool invalid = true) override;
+//-----------------------------------------------------------------------------
+	CLASS_METHODS_NOCOPY (UIViewPlaceholder, CViewContainer)
+protected:
+	CreateViewFunc createViewFunc;
+};
+
+} // namespace
+
+#endif // __uiviewplaceholder__
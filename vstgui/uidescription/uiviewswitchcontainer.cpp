@@ -9,6 +9,8 @@
 #include "../lib/controls/ccontrol.h"
 #include "../lib/animation/timingfunctions.h"
 #include "../lib/animation/animations.h"
+#include <algorithm>
+#include <functional>
 
 namespace VSTGUI {
 
@@ -36,6 +38,105 @@ void UIViewSwitchContainer::setController (IViewSwitchController* _controller)
 	controller = _controller;
 }
 
+namespace {
+
+//-----------------------------------------------------------------------------
+/** exchanges two views like ExchangeViewAnimation, but the old view is a cached view and is hidden
+ *	instead of removed when the animation is finished. The old view gets back the size and alpha
+ *	value it had before the animation, so it is shown unchanged the next time.
+ */
+class ExchangeCachedViewAnimation : public Animation::IAnimationTarget, public NonAtomicReferenceCounted
+{
+public:
+	using AnimationStyle = Animation::ExchangeViewAnimation::AnimationStyle;
+	using FinishedFunc = std::function<void (CView* oldView)>;
+
+	ExchangeCachedViewAnimation (CView* oldView, CView* newView, AnimationStyle style,
+	                             FinishedFunc&& finished)
+	: oldView (oldView)
+	, newView (newView)
+	, style (style)
+	, finished (std::move (finished))
+	, oldViewSize (oldView->getViewSize ())
+	, oldViewAlphaValue (oldView->getAlphaValue ())
+	, newViewAlphaValue (newView->getAlphaValue ())
+	{
+		vstgui_assert (oldView->isSubview () && newView->isSubview ());
+		newViewSize = newView->getViewSize ();
+		newViewSize.moveTo (oldViewSize.getTopLeft ());
+		animationTick (nullptr, nullptr, 0.f);
+		newView->setVisible (true);
+	}
+
+	void animationStart (CView* view, IdStringPtr name) override {}
+
+	void animationTick (CView* view, IdStringPtr name, float pos) override
+	{
+		switch (style)
+		{
+			case AnimationStyle::kAlphaValueFade:
+			{
+				oldView->setAlphaValue (oldViewAlphaValue * (1.f - pos));
+				newView->setAlphaValue (newViewAlphaValue * pos);
+				break;
+			}
+			case AnimationStyle::kPushInFromLeft:
+			case AnimationStyle::kPushInOutFromLeft:
+			{
+				pushIn (-1., pos);
+				break;
+			}
+			default:
+			{
+				pushIn (1., pos);
+				break;
+			}
+		}
+	}
+
+	void animationFinished (CView* view, IdStringPtr name, bool wasCanceled) override
+	{
+		animationTick (nullptr, nullptr, 1.f);
+		oldView->setVisible (false);
+		updateViewSize (oldView, oldViewSize);
+		oldView->setAlphaValue (oldViewAlphaValue);
+		finished (oldView);
+	}
+
+private:
+	void pushIn (CCoord direction, float pos)
+	{
+		CRect r (newViewSize);
+		r.offset (direction * newViewSize.getWidth () * (1. - pos), 0.);
+		updateViewSize (newView, r);
+		if (style == AnimationStyle::kPushInOutFromLeft || style == AnimationStyle::kPushInOutFromRight)
+		{
+			r = oldViewSize;
+			r.offset (-direction * oldViewSize.getWidth () * pos, 0.);
+			updateViewSize (oldView, r);
+		}
+	}
+
+	void updateViewSize (CView* view, const CRect& rect)
+	{
+		view->invalid ();
+		view->setViewSize (rect);
+		view->setMouseableArea (rect);
+		view->invalid ();
+	}
+
+	SharedPointer<CView> oldView;
+	SharedPointer<CView> newView;
+	AnimationStyle style;
+	FinishedFunc finished;
+	CRect oldViewSize;
+	CRect newViewSize;
+	float oldViewAlphaValue;
+	float newViewAlphaValue;
+};
+
+} // namespace
+
 //-----------------------------------------------------------------------------
 void UIViewSwitchContainer::setCurrentViewIndex (int32_t viewIndex)
 {
@@ -43,7 +144,9 @@ void UIViewSwitchContainer::setCurrentViewIndex (int32_t viewIndex)
 
 	if (controller && viewIndex != currentViewIndex)
 	{
-		CView* view = controller->createViewForIndex (viewIndex);
+		// finish a running animation, so the old view is hidden or removed
+		removeAnimation ("UIViewSwitchContainer::setCurrentViewIndex");
+		CView* view = getViewForIndex (viewIndex);
 		if (view)
 		{
 			if (view->getAutosizeFlags () & kAutosizeAll)
@@ -53,97 +156,227 @@ void UIViewSwitchContainer::setCurrentViewIndex (int32_t viewIndex)
 				view->setViewSize (vs);
 				view->setMouseableArea (vs);
 			}
-			if (isAttached () && animationTime)
+			CView* oldView = currentView;
+			// cached views stay subviews, removing them would unregister them from the frame
+			bool hideOldView = oldView && isCachedView (oldView);
+			if (isAttached () && animationTime && oldView)
 			{
-				removeAnimation ("UIViewSwitchContainer::setCurrentViewIndex");
-				CView* oldView = getView (0);
-				if (oldView)
+				ExchangeViewAnimation::AnimationStyle style = ExchangeViewAnimation::kAlphaValueFade;
+				switch (animationStyle)
 				{
-					IAnimationTarget* animation = nullptr;
-					switch (animationStyle)
+					case kFadeInOut:
+					{
+						break;
+					}
+					case kMoveInOut:
 					{
-						case kFadeInOut:
-						{
-							animation = new ExchangeViewAnimation (oldView, view, ExchangeViewAnimation::kAlphaValueFade);
-							break;
-						}
-						case kMoveInOut:
-						{
-							ExchangeViewAnimation::AnimationStyle style = ExchangeViewAnimation::kPushInFromLeft;
-							if (viewIndex > currentViewIndex)
-							{
-								style = ExchangeViewAnimation::kPushInFromRight;
-							}
-							animation = new ExchangeViewAnimation (oldView, view, style);
-							break;
-						}
-						case kPushInOut:
-						{
-							ExchangeViewAnimation::AnimationStyle style = ExchangeViewAnimation::kPushInOutFromLeft;
-							if (viewIndex > currentViewIndex)
-							{
-								style = ExchangeViewAnimation::kPushInOutFromRight;
-							}
-							animation = new ExchangeViewAnimation (oldView, view, style);
-							break;
-						}
+						style = viewIndex > currentViewIndex ? ExchangeViewAnimation::kPushInFromRight :
+						                                      ExchangeViewAnimation::kPushInFromLeft;
+						break;
 					}
-					if (animation)
+					case kPushInOut:
 					{
-						ITimingFunction* tf = nullptr;
-						switch (timingFunction)
-						{
-							case kEasyIn:
-							{
-								tf = new CubicBezierTimingFunction (CubicBezierTimingFunction::easyIn (animationTime));
-								break;
-							}
-							case kEasyOut:
-							{
-								tf = new CubicBezierTimingFunction (CubicBezierTimingFunction::easyOut (animationTime));
-								break;
-							}
-							case kEasyInOut:
-							{
-								tf = new CubicBezierTimingFunction (CubicBezierTimingFunction::easyInOut (animationTime));
-								break;
-							}
-							case kEasy:
-							{
-								tf = new CubicBezierTimingFunction (CubicBezierTimingFunction::easy (animationTime));
-								break;
-							}
-							default:
-							{
-								tf = new LinearTimingFunction (animationTime);
-								break;
-							}
-						}
-						addAnimation ("UIViewSwitchContainer::setCurrentViewIndex", animation, tf);
+						style = viewIndex > currentViewIndex ? ExchangeViewAnimation::kPushInOutFromRight :
+						                                      ExchangeViewAnimation::kPushInOutFromLeft;
+						break;
 					}
-					else
+				}
+				IAnimationTarget* animation = nullptr;
+				if (hideOldView)
+				{
+					if (!view->isSubview ())
 					{
-						removeAll ();
+						view->setVisible (false);
 						addView (view);
 					}
+					animation = new ExchangeCachedViewAnimation (oldView, view, style, [this] (CView* v) {
+						hideCachedView (v);
+						trimCachedViews ();
+					});
 				}
 				else
 				{
-					removeAll ();
-					addView (view);
+					animation = new ExchangeViewAnimation (oldView, view, style);
+				}
+				ITimingFunction* tf = nullptr;
+				switch (timingFunction)
+				{
+					case kEasyIn:
+					{
+						tf = new CubicBezierTimingFunction (CubicBezierTimingFunction::easyIn (animationTime));
+						break;
+					}
+					case kEasyOut:
+					{
+						tf = new CubicBezierTimingFunction (CubicBezierTimingFunction::easyOut (animationTime));
+						break;
+					}
+					case kEasyInOut:
+					{
+						tf = new CubicBezierTimingFunction (CubicBezierTimingFunction::easyInOut (animationTime));
+						break;
+					}
+					case kEasy:
+					{
+						tf = new CubicBezierTimingFunction (CubicBezierTimingFunction::easy (animationTime));
+						break;
+					}
+					default:
+					{
+						tf = new LinearTimingFunction (animationTime);
+						break;
+					}
 				}
+				addAnimation ("UIViewSwitchContainer::setCurrentViewIndex", animation, tf);
 			}
 			else
 			{
-				CViewContainer::removeAll ();
-				CViewContainer::addView (view);
+				if (hideOldView)
+					hideCachedView (oldView);
+				else if (oldView)
+					CViewContainer::removeView (oldView);
+				if (view->isSubview ())
+					view->setVisible (true);
+				else
+					CViewContainer::addView (view);
 			}
+			currentView = view;
 			currentViewIndex = viewIndex;
+			trimCachedViews ();
 			invalid ();
 		}
 	}
 }
 
+//-----------------------------------------------------------------------------
+CView* UIViewSwitchContainer::getViewForIndex (int32_t index)
+{
+	if (cachePolicy == kRebuildViews)
+		return controller->createViewForIndex (index);
+
+	auto it = std::find_if (cachedViews.begin (), cachedViews.end (),
+	                        [&] (const CachedView& cached) { return cached.index == index; });
+	if (it != cachedViews.end ())
+	{
+		cachedViews.splice (cachedViews.begin (), cachedViews, it);
+	}
+	else
+	{
+		CView* view = controller->createViewForIndex (index);
+		if (view == nullptr)
+			return nullptr;
+		cachedViews.push_front ({index, owned (view)});
+	}
+	CView* view = cachedViews.front ().view;
+	// the container owns one reference of its subviews
+	if (!view->isSubview ())
+		view->remember ();
+	return view;
+}
+
+//-----------------------------------------------------------------------------
+bool UIViewSwitchContainer::isCachedView (CView* view) const
+{
+	return std::find_if (cachedViews.begin (), cachedViews.end (), [&] (const CachedView& cached) {
+		       return cached.view == view;
+	       }) != cachedViews.end ();
+}
+
+//-----------------------------------------------------------------------------
+void UIViewSwitchContainer::hideCachedView (CView* view)
+{
+	if (auto frame = getFrame ())
+	{
+		auto focusView = frame->getFocusView ();
+		if (focusView == view || (view->asViewContainer () && view->asViewContainer ()->isChild (focusView, true)))
+			frame->setFocusView (nullptr);
+	}
+	if (getMouseDownView () == view)
+		setMouseDownView (nullptr);
+	view->setVisible (false);
+}
+
+//-----------------------------------------------------------------------------
+void UIViewSwitchContainer::preInstantiateNextView ()
+{
+	if (controller && cachePolicy != kRebuildViews &&
+	    (cachePolicy != kLRUCachedViews || cachedViews.size () < maxCachedViews))
+	{
+		auto numViews = controller->getNumViews ();
+		for (auto index = 0; index < numViews; ++index)
+		{
+			auto it = std::find_if (cachedViews.begin (), cachedViews.end (),
+			                        [&] (const CachedView& cached) { return cached.index == index; });
+			if (it != cachedViews.end ())
+				continue;
+			if (CView* view = controller->createViewForIndex (index))
+			{
+				// views which were not shown yet are the first to be removed from the cache
+				cachedViews.push_back ({index, owned (view)});
+				return;
+			}
+		}
+	}
+	if (preInstantiateTimer)
+		preInstantiateTimer->stop ();
+}
+
+//-----------------------------------------------------------------------------
+void UIViewSwitchContainer::trimCachedViews ()
+{
+	if (cachePolicy != kLRUCachedViews)
+		return;
+	auto it = cachedViews.end ();
+	while (cachedViews.size () > maxCachedViews && it != cachedViews.begin ())
+	{
+		--it;
+		auto view = it->view;
+		if (view->isSubview ())
+		{
+			// the shown view and a view which is animated out can not be removed
+			if (view->isVisible ())
+				continue;
+			CViewContainer::removeView (view);
+		}
+		it = cachedViews.erase (it);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void UIViewSwitchContainer::setCachePolicy (CachePolicy policy)
+{
+	cachePolicy = policy;
+	if (cachePolicy == kRebuildViews)
+		clearCachedViews ();
+	else
+		trimCachedViews ();
+}
+
+//-----------------------------------------------------------------------------
+void UIViewSwitchContainer::setMaxCachedViews (uint32_t numViews)
+{
+	maxCachedViews = std::max (numViews, 1u);
+	trimCachedViews ();
+}
+
+//-----------------------------------------------------------------------------
+void UIViewSwitchContainer::setPreInstantiateViews (bool state)
+{
+	preInstantiateViews = state;
+}
+
+//-----------------------------------------------------------------------------
+void UIViewSwitchContainer::clearCachedViews ()
+{
+	removeAnimation ("UIViewSwitchContainer::setCurrentViewIndex");
+	for (auto& cached : cachedViews)
+	{
+		if (cached.view != currentView && cached.view->isSubview ())
+			CViewContainer::removeView (cached.view);
+	}
+	cachedViews.clear ();
+}
+
 //-----------------------------------------------------------------------------
 void UIViewSwitchContainer::setAnimationTime (uint32_t ms)
 {
@@ -167,8 +400,16 @@ bool UIViewSwitchContainer::attached (CView* parent)
 {
 	bool result = CViewContainer::attached (parent);
 	CViewContainer::removeAll ();
+	currentView = nullptr;
 	if (result && controller)
+	{
 		controller->switchContainerAttached ();
+		if (preInstantiateViews && cachePolicy != kRebuildViews)
+		{
+			preInstantiateTimer = makeOwned<CVSTGUITimer> (
+			    [this] (CVSTGUITimer*) { preInstantiateNextView (); }, 10);
+		}
+	}
 	return result;
 }
 
@@ -178,10 +419,13 @@ bool UIViewSwitchContainer::removed (CView* parent)
 	if (isAttached ())
 	{
 		removeAnimation ("UIViewSwitchContainer::setCurrentViewIndex");
+		preInstantiateTimer = nullptr;
 		bool result = CViewContainer::removed (parent);
 		if (result && controller)
 			controller->switchContainerRemoved ();
 		CViewContainer::removeAll ();
+		currentView = nullptr;
+		clearCachedViews ();
 		return result;
 	}
 	return false;
@@ -211,6 +455,12 @@ CView* UIDescriptionViewSwitchController::createViewForIndex (int32_t index)
 	return nullptr;
 }
 
+//-----------------------------------------------------------------------------
+int32_t UIDescriptionViewSwitchController::getNumViews () const
+{
+	return static_cast<int32_t> (templateNames.size ());
+}
+
 //-----------------------------------------------------------------------------
 static CControl* findControlForTag (CViewContainer* parent, int32_t tag, bool reverse = true)
 {
@@ -284,6 +534,7 @@ void UIDescriptionViewSwitchController::valueChanged (CControl* pControl)
 //-----------------------------------------------------------------------------
 void UIDescriptionViewSwitchController::setTemplateNames (UTF8StringPtr _templateNames)
 {
+	viewSwitch->clearCachedViews ();
 	templateNames.clear ();
 	if (_templateNames)
 	{
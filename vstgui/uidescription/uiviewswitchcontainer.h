@@ -6,9 +6,11 @@
 #define __uiviewswitchcontainer__
 
 #include "../lib/cviewcontainer.h"
+#include "../lib/cvstguitimer.h"
 #include "../lib/controls/icontrollistener.h"
 #include "../lib/vstguifwd.h"
 #include "uidescriptionfwd.h"
+#include <list>
 #include <vector>
 
 namespace VSTGUI {
@@ -26,6 +28,8 @@ public:
 
 	void setCurrentViewIndex (int32_t viewIndex);
 	int32_t getCurrentViewIndex () const { return currentViewIndex; }
+	/** the shown view, with a cache policy the container has the hidden cached views as subviews, too */
+	CView* getCurrentView () const { return currentView; }
 
 	void setAnimationTime (uint32_t ms);
 	uint32_t getAnimationTime () const { return animationTime; }
@@ -50,16 +54,74 @@ public:
 	void setTimingFunction (TimingFunction t);
 	TimingFunction getTimingFunction () const { return timingFunction; }
 
+	/** @name View Cache
+	 *	By default the view of an index is created when it is shown and destroyed when it is
+	 *	hidden. With a cache policy the views are kept while the container is attached, so
+	 *	switching back to a view does not create it again. Once shown, a cached view stays a
+	 *	subview of the container and is only made invisible when it is hidden, as removing it
+	 *	would unregister it from the frame (the VST3Editor releases the sub controllers and the
+	 *	parameter bindings of removed views). Together with pre-instantiation the
+	 *	hidden views are created ahead of time, one view per timer tick after the container was
+	 *	attached, so that the first switch to a complex view does not create it either.
+	 *
+	 *	@ingroup new_in_4_7
+	 */
+	///@{
+	enum CachePolicy {
+		/** create the view when it is shown and destroy it when it is hidden */
+		kRebuildViews,
+		/** keep all views */
+		kKeepViewsAlive,
+		/** keep the most recently shown views up to the maximum number of cached views */
+		kLRUCachedViews
+	};
+
+	void setCachePolicy (CachePolicy policy);
+	CachePolicy getCachePolicy () const { return cachePolicy; }
+
+	/** maximum number of views kept with the kLRUCachedViews policy, including the shown view */
+	void setMaxCachedViews (uint32_t numViews);
+	uint32_t getMaxCachedViews () const { return maxCachedViews; }
+
+	/** create the hidden views ahead of time, only used with a cache policy */
+	void setPreInstantiateViews (bool state);
+	bool getPreInstantiateViews () const { return preInstantiateViews; }
+
+	/** remove all views from the cache, the shown view is kept until the next switch */
+	void clearCachedViews ();
+	///@}
+
 	bool attached (CView* parent) override;
 	bool removed (CView* parent) override;
 //-----------------------------------------------------------------------------
 	CLASS_METHODS (UIViewSwitchContainer, CViewContainer)
 protected:
+	/** returns a view with a reference owned by the caller if it is not a subview yet */
+	CView* getViewForIndex (int32_t index);
+	bool isCachedView (CView* view) const;
+	void hideCachedView (CView* view);
+	void preInstantiateNextView ();
+	void trimCachedViews ();
+
+	struct CachedView
+	{
+		int32_t index;
+		SharedPointer<CView> view;
+	};
+	using CachedViews = std::list<CachedView>;
+
 	IViewSwitchController* controller {nullptr};
+	CView* currentView {nullptr};
 	int32_t currentViewIndex {-1};
 	uint32_t animationTime {120};
 	AnimationStyle animationStyle {kFadeInOut};
 	TimingFunction timingFunction {kLinear};
+	CachePolicy cachePolicy {kRebuildViews};
+	uint32_t maxCachedViews {4};
+	bool preInstantiateViews {false};
+	/** most recently shown view first */
+	CachedViews cachedViews;
+	SharedPointer<CVSTGUITimer> preInstantiateTimer;
 };
 
 //-----------------------------------------------------------------------------
@@ -74,6 +136,8 @@ public:
 	UIViewSwitchContainer* getViewSwitchContainer () const { return viewSwitch; }
 
 	virtual CView* createViewForIndex (int32_t index) = 0;
+	/** number of views the controller can create, only used to pre-instantiate the views */
+	virtual int32_t getNumViews () const { return 0; }
 	virtual void switchContainerAttached () = 0;
 	virtual void switchContainerRemoved () = 0;
 protected:
@@ -87,6 +151,7 @@ public:
 	UIDescriptionViewSwitchController (UIViewSwitchContainer* viewSwitch, const IUIDescription* uiDescription, IController* uiController);
 
 	CView* createViewForIndex (int32_t index) override;
+	int32_t getNumViews () const override;
 	void switchContainerAttached () override;
 	void switchContainerRemoved () override;
 
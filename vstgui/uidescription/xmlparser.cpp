@@ -34,6 +34,7 @@ namespace Xml {
 
 #include "xmlparser.h"
 #include <algorithm>
+#include <limits>
 
 namespace VSTGUI {
 namespace Xml {
@@ -43,6 +44,14 @@ struct Parser::Impl
 {
 	XML_ParserStruct* parser {nullptr};
 	IHandler* handler {nullptr};
+
+	enum class Result
+	{
+		Continue,
+		Done,
+		Failed
+	};
+	Result checkStatus (XML_Status status) const;
 };
 
 //------------------------------------------------------------------------
@@ -101,6 +110,61 @@ IHandler* Parser::getHandler () const
 	return pImpl->handler;
 }
 
+//-----------------------------------------------------------------------------
+auto Parser::Impl::checkStatus (XML_Status status) const -> Result
+{
+	switch (status)
+	{
+		case XML_STATUS_ERROR:
+		{
+			XML_Error error = XML_GetErrorCode (parser);
+			if (error == XML_ERROR_JUNK_AFTER_DOC_ELEMENT) // that's ok
+				return Result::Done;
+			#if DEBUG
+			XML_Size currentLineNumber = XML_GetCurrentLineNumber (parser);
+			DebugPrint ("XML Parser Error on line: %d\n", currentLineNumber);
+			DebugPrint ("%s\n", XML_ErrorString (XML_GetErrorCode (parser)));
+			int offset, size;
+			const char* inputContext = XML_GetInputContext (parser, &offset, &size);
+			if (inputContext)
+			{
+				int pos = offset;
+				while (offset > 0 && pos - offset < 20)
+				{
+					if (inputContext[offset] == '\n')
+					{
+						offset++;
+						break;
+					}
+					offset--;
+				}
+				for (int i = offset; i < size && i - offset < 40; i++)
+				{
+					if (inputContext[i] == '\n')
+						break;
+					if (inputContext[i] == '\t')
+						DebugPrint (" ");
+					else
+						DebugPrint ("%c", inputContext[i]);
+				}
+				DebugPrint ("\n");
+				for (int i = offset; i < pos; i++)
+				{
+					DebugPrint (" ");
+				}
+				DebugPrint ("^\n");
+			}
+			#endif
+			return Result::Failed;
+		}
+		case XML_STATUS_SUSPENDED:
+			return Result::Done;
+		default:
+			break;
+	}
+	return Result::Continue;
+}
+
 //-----------------------------------------------------------------------------
 bool Parser::parse (IContentProvider* provider, IHandler* handler)
 {
@@ -114,10 +178,24 @@ bool Parser::parse (IContentProvider* provider, IHandler* handler)
 	XML_SetCharacterDataHandler (pImpl->parser, gCharacterDataHandler);
 	XML_SetCommentHandler (pImpl->parser, gCommentHandler);
 
-	static const uint32_t kBufferSize = 0x8000;
-
 	provider->rewind ();
 
+	const int8_t* data = nullptr;
+	uint64_t dataSize = 0;
+	if (provider->getRawXmlData (data, dataSize) &&
+	    dataSize <= static_cast<uint64_t> (std::numeric_limits<int>::max ()))
+	{
+		// the content is completely in memory, so expat can parse it in one go without copying
+		// it into its own buffer
+		auto status = XML_Parse (pImpl->parser, reinterpret_cast<const char*> (data),
+		                         static_cast<int> (dataSize), true);
+		auto result = pImpl->checkStatus (status);
+		pImpl->handler = nullptr;
+		return result != Impl::Result::Failed;
+	}
+
+	static const uint32_t kBufferSize = 0x8000;
+
 	while (true) 
 	{
 		void* buffer = XML_GetBuffer (pImpl->parser, kBufferSize);
@@ -131,60 +209,19 @@ bool Parser::parse (IContentProvider* provider, IHandler* handler)
 		if (bytesRead == kStreamIOError)
 			bytesRead = 0;
 		XML_Status status = XML_ParseBuffer (pImpl->parser, static_cast<int> (bytesRead), bytesRead == 0);
-		switch (status) 
+		switch (pImpl->checkStatus (status))
 		{
-			case XML_STATUS_ERROR:
+			case Impl::Result::Failed:
 			{
-				XML_Error error = XML_GetErrorCode (pImpl->parser);
-				if (error == XML_ERROR_JUNK_AFTER_DOC_ELEMENT) // that's ok
-				{
-					pImpl->handler = nullptr;
-					return true;
-				}
-				#if DEBUG
-				XML_Size currentLineNumber = XML_GetCurrentLineNumber (pImpl->parser);
-				DebugPrint ("XML Parser Error on line: %d\n", currentLineNumber);
-				DebugPrint ("%s\n", XML_ErrorString (XML_GetErrorCode (pImpl->parser)));
-				int offset, size;
-				const char* inputContext = XML_GetInputContext (pImpl->parser, &offset, &size);
-				if (inputContext)
-				{
-					int pos = offset;
-					while (offset > 0 && pos - offset < 20)
-					{
-						if (inputContext[offset] == '\n')
-						{
-							offset++;
-							break;
-						}
-						offset--;
-					}
-					for (int i = offset; i < size && i - offset < 40; i++)
-					{
-						if (inputContext[i] == '\n')
-							break;
-						if (inputContext[i] == '\t')
-							DebugPrint (" ");
-						else
-							DebugPrint ("%c", inputContext[i]);
-					}
-					DebugPrint ("\n");
-					for (int i = offset; i < pos; i++)
-					{
-						DebugPrint (" ");
-					}
-					DebugPrint ("^\n");
-				}
-				#endif
 				pImpl->handler = nullptr;
 				return false;
 			}
-			case XML_STATUS_SUSPENDED:
+			case Impl::Result::Done:
 			{
 				pImpl->handler = nullptr;
 				return true;
 			}
-			default:
+			case Impl::Result::Continue:
 				break;
 		}
 
@@ -222,6 +259,14 @@ void MemoryContentProvider::rewind ()
 	CMemoryStream::rewind ();
 }
 
+//------------------------------------------------------------------------
+bool MemoryContentProvider::getRawXmlData (const int8_t*& data, uint64_t& dataSize)
+{
+	data = getBuffer ();
+	dataSize = size;
+	return data != nullptr;
+}
+
 //------------------------------------------------------------------------
 //------------------------------------------------------------------------
 //------------------------------------------------------------------------
@@ -240,6 +285,21 @@ uint32_t InputStreamContentProvider::readRawXmlData (int8_t* buffer, uint32_t si
 	return stream.readRaw (buffer, size);
 }
 
+//------------------------------------------------------------------------
+bool InputStreamContentProvider::getRawXmlData (const int8_t*& data, uint64_t& dataSize)
+{
+	auto memoryStream = dynamic_cast<MemoryBackedStream*> (&stream);
+	if (!memoryStream)
+		return false;
+	uint64_t memorySize = 0;
+	auto memory = memoryStream->getMemory (memorySize);
+	if (!memory || startPos < 0 || static_cast<uint64_t> (startPos) > memorySize)
+		return false;
+	data = memory + startPos;
+	dataSize = memorySize - static_cast<uint64_t> (startPos);
+	return true;
+}
+
 //------------------------------------------------------------------------
 void InputStreamContentProvider::rewind ()
 {
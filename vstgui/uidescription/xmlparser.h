@@ -20,6 +20,10 @@ class IContentProvider
 public:
 	virtual uint32_t readRawXmlData (int8_t* buffer, uint32_t size) = 0;
 	virtual void rewind () = 0;
+	/** get the whole content at once if it is available in memory. The parser then parses it
+	 *	without copying.
+	 */
+	virtual bool getRawXmlData (const int8_t*& data, uint64_t& dataSize) { return false; }
 };
 
 //-----------------------------------------------------------------------------
@@ -56,6 +60,7 @@ public:
 	MemoryContentProvider (const void* data, uint32_t dataSize);		// data must be valid the whole lifetime of this object
 	uint32_t readRawXmlData (int8_t* buffer, uint32_t size) override;
 	void rewind () override;
+	bool getRawXmlData (const int8_t*& data, uint64_t& dataSize) override;
 };
 
 //-----------------------------------------------------------------------------
@@ -66,6 +71,8 @@ public:
 
 	uint32_t readRawXmlData (int8_t* buffer, uint32_t size) override;
 	void rewind () override;
+	/** only works if the stream is a MemoryBackedStream with its content in memory */
+	bool getRawXmlData (const int8_t*& data, uint64_t& dataSize) override;
 protected:
 	InputStream& stream;
 	int64_t startPos;
@@ -3,9 +3,11 @@
 // distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
 
 #include "lib/cbitmap.cpp"
+#include "lib/cbitmapcache.cpp"
 #include "lib/cbitmapfilter.cpp"
 #include "lib/ccolor.cpp"
 #include "lib/cdatabrowser.cpp"
+#include "lib/cdisplaylist.cpp"
 #include "lib/cdrawcontext.cpp"
 #include "lib/cdrawmethods.cpp"
 #include "lib/cdropsource.cpp"
@@ -30,6 +32,7 @@
 #include "lib/cview.cpp"
 #include "lib/cviewcontainer.cpp"
 #include "lib/cvstguitimer.cpp"
+#include "lib/drawprofiler.cpp"
 #include "lib/genericstringlistdatabrowsersource.cpp"
 #include "lib/vstguidebug.cpp"
 
@@ -39,6 +42,7 @@
 #include "lib/controls/ccontrol.cpp"
 #include "lib/controls/cfontchooser.cpp"
 #include "lib/controls/cknob.cpp"
+#include "lib/controls/clevelmeter.cpp"
 #include "lib/controls/cmoviebitmap.cpp"
 #include "lib/controls/cmoviebutton.cpp"
 #include "lib/controls/coptionmenu.cpp"
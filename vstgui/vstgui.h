@@ -7,10 +7,12 @@
 
 #include "lib/vstguibase.h"
 #include "lib/cbitmap.h"
+#include "lib/cbitmapcache.h"
 #include "lib/cbitmapfilter.h"
 #include "lib/cbuttonstate.h"
 #include "lib/ccolor.h"
 #include "lib/cdatabrowser.h"
+#include "lib/cdisplaylist.h"
 #include "lib/cdrawcontext.h"
 #include "lib/cdrawmethods.h"
 #include "lib/cdropsource.h"
@@ -45,6 +47,7 @@
 #include "lib/controls/ccontrol.h"
 #include "lib/controls/cfontchooser.h"
 #include "lib/controls/cknob.h"
+#include "lib/controls/clevelmeter.h"
 #include "lib/controls/cmoviebitmap.h"
 #include "lib/controls/cmoviebutton.h"
 #include "lib/controls/coptionmenu.h"
@@ -3,6 +3,7 @@
 #include "lib/platform/linux/linuxstring.cpp"
 
 #include "lib/platform/linux/x11frame.cpp"
+#include "lib/platform/linux/x11headlessframe.cpp"
 #include "lib/platform/linux/x11platform.cpp"
 #include "lib/platform/linux/x11timer.cpp"
 
@@ -13,3 +14,4 @@
 #include "lib/platform/linux/cairopath.cpp"
 
 #include "lib/platform/common/fileresourceinputstream.cpp"
+#include "lib/platform/common/mappedfileresourceinputstream.cpp"
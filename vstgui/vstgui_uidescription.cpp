@@ -9,6 +9,7 @@
 #include "uidescription/uidescription.cpp"
 #include "uidescription/uiviewcreator.cpp"
 #include "uidescription/uiviewfactory.cpp"
+#include "uidescription/uiviewplaceholder.cpp"
 #include "uidescription/uiviewswitchcontainer.cpp"
 
 #include "uidescription/editing/uiactions.cpp"